@@ -0,0 +1,31 @@
+/*=============================================================
+	 File Name: boot_options.h
+	 Created on: Oct 19, 2026
+==============================================================*/
+
+#ifndef INC_BOOT_OPTIONS_H_
+#define INC_BOOT_OPTIONS_H_
+
+/*
+ * Options read by stm32f1xx_hal_conf.h as well as by main.h, kept apart
+ * from main.h for the HAL driver sources, which do not include it.
+ */
+
+/*
+ * 1 : the bootloader takes updates over CAN itself with SRV/UPDATER.
+ *     Clocks and GPIO are set up once, the new image is started right after
+ *     its last page, no jump to the receiver and no reset in between. The
+ *     receiver partition is then unused but for the download journal page.
+ *     The HAL CAN driver is enabled. Link the UPDATER, JOURNAL, IMAGE,
+ *     DELTA, LZSS, SPARSE, TRACE and BENCH folders of
+ *     Firmware_Receiver/Core/Src/SRV into Updater/SRV next to the ones the
+ *     project links already (Project > Properties > Resource > Linked
+ *     Resources, or the whole SRV folder as the Firmware project does).
+ *     The image takes about 15KB of the 25KB of STM32F103C8TX_FLASH.ld.
+ * 0 : button 1 and CMD_ENTER_UPDATE start the standalone Firmware_Receiver.
+ *     The project links the BOOTAPI, BOOTCTL, BOOTMBX and CRC folders of
+ *     SRV and the FPEC driver only, the HAL CAN driver is left out.
+ */
+#define BOOTLOADER_UPDATER_ENABLE 0
+
+#endif /* INC_BOOT_OPTIONS_H_ */
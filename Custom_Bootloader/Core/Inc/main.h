@@ -19,29 +19,34 @@
   *
   * 2. NVIC Interrupts: All Nested Vectored Interrupt Controller (NVIC) interrupts are disabled
   *    to prevent any interruptions during the application jump. This ensures a clean transition
-  *    to the new application.
+  *    to the new application. Only the registers of the 43 interrupts of the STM32F103xB are written.
   *
   * 3. Clear Pending Interrupts: The function clears all pending NVIC interrupts. This is
   *    necessary to avoid any lingering interrupt requests that might affect the stability of
   *    the new application.
   *
-  * 4. SysTick Timer: The SysTick timer is disabled to prevent any timing-related interruptions
+  * 4. Peripherals: Instead of HAL_DeInit, the peripherals the bootloader used get one pulse of
+  *    their RCC->APB1RSTR/APB2RSTR reset bit, their clocks are switched off and RCC->CFGR gets its
+  *    reset value. The DWT cycle counter is restarted at this point and left running, so the
+  *    application can read the cost of the handoff from DWT->CYCCNT.
+  *
+  * 5. SysTick Timer: The SysTick timer is disabled to prevent any timing-related interruptions
   *    during the jump. This ensures that the timing behavior of the new application remains
   *    unaffected by previous settings.
   *
-  * 5. Fault Handlers: Fault handlers, including Usage Fault, Bus Fault, and Memory Management Fault
+  * 6. Fault Handlers: Fault handlers, including Usage Fault, Bus Fault, and Memory Management Fault
   *    handlers, are disabled. This ensures a stable execution environment in the new application.
   *
-  * 6. Main Stack Pointer (MSP): If the Main Stack Pointer (MSP) is not currently active, it is
+  * 7. Main Stack Pointer (MSP): If the Main Stack Pointer (MSP) is not currently active, it is
   *    activated. The MSP is set to the value of the Process Stack Pointer (PSP), and the SPSEL
   *    bit in the CONTROL register is cleared. This step ensures that the correct stack is active
   *    for the new application.
   *
-  * 7. Vector Table: The Vector Table Offset Register (VTOR) is loaded with the memory address
+  * 8. Vector Table: The Vector Table Offset Register (VTOR) is loaded with the memory address
   *    specified by the "address" parameter. This ensures that the CPU uses the correct
   *    vector table for interrupt handling in the new application.
   *
-  * 8. Jump to Application: Finally, the function calls the "JumpToApplication" function, passing
+  * 9. Jump to Application: Finally, the function calls the "JumpToApplication" function, passing
   *    the relevant stack pointer and program counter values to initiate the jump to the new
   *    application's code. This effectively transitions control to the new application, and the
   *    bootloader's role in the process is complete.
@@ -64,9 +69,59 @@
 
 #include "stm32f1xx_hal.h"
 
+/* BOOTLOADER_UPDATER_ENABLE is set in boot_options.h, which the HAL configuration reads too */
+
+/*
+ * Time the menu waits for a button before it starts the active slot as
+ * button 2 would, in milliseconds. 0 waits for a button forever.
+ */
+#define BOOT_AUTOSTART_MS 0
+
+/*
+ * 1 : clocks, SysTick, GPIO, EXTI and TIM1 are set up with register writes,
+ *     and the LCD driver, the menu and the interrupt handlers use the pin
+ *     and tick accessors below. No HAL code is linked. The image fits 8KB:
+ *     link with STM32F103C8TX_FLASH_HALFREE.ld, which leaves
+ *     0x08002000-0x080063FF free.
+ * 0 : the CubeMX initialization through the HAL.
+ */
+#define BOOTLOADER_HAL_FREE 0
+
+/*
+ * Defined in the bootloader only: SRV/BOOTAPI places its service table
+ * (flash, CRC, CAN, slot and mailbox services) in the .boot_api section at
+ * BOOTAPI_ADDRESS, for the applications to call.
+ */
+#define BOOTAPI_PROVIDER
+
+#if (BOOTLOADER_HAL_FREE == 1) && (BOOTLOADER_UPDATER_ENABLE == 1)
+#error "The update engine needs the HAL CAN driver, BOOTLOADER_HAL_FREE builds without it"
+#endif
+
+#if BOOTLOADER_HAL_FREE == 1
+/* Millisecond tick of the HAL-free build, counted by SysTick_Handler */
+extern volatile uint32_t bootTick;
+/* Pins through BSRR and IDR, the tick and delays on bootTick */
+#define BOOT_WRITE_PIN(Port, Pin, State)   BootWritePin((Port), (Pin), (State))
+#define BOOT_READ_PIN(Port, Pin)           ((((Port)->IDR & (Pin)) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET)
+#define BOOT_GET_TICK()                    (bootTick)
+#define BOOT_DELAY(Delay)                  BootDelay(Delay)
+void BootWritePin(GPIO_TypeDef *Port, uint16_t Pin, uint32_t State);
+void BootDelay(uint32_t Delay);
+#else
+#define BOOT_WRITE_PIN(Port, Pin, State)   HAL_GPIO_WritePin((Port), (Pin), (State))
+#define BOOT_READ_PIN(Port, Pin)           HAL_GPIO_ReadPin((Port), (Pin))
+#define BOOT_GET_TICK()                    HAL_GetTick()
+#define BOOT_DELAY(Delay)                  HAL_Delay(Delay)
+#endif
+
+/* CAN protocol and flash layout of Firmware_Receiver/Core/Src/LIB/Protocol, shared by every image */
+#include "LIB/Protocol/Protocol.h"
+
 
 /* Exported functions prototypes ---------------------------------------------*/
 void Error_Handler(void);
+uint32_t SelectSlot(void);
 
 
 
@@ -32,10 +32,15 @@
   * @brief This is the list of modules to be used in the HAL driver
   */
 
+#include "boot_options.h"
+
 #define HAL_MODULE_ENABLED
   /*#define HAL_ADC_MODULE_ENABLED   */
 /*#define HAL_CRYP_MODULE_ENABLED   */
-/*#define HAL_CAN_MODULE_ENABLED   */
+/* Only the update engine of the bootloader drives CAN through the HAL */
+#if BOOTLOADER_UPDATER_ENABLE == 1
+#define HAL_CAN_MODULE_ENABLED
+#endif
 /*#define HAL_CAN_LEGACY_MODULE_ENABLED   */
 /*#define HAL_CEC_MODULE_ENABLED   */
 /*#define HAL_CORTEX_MODULE_ENABLED   */
@@ -56,6 +56,11 @@ void SVC_Handler(void);
 void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
+void EXTI15_10_IRQHandler(void);
+#if BOOTLOADER_UPDATER_ENABLE == 1
+void USB_LP_CAN1_RX0_IRQHandler(void);
+void CAN1_SCE_IRQHandler(void);
+#endif
 /* USER CODE BEGIN EFP */
 
 /* USER CODE END EFP */
@@ -10,16 +10,26 @@
   * button input, and transitioning to different applications.
   *
   * Memory Layout:
-  * The bootloader occupies the first 10KB of flash memory, followed by the OTA (Over-The-Air)
-  * Application, and the firmware application.
+  * The bootloader occupies the first 8KB of flash memory, or up to 25KB for the HAL builds,
+  * followed by the OTA (Over-The-Air) Application, and the firmware application.
   *
   *   |============================|0x08000000
-  *   |         Bootloader         |               >>> 25KB
+  *   |         Bootloader         |               >>> 8KB
+  *   |============================|0x08002000
+  *   |  Bootloader (HAL) or free  |               >>> 17KB
   *   |============================|0x08006400
-  *   | 	 Firmware Receiver     |			   >>> 30KB
+  *   |     Firmware Receiver      |               >>> 29KB
+  *   |============================|0x0800d800
+  *   | Download journal (JOURNAL) |               >>> 1KB
   *   |============================|0x0800dc00
-  *   |         New Firmware       |			   >>> 30KB
+  *   |   New Firmware (slot A)    |               >>> 30KB
   *   |============================|0x08015400
+  *   |   New Firmware (slot B)    |               >>> 30KB
+  *   |============================|0x0801cc00
+  *   |            Free            |               >>> 11KB
+  *   |============================|0x0801f800
+  *   | Boot control (SRV/BOOTCTL) |               >>> 2KB
+  *   |============================|0x08020000
   *
   *================================================================================================
   */
@@ -30,24 +40,61 @@
 #include "main.h"
 /* Include the header file for the LCD module */
 #include "LCD.h"
+/* Boot mailbox of Firmware_Receiver (SRV/BOOTMBX): a request left in the NOINIT region of the
+   SRAM by an image before a warm reset */
+#include "SRV/BOOTMBX/BOOTMBX.h"
+/* Slot selection, read from the boot control log of SRV/BOOTCTL */
+#include "SRV/BOOTCTL/BOOTCTL.h"
+#if BOOTLOADER_UPDATER_ENABLE == 1
+/* Update engine of Firmware_Receiver */
+#include "MCAL/FPEC/FPEC.h"
+#include "SRV/UPDATER/UPDATER.h"
+#endif
 /*================================================================================================*/
 /*									  	Addresses						            			  */
 /*================================================================================================*/
-/*Start address for the "SENDER" application after the bootloader. */
-#define RECEIVER_APPLICATION_START_ADDRESS (0x8006400UL)
+/* Application and slot addresses are in main.h, shared with the linked SRV modules */
 
-/*Start address for new firmware after a reserved portion for Application 2. */
-#define NEW_FIRMWARE_START_ADDRESS 		   (0x800dc00UL)
+/* Time a button must be quiet after an edge before its level is taken, in milliseconds */
+#define BUTTON_DEBOUNCE_MS 				   (20UL)
+
+/* Peripherals the bootloader clocks, put back to their reset state before an application starts */
+#define BOOT_APB2_PERIPHERALS 			   (RCC_APB2RSTR_AFIORST | RCC_APB2RSTR_IOPARST | RCC_APB2RSTR_IOPBRST | \
+											RCC_APB2RSTR_IOPCRST | RCC_APB2RSTR_IOPDRST | RCC_APB2RSTR_TIM1RST)
+#if BOOTLOADER_UPDATER_ENABLE == 1
+#define BOOT_APB1_PERIPHERALS 			   (RCC_APB1RSTR_PWRRST | RCC_APB1RSTR_CAN1RST)
+#else
+#define BOOT_APB1_PERIPHERALS 			   (RCC_APB1RSTR_PWRRST)
+#endif
+
+/* Interrupt enable and pending registers in use, the 43 interrupts of the STM32F103xB */
+#define NVIC_IRQ_REGISTERS 				   (((uint32_t)USBWakeUp_IRQn / 32UL) + 1UL)
 
 
 TIM_HandleTypeDef htim1;
+#if BOOTLOADER_UPDATER_ENABLE == 1
+CAN_HandleTypeDef hcan;
+static CAN_FilterTypeDef FilterConfig;
+static CAN_RxHeaderTypeDef RxHeader;
+static uint8_t RxData[8];
+#endif
 /*================================================================================================*/
 /*									 Global Variables						          			  */
 /*================================================================================================*/
 /* Variable to indicate whether new firmware has been found (0 = not found, 1 = found) */
 uint8_t firmwareFound = 0;
-/* Memory address where the new firmware starts (initialized to 0) */
+/* Memory address of the slot to start, slot A or slot B (initialized to 0) */
 uint32_t firmwareStart = 0;
+/* Buttons with a falling edge since the last debounce (GPIO_PIN_10, GPIO_PIN_11), set by the EXTI interrupt */
+volatile uint16_t buttonEdges = 0;
+/* HAL tick of the last edge, the buttons are read once they have been quiet for BUTTON_DEBOUNCE_MS */
+volatile uint32_t buttonEdgeTick = 0;
+/* Cycles of the initialization, from main to the LCD (DWT->CYCCNT), read with the debugger */
+uint32_t startupCycles = 0;
+#if BOOTLOADER_HAL_FREE == 1
+/* Milliseconds since MinimalInit started SysTick */
+volatile uint32_t bootTick = 0;
+#endif
 
 /*================================================================================================*/
 /*								 Bootloader Main Menue						          			  */
@@ -60,20 +107,66 @@ void mainMenue(){
   HAL_LCD_sendString("2: Start");
 }
 /*================================================================================================*/
-/*					 Function to read word from certain Address						   			  */
+/*					 Function to select the slot to start						   			  */
+/*================================================================================================*/
+uint32_t SelectSlot(void)
+{
+    /* Slot of the last record of the boot control log, or the other slot if it was erased */
+    uint8_t Slot = SRV_BOOTCTL_GetActiveSlot();
+
+    return (Slot == BOOTCTL_SLOT_NONE) ? 0 : SRV_BOOTCTL_SlotAddress(Slot);
+}
+/*================================================================================================*/
+/*					 Button edges, EXTI lines 10 and 11							   			  */
 /*================================================================================================*/
-uint32_t ReadWord(uint32_t DataAddress)
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 {
-    uint32_t Data = 0;
-    Data = *((volatile uint32_t*)(DataAddress));
-    return Data;
+    /* Every bounce restarts the debounce time */
+    buttonEdges |= GPIO_Pin;
+    buttonEdgeTick = BOOT_GET_TICK();
+}
+/*================================================================================================*/
+/*					 Function to get a debounced button press					   			  */
+/*================================================================================================*/
+uint16_t DebouncedButton(void)
+{
+    uint16_t Edges;
+
+    if ((buttonEdges == 0) || ((BOOT_GET_TICK() - buttonEdgeTick) < BUTTON_DEBOUNCE_MS))
+    {
+        return 0;
+    }
+    __disable_irq();
+    Edges = buttonEdges;
+    buttonEdges = 0;
+    __enable_irq();
+
+    /* Still low once the contacts settled: a press, button 1 first as in the old polling loop */
+    if ((Edges & GPIO_PIN_11) && (BOOT_READ_PIN(GPIOB, GPIO_PIN_11) == GPIO_PIN_RESET))
+    {
+        return GPIO_PIN_11;
+    }
+    if ((Edges & GPIO_PIN_10) && (BOOT_READ_PIN(GPIOB, GPIO_PIN_10) == GPIO_PIN_RESET))
+    {
+        return GPIO_PIN_10;
+    }
+    return 0;
 }
 void SystemClock_Config(void);
+#if BOOTLOADER_HAL_FREE == 1
+static void MinimalInit(void);
+#else
 static void MX_GPIO_Init(void);
 static void MX_TIM1_Init(void);
+#endif
+#if BOOTLOADER_UPDATER_ENABLE == 1
+static void MX_CAN_Init(void);
+static void UpdateAndStart(void);
+#endif
 
 /* Function to perform a jump to a different address */
 static void StartApplication(uint32_t *address);
+static void ReleasePeripherals(void);
 void EnsurePrivilegedMode(void);
 void ActivateMSP(void);
 /* Assembly function for the jump to a different address */
@@ -84,14 +177,57 @@ void JumpToApplication(uint32_t newStackPointer, uint32_t newProgramCounter);
 /*================================================================================================*/
 int main(void)
 {
+	  /* Read and cleared, the next reset shows the menu */
+	  uint32_t Command = SRV_BOOTMBX_Take();
+
+	  /* An update was just activated (Firmware_Receiver or SRV/AGENT): start the active slot right
+	     away, the ECU is back in service without the menu. Nothing is initialized yet */
+	  if (Command == BOOTMBX_CMD_START)
+	  {
+	    firmwareStart = SelectSlot();
+	    if (firmwareStart != 0)
+	    {
+	      StartApplication((uint32_t *)firmwareStart);
+	    }
+	  }
+
+#if BOOTLOADER_UPDATER_ENABLE == 0
+	  /* An application asked for an update over CAN (CMD_ENTER_UPDATE): start the receiver right
+	     away, without the menu, the LCD or a button. Nothing is initialized yet */
+	  if (Command == BOOTMBX_CMD_UPDATE)
+	  {
+	    StartApplication((uint32_t *)RECEIVER_APPLICATION_START_ADDRESS);
+	  }
+#endif
+
+	  /* Count the cycles of the initialization */
+	  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	  DWT->CYCCNT = 0;
+	  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#if BOOTLOADER_HAL_FREE == 1
+	  /* Clock, SysTick, pins and TIM1 with register writes */
+	  MinimalInit();
+#else
 	  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
 	  HAL_Init();
 	  /* Configure the system clock */
 	  SystemClock_Config();
 	  /* Initialize all configured peripherals */
 	  MX_GPIO_Init();
+#endif
+#if BOOTLOADER_UPDATER_ENABLE == 1
+	  /* The same request served here, without the menu, the LCD or a button */
+	  if (Command == BOOTMBX_CMD_UPDATE)
+	  {
+	    UpdateAndStart();
+	  }
+#endif
+#if BOOTLOADER_HAL_FREE == 0
 	  MX_TIM1_Init();
 	  HAL_TIM_Base_Start(&htim1);
+#endif
+	  startupCycles = DWT->CYCCNT;
 	  HAL_LCD_Init();
 	  HAL_LCD_clearScreen();
 	  HAL_LCD_moveCursor(0, 0);
@@ -100,60 +236,77 @@ int main(void)
 
 	  /* Display the main menu on the LCD */
 	  mainMenue();
-	  /* Read the starting address of the new firmware */
-	   firmwareStart = ReadWord(NEW_FIRMWARE_START_ADDRESS);
+	  /* Select the active slot, the one the last update switched to */
+	   firmwareStart = SelectSlot();
 
 	   /* Check if valid firmware address is found */
-	   if (firmwareStart != 0xFFFFFFFF) {
+	   if (firmwareStart != 0) {
 	     firmwareFound = 1;
 	   }
 
-	  /* Variables to store button states */
-	  GPIO_PinState ButtonOne;
-	  GPIO_PinState ButtonTwo;
+	  /* Button pressed, GPIO_PIN_11 for button 1, GPIO_PIN_10 for button 2, 0 for none */
+	  uint16_t Pressed;
+#if BOOT_AUTOSTART_MS > 0
+	  /* Start of the wait for a button */
+	  uint32_t menuTick = BOOT_GET_TICK();
+#endif
+
+	  BOOT_WRITE_PIN(GPIOA, GPIO_PIN_2, GPIO_PIN_SET); /* Turn on the red LED */
 
   while (1)
   {
-    HAL_GPIO_WritePin(GPIOA,GPIO_PIN_2, GPIO_PIN_SET); /* Turn on the red LED */
-    ButtonOne = HAL_GPIO_ReadPin( GPIOB, GPIO_PIN_11); /* Read the state of button 1 */
-    ButtonTwo = HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_10); /* Read the state of button 2 */
+    Pressed = DebouncedButton();
+#if BOOT_AUTOSTART_MS > 0
+    /* Nobody pressed a button in time, start the active slot as button 2 would */
+    if ((Pressed == 0) && (firmwareFound == 1) && ((BOOT_GET_TICK() - menuTick) >= BOOT_AUTOSTART_MS))
+    {
+      Pressed = GPIO_PIN_10;
+    }
+#endif
 
-    if (GPIO_PIN_RESET == ButtonOne)
+    if (GPIO_PIN_11 == Pressed)
     {
     	HAL_LCD_clearScreen();
     	HAL_LCD_moveCursor(0, 3);
     	HAL_LCD_sendString("Updating...");
-      HAL_DeInit(); /* De-initialize HAL */
+#if BOOTLOADER_UPDATER_ENABLE == 1
+      /* Take the update here, the peripherals are already up */
+      UpdateAndStart();
+#else
       /* Jump to Reciever Application */
       StartApplication((uint32_t *)RECEIVER_APPLICATION_START_ADDRESS);
+#endif
     }
 
-    else if (GPIO_PIN_RESET == ButtonTwo)
+    else if (GPIO_PIN_10 == Pressed)
     {
       if(firmwareFound == 1){
       HAL_LCD_clearScreen();
 	  HAL_LCD_moveCursor(0, 3);
 	  HAL_LCD_sendString("Starting...");
-      HAL_DeInit(); /* De-initialize HAL */
-      /* Jump to New Firmware*/
-      StartApplication((uint32_t *)NEW_FIRMWARE_START_ADDRESS);
+      /* Jump to New Firmware in the active slot */
+      StartApplication((uint32_t *)firmwareStart);
       }
       else {
         /* Clear the LCD and display "No Updates" message */
         HAL_LCD_clearScreen();
         HAL_LCD_moveCursor(0, 3);
         HAL_LCD_sendString("No Updates");
-        HAL_Delay(1500);
+        BOOT_DELAY(1500);
         HAL_LCD_clearScreen();
         /* Display the main menu again */
         mainMenue();
       }
     }
 
+    /* Sleep until the next button edge or HAL tick */
+    __WFI();
+
   }
 }
 
 
+#if BOOTLOADER_HAL_FREE == 0
 /**
   * @brief System Clock Configuration
   * @retval None
@@ -188,7 +341,188 @@ void SystemClock_Config(void)
     Error_Handler();
   }
 }
+#endif
+
+#if BOOTLOADER_UPDATER_ENABLE == 1
+/**
+  * @brief  Frames of the transfer and of the control channel go to the updater.
+  * @param  hcan: CAN handle pointer
+  * @retval None
+  */
+void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
+{
+  if (HAL_CAN_GetRxMessage(hcan, CAN_RX_FIFO0, &RxHeader, RxData) != HAL_OK)
+  {
+    Error_Handler();
+    return;
+  }
+  SRV_UPDATER_RxIndication(&RxHeader, RxData);
+}
+
+/**
+  * @brief  Bus errors are left to the automatic retransmission and bus-off recovery,
+  *         the updater records the error state for CMD_READ_LINK.
+  * @param  hcan: CAN handle pointer
+  * @retval None
+  */
+void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan)
+{
+  (void)hcan;
+  SRV_UPDATER_ErrorIndication();
+}
+
+/**
+  * @brief CAN Initialization Function, the bit timing of Firmware_Receiver
+  * @param None
+  * @retval None
+  */
+static void MX_CAN_Init(void)
+{
+  hcan.Instance = CAN1;
+  hcan.Init.Prescaler = 16;
+  hcan.Init.Mode = CAN_MODE_NORMAL;
+  hcan.Init.SyncJumpWidth = CAN_SJW_1TQ;
+  hcan.Init.TimeSeg1 = CAN_BS1_2TQ;
+  hcan.Init.TimeSeg2 = CAN_BS2_2TQ;
+  hcan.Init.TimeTriggeredMode = DISABLE;
+  hcan.Init.AutoBusOff = ENABLE;
+  hcan.Init.AutoWakeUp = DISABLE;
+  hcan.Init.AutoRetransmission = ENABLE;
+  hcan.Init.ReceiveFifoLocked = DISABLE;
+  hcan.Init.TransmitFifoPriority = ENABLE;
+  if (HAL_CAN_Init(&hcan) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* Data frames with either sequence bit, and the commands of the control channel */
+  FilterConfig.FilterActivation = ENABLE;
+  FilterConfig.FilterFIFOAssignment = CAN_FILTER_FIFO0;
+  FilterConfig.FilterBank = 0;
+  FilterConfig.FilterMode = CAN_FILTERMODE_IDMASK;
+  FilterConfig.FilterScale = CAN_FILTERSCALE_32BIT;
+  FilterConfig.FilterIdHigh = (DATA_FRAME_ID << 5);
+  FilterConfig.FilterIdLow = 0x0000;
+  FilterConfig.FilterMaskIdHigh = ((0x7FF & ~DATA_FRAME_SEQ_MASK) << 5);
+  FilterConfig.FilterMaskIdLow = 0x0000;
+  if (HAL_CAN_ConfigFilter(&hcan, &FilterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  FilterConfig.FilterBank = 1;
+  FilterConfig.FilterIdHigh = (CMD_FRAME_ID << 5);
+  FilterConfig.FilterMaskIdHigh = (0x7FF << 5);
+  if (HAL_CAN_ConfigFilter(&hcan, &FilterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/*================================================================================================*/
+/*					 Update over CAN, then start the new image					   			  */
+/*================================================================================================*/
+static void UpdateAndStart(void)
+{
+  /* With LCD_RS_ON_PA3 = 0 CAN takes PA11 from the LCD, the LCD is not written any more */
+  MX_CAN_Init();
+  MCAL_FPEC_Init();
+  /* Restore the progress of an interrupted download from the journal */
+  SRV_UPDATER_Init(&hcan);
+  if (HAL_CAN_ActivateNotification(&hcan, CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_ERROR_WARNING | CAN_IT_ERROR_PASSIVE |
+                                          CAN_IT_BUSOFF | CAN_IT_LAST_ERROR_CODE | CAN_IT_ERROR) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  HAL_CAN_Start(&hcan);
+
+  /* Program each page as soon as it is complete, until the image is verified and activated */
+  while (SRV_UPDATER_MainFunction() == FALSE)
+  {
+  }
+
+  /* The last ACK is out, the slot just activated is the one to start */
+  firmwareStart = SelectSlot();
+  StartApplication((uint32_t *)firmwareStart);
+}
+#endif /* BOOTLOADER_UPDATER_ENABLE */
 
+#if BOOTLOADER_HAL_FREE == 1
+/*================================================================================================*/
+/*					 Register level initialization, the HAL-free build			   			  */
+/*================================================================================================*/
+/* CRL/CRH field of a pin: push-pull output at 2MHz, floating input */
+#define PIN_OUTPUT_PP_2MHZ 				   (0x2UL)
+#define PIN_INPUT_FLOATING 				   (0x4UL)
+
+static void ConfigurePins(GPIO_TypeDef *Port, uint16_t Pins, uint32_t Config)
+{
+  volatile uint32_t *Register;
+  uint32_t Shift;
+
+  for (uint32_t Pin = 0; Pin < 16; Pin++)
+  {
+    if (Pins & (1UL << Pin))
+    {
+      Register = (Pin < 8) ? &Port->CRL : &Port->CRH;
+      Shift = (Pin & 7UL) * 4UL;
+      *Register = (*Register & ~(0xFUL << Shift)) | (Config << Shift);
+    }
+  }
+}
+
+/* One BSRR write, a call of its own keeps the LCD driver as small as with HAL_GPIO_WritePin */
+void BootWritePin(GPIO_TypeDef *Port, uint16_t Pin, uint32_t State)
+{
+  Port->BSRR = (State != 0U) ? (uint32_t)Pin : ((uint32_t)Pin << 16U);
+}
+
+/* At least Delay milliseconds, as HAL_Delay */
+void BootDelay(uint32_t Delay)
+{
+  uint32_t Start = bootTick;
+
+  while ((bootTick - Start) <= Delay)
+  {
+  }
+}
+
+static void MinimalInit(void)
+{
+  /* What HAL_Init and HAL_MspInit set up: prefetch buffer, 1ms SysTick, SWD without JTAG */
+  FLASH->ACR |= FLASH_ACR_PRFTBE;
+  SysTick_Config(SystemCoreClock / 1000U);
+  NVIC_SetPriority(SysTick_IRQn, TICK_INT_PRIORITY);
+  __HAL_RCC_AFIO_CLK_ENABLE();
+  __HAL_AFIO_REMAP_SWJ_NOJTAG();
+  /* The HSI of the reset is the clock SystemClock_Config selects, RCC is left alone */
+
+  /* The pins of MX_GPIO_Init, the outputs are low after the reset */
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_GPIOD_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  ConfigurePins(GPIOC, GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15, PIN_OUTPUT_PP_2MHZ);
+  ConfigurePins(GPIOA, GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8|RS_Pin, PIN_OUTPUT_PP_2MHZ);
+  ConfigurePins(GPIOB, GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15, PIN_OUTPUT_PP_2MHZ);
+  ConfigurePins(GPIOB, GPIO_PIN_10|GPIO_PIN_11, PIN_INPUT_FLOATING);
+
+  /* Buttons: EXTI lines 10 and 11 on port B, falling edge */
+  AFIO->EXTICR[2] = (AFIO->EXTICR[2] & ~(AFIO_EXTICR3_EXTI10 | AFIO_EXTICR3_EXTI11)) |
+                    AFIO_EXTICR3_EXTI10_PB | AFIO_EXTICR3_EXTI11_PB;
+  EXTI->FTSR |= (GPIO_PIN_10 | GPIO_PIN_11);
+  EXTI->IMR |= (GPIO_PIN_10 | GPIO_PIN_11);
+  NVIC_SetPriority(EXTI15_10_IRQn, 0);
+  NVIC_EnableIRQ(EXTI15_10_IRQn);
+
+  /* TIM1 for the delays of the LCD, the settings of MX_TIM1_Init, started */
+  __HAL_RCC_TIM1_CLK_ENABLE();
+  TIM1->PSC = 72-1;
+  TIM1->ARR = 0xffff-1;
+  TIM1->EGR = TIM_EGR_UG;
+  TIM1->CR1 = TIM_CR1_CEN;
+  htim1.Instance = TIM1;
+}
+#else
 static void MX_TIM1_Init(void)
 {
   TIM_ClockConfigTypeDef sClockSourceConfig = {0};
@@ -228,7 +562,7 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_WritePin(GPIOC, GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15, GPIO_PIN_RESET);
 
   /*Configure GPIO pin Output Level */
-  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8|GPIO_PIN_11, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8|RS_Pin, GPIO_PIN_RESET);
 
   /*Configure GPIO pin Output Level */
   HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15, GPIO_PIN_RESET);
@@ -240,16 +574,16 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
 
-  /*Configure GPIO pins : PA1 PA2 PA8 PA11 */
-  GPIO_InitStruct.Pin = GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8|GPIO_PIN_11;
+  /*Configure GPIO pins : PA1 PA2 PA8 and the RS line, PA11 or PA3 */
+  GPIO_InitStruct.Pin = GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8|RS_Pin;
   GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
-  /*Configure GPIO pins : PB10 PB11 */
+  /*Configure GPIO pins : PB10 PB11, buttons pulling low, an edge wakes the menu */
   GPIO_InitStruct.Pin = GPIO_PIN_10|GPIO_PIN_11;
-  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
@@ -260,7 +594,12 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
+  /* EXTI interrupt init */
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+
 }
+#endif /* BOOTLOADER_HAL_FREE */
 
 void EnsurePrivilegedMode()
 {
@@ -284,29 +623,48 @@ void ActivateMSP()
     }
 }
 
+/* Register level replacement of HAL_DeInit: one reset pulse for the peripherals the bootloader
+   touched and the clock configuration of a reset, a few microseconds instead of milliseconds */
+static void ReleasePeripherals(void)
+{
+  /* Handoff cost: the cycle counter runs on into the application, which reads it first thing */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  /* EXTI has no reset bit, no interrupt and no pending edge of the buttons is left behind */
+  EXTI->IMR &= ~(GPIO_PIN_10 | GPIO_PIN_11);
+  EXTI->FTSR &= ~(GPIO_PIN_10 | GPIO_PIN_11);
+  EXTI->PR = (GPIO_PIN_10 | GPIO_PIN_11);
+
+  RCC->APB2RSTR = BOOT_APB2_PERIPHERALS;
+  RCC->APB2RSTR = 0;
+  RCC->APB1RSTR = BOOT_APB1_PERIPHERALS;
+  RCC->APB1RSTR = 0;
+  /* Peripheral clocks off, the reset values */
+  RCC->APB2ENR = 0;
+  RCC->APB1ENR = 0;
+  /* HSI without prescalers, what SystemClock_Config set up is the clock of a reset */
+  RCC->CFGR = 0;
+  while ((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_HSI);
+  /* The flash stays locked for the application */
+  FLASH->CR = FLASH_CR_LOCK;
+}
+
 static void StartApplication(uint32_t *address)
 {
+  uint32_t Register;
+
   EnsurePrivilegedMode();
 
-  /* Disable all NVIC interrupts */
-  NVIC->ICER[0] = 0xFFFFFFFF;
-  NVIC->ICER[1] = 0xFFFFFFFF;
-  NVIC->ICER[2] = 0xFFFFFFFF;
-  NVIC->ICER[3] = 0xFFFFFFFF;
-  NVIC->ICER[4] = 0xFFFFFFFF;
-  NVIC->ICER[5] = 0xFFFFFFFF;
-  NVIC->ICER[6] = 0xFFFFFFFF;
-  NVIC->ICER[7] = 0xFFFFFFFF;
-
-  /* Clear all pending NVIC interrupts */
-  NVIC->ICPR[0] = 0xFFFFFFFF;
-  NVIC->ICPR[1] = 0xFFFFFFFF;
-  NVIC->ICPR[2] = 0xFFFFFFFF;
-  NVIC->ICPR[3] = 0xFFFFFFFF;
-  NVIC->ICPR[4] = 0xFFFFFFFF;
-  NVIC->ICPR[5] = 0xFFFFFFFF;
-  NVIC->ICPR[6] = 0xFFFFFFFF;
-  NVIC->ICPR[7] = 0xFFFFFFFF;
+  /* Disable all NVIC interrupts and clear the pending ones */
+  for (Register = 0; Register < NVIC_IRQ_REGISTERS; Register++)
+  {
+    NVIC->ICER[Register] = 0xFFFFFFFF;
+    NVIC->ICPR[Register] = 0xFFFFFFFF;
+  }
+
+  ReleasePeripherals();
 
   /* Disable Systick */
   SysTick->CTRL = 0;
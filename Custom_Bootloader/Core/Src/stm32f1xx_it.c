@@ -56,6 +56,9 @@
 /* USER CODE END 0 */
 
 /* External variables --------------------------------------------------------*/
+#if BOOTLOADER_UPDATER_ENABLE == 1
+extern CAN_HandleTypeDef hcan;
+#endif
 
 /* USER CODE BEGIN EV */
 
@@ -184,7 +187,11 @@ void SysTick_Handler(void)
   /* USER CODE BEGIN SysTick_IRQn 0 */
 
   /* USER CODE END SysTick_IRQn 0 */
+#if BOOTLOADER_HAL_FREE == 1
+  bootTick++;
+#else
   HAL_IncTick();
+#endif
   /* USER CODE BEGIN SysTick_IRQn 1 */
 
   /* USER CODE END SysTick_IRQn 1 */
@@ -197,6 +204,44 @@ void SysTick_Handler(void)
 /* please refer to the startup file (startup_stm32f1xx.s).                    */
 /******************************************************************************/
 
+/**
+  * @brief This function handles EXTI line[15:10] interrupts, the buttons on PB10 and PB11.
+  */
+void EXTI15_10_IRQHandler(void)
+{
+#if BOOTLOADER_HAL_FREE == 1
+  /* The edges of both buttons, cleared and handed to the debounce at once */
+  uint32_t Pending = EXTI->PR & (GPIO_PIN_10 | GPIO_PIN_11);
+
+  EXTI->PR = Pending;
+  if (Pending != 0U)
+  {
+    HAL_GPIO_EXTI_Callback((uint16_t)Pending);
+  }
+#else
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_10);
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_11);
+#endif
+}
+
+#if BOOTLOADER_UPDATER_ENABLE == 1
+/**
+  * @brief This function handles USB low priority or CAN RX0 interrupts.
+  */
+void USB_LP_CAN1_RX0_IRQHandler(void)
+{
+  HAL_CAN_IRQHandler(&hcan);
+}
+
+/**
+  * @brief This function handles CAN SCE interrupt.
+  */
+void CAN1_SCE_IRQHandler(void)
+{
+  HAL_CAN_IRQHandler(&hcan);
+}
+#endif /* BOOTLOADER_UPDATER_ENABLE */
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
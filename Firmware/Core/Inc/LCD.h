@@ -17,8 +17,20 @@
 
 
 
+/*
+ * 0 : RS (Register Select) on PA11, the boards as built. PA11 is also CAN RX,
+ *     the LCD is not written while CAN runs.
+ * 1 : RS on PA3, after the RS line was moved to that free pin. The LCD stays
+ *     usable while CAN runs.
+ */
+#define LCD_RS_ON_PA3 0
+
 /* Define the GPIO pin for the RS (Register Select) pin of the LCD */
+#if LCD_RS_ON_PA3 == 1
+#define RS_Pin GPIO_PIN_3
+#else
 #define RS_Pin GPIO_PIN_11
+#endif
 #define RS_GPIO_Port GPIOA
 /* Define the GPIO pin for the EN (Enable) pin of the LCD */
 #define EN_Pin GPIO_PIN_8
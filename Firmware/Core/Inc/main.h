@@ -54,11 +54,27 @@ extern "C" {
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+/* Protocol entry of a received CAN frame, called from the HAL callback or from PendSV */
+void CAN_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data);
 
 /* USER CODE END EFP */
 
 /* Private defines -----------------------------------------------------------*/
 /* USER CODE BEGIN Private defines */
+/*
+ * 1 : the application takes its own updates over CAN with SRV/AGENT, the
+ *     SRV, MCAL and LIB folders of Firmware_Receiver are linked into the
+ *     project and CAN1 runs on PA11/PA12 as in the other images. PA11 is
+ *     the LCD RS line too, see LCD_RS_ON_PA3 in LCD.h.
+ * 0 : no CAN, updates go through the standalone receiver.
+ */
+#define UPDATE_AGENT_ENABLE 1
+
+/* RAM_VECTORS_ENABLE and RAM_ISR, shared with Firmware_Receiver */
+#include "LIB/RamVectors/RamVectors.h"
+
+/* CAN protocol and flash layout of Firmware_Receiver/Core/Src/LIB/Protocol, shared by every image */
+#include "LIB/Protocol/Protocol.h"
 
 /* USER CODE END Private defines */
 
@@ -8,14 +8,67 @@
 #include "main.h"
 #include "HAL/LCD/LCD.h"
 #include "HAL/LED/LED.h"
+#if UPDATE_AGENT_ENABLE == 1
+#include "SRV/AGENT/AGENT.h"
+#include "SRV/BOOTMBX/BOOTMBX.h"
+#endif
 
 TIM_HandleTypeDef htim1;
+/* Cycles from the bootloader's peripheral teardown to main, DWT->CYCCNT is restarted there */
+uint32_t handoffCycles = 0;
+#if UPDATE_AGENT_ENABLE == 1
+/* Vector table of the startup code, at the start of the slot the image was linked for */
+extern uint32_t g_pfnVectors[];
+CAN_HandleTypeDef hcan;
+static CAN_RxHeaderTypeDef RxHeader;
+static uint8_t RxData[8];
+#endif
 
 
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_TIM1_Init(void);
+#if UPDATE_AGENT_ENABLE == 1
+static void MX_CAN_Init(void);
+
+/**
+  * @brief  Frames of the update go to the agent, the others are the application's.
+  * @param  Header: header of the received frame
+  * @param  Data: payload of the received frame
+  * @retval None
+  */
+void CAN_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data)
+{
+  (void)SRV_AGENT_RxIndication(Header, Data);
+}
+
+#if RAM_VECTORS_ENABLE == 0
+/**
+  * @brief  Frame pending in FIFO 0, read by the HAL. The SRAM build reads it in stm32f1xx_it.c.
+  * @param  hcan: CAN handle pointer
+  * @retval None
+  */
+void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
+{
+  if (HAL_CAN_GetRxMessage(hcan, CAN_RX_FIFO0, &RxHeader, RxData) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  CAN_RxIndication(&RxHeader, RxData);
+}
+#endif
+
+/**
+  * @brief  Bus errors are left to the automatic retransmission and bus-off recovery.
+  * @param  hcan: CAN handle pointer
+  * @retval None
+  */
+void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan)
+{
+  HAL_CAN_ResetError(hcan);
+}
+#endif
 
 /**
   * @brief  The application entry point.
@@ -23,6 +76,8 @@ static void MX_TIM1_Init(void);
   */
 int main(void)
 {
+  /* First thing, before anything else uses the cycle counter */
+  handoffCycles = DWT->CYCCNT;
   /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
   HAL_Init();
   SystemClock_Config();
@@ -40,9 +95,50 @@ int main(void)
   HAL_LCD_sendString("UPDATED...");
 
   HAL_GPIO_WritePin(GPIOC, LED_BLUE, GPIO_PIN_SET);
+#if UPDATE_AGENT_ENABLE == 1
+  /* With LCD_RS_ON_PA3 = 0 CAN takes PA11 from the LCD, the LCD keeps the text above */
+  MX_CAN_Init();
+#if RAM_VECTORS_ENABLE == 1
+  /* The RX0 interrupt hands its frames over in PendSV, below every interrupt */
+  HAL_NVIC_SetPriority(PendSV_IRQn, 15, 0);
+#endif
+  /* The slot this image was linked for is the one it runs from, VTOR may point at the SRAM copy */
+  SRV_AGENT_Init(&hcan, (uint32_t)g_pfnVectors);
+  if (HAL_CAN_ActivateNotification(&hcan, CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_ERROR_WARNING | CAN_IT_ERROR_PASSIVE |
+                                          CAN_IT_BUSOFF | CAN_IT_LAST_ERROR_CODE | CAN_IT_ERROR) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  HAL_CAN_Start(&hcan);
+#endif
   while (1)
   {
-
+#if UPDATE_AGENT_ENABLE == 1
+    /* One step of the update per pass, the longest is a page erase */
+    switch (SRV_AGENT_MainFunction())
+    {
+    case AGENT_READY:
+#if LCD_RS_ON_PA3 == 1
+      HAL_LCD_clearScreen();
+      HAL_LCD_moveCursor(0,0);
+      HAL_LCD_sendString("UPDATE READY");
+#endif
+      /* The bootloader starts the slot just activated, without its menu */
+      SRV_BOOTMBX_Request(BOOTMBX_CMD_START);
+      break;
+    case AGENT_LEAVE:
+#if LCD_RS_ON_PA3 == 1
+      HAL_LCD_clearScreen();
+      HAL_LCD_moveCursor(0,0);
+      HAL_LCD_sendString("UPDATING...");
+#endif
+      /* Warm reset into the receiver, no button needed */
+      SRV_AGENT_EnterUpdater();
+      break;
+    default:
+      break;
+    }
+#endif
   }
 }
 
@@ -115,6 +211,33 @@ static void MX_TIM1_Init(void)
   HAL_TIMEx_MasterConfigSynchronization(&htim1, &sMasterConfig);
 
 }
+#if UPDATE_AGENT_ENABLE == 1
+/**
+  * @brief CAN Initialization Function, the bit timing of Firmware_Receiver
+  * @param None
+  * @retval None
+  */
+static void MX_CAN_Init(void)
+{
+  hcan.Instance = CAN1;
+  hcan.Init.Prescaler = 16;
+  hcan.Init.Mode = CAN_MODE_NORMAL;
+  hcan.Init.SyncJumpWidth = CAN_SJW_1TQ;
+  hcan.Init.TimeSeg1 = CAN_BS1_2TQ;
+  hcan.Init.TimeSeg2 = CAN_BS2_2TQ;
+  hcan.Init.TimeTriggeredMode = DISABLE;
+  hcan.Init.AutoBusOff = ENABLE;
+  hcan.Init.AutoWakeUp = DISABLE;
+  hcan.Init.AutoRetransmission = ENABLE;
+  hcan.Init.ReceiveFifoLocked = DISABLE;
+  hcan.Init.TransmitFifoPriority = ENABLE;
+  if (HAL_CAN_Init(&hcan) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+#endif
+
 /**
   * @brief GPIO Initialization Function
   * @param None
@@ -134,7 +257,7 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_WritePin(GPIOC, GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15, GPIO_PIN_RESET);
 
   /*Configure GPIO pin Output Level */
-  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8|GPIO_PIN_11, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8|RS_Pin, GPIO_PIN_RESET);
 
   /*Configure GPIO pin Output Level */
   HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15, GPIO_PIN_RESET);
@@ -146,8 +269,8 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
 
-  /*Configure GPIO pins : PA1 PA2 PA8 PA11 */
-  GPIO_InitStruct.Pin = GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8|GPIO_PIN_11;
+  /*Configure GPIO pins : PA1 PA2 PA8 and the RS line, PA11 or PA3 */
+  GPIO_InitStruct.Pin = GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8|RS_Pin;
   GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
@@ -97,6 +97,9 @@
   * @}
   */
 
+/* Vector table of the startup file */
+extern uint32_t g_pfnVectors[];
+
 /** @addtogroup STM32F1xx_System_Private_Variables
   * @{
   */
@@ -194,7 +197,8 @@ void SystemInit (void)
 #ifdef VECT_TAB_SRAM
   SCB->VTOR = SRAM_BASE | VECT_TAB_OFFSET; /* Vector Table Relocation in Internal SRAM. */
 #else
-  SCB->VTOR = FLASH_BASE | VECT_TAB_OFFSET; /* Vector Table Relocation in Internal FLASH. */
+  /* The image runs from slot A or slot B, its vector table is where it was linked */
+  SCB->VTOR = (uint32_t)g_pfnVectors; /* Vector Table Relocation in Internal FLASH. */
 #endif 
 }
 
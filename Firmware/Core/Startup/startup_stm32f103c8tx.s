@@ -91,6 +91,24 @@ LoopFillZerobss:
 
 /* Call the clock system intitialization function.*/
     bl  SystemInit
+/* Copy the vector table to the SRAM and point VTOR at the copy, .ram_vector
+   is only given a size with RAM_VECTORS_ENABLE (LIB/RamVectors) */
+  ldr r0, =_sram_vector
+  ldr r1, =_eram_vector
+  cmp r0, r1
+  beq VectorsInFlash
+  ldr r2, =g_pfnVectors
+CopyVectors:
+  ldr r3, [r2], #4
+  str r3, [r0], #4
+  cmp r0, r1
+  bcc CopyVectors
+  ldr r0, =_sram_vector
+  ldr r1, =0xE000ED08
+  str r0, [r1]
+  dsb
+  isb
+VectorsInFlash:
 /* Call static constructors */
     bl __libc_init_array
 /* Call the application's entry point.*/
@@ -12,21 +12,18 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f1xx_hal.h"
 
-#define APPLICATION_SIZE  6856UL
-#define CHUNK_SIZE 8
-#define DATA_FRAME_ID 0x123
+/* CAN protocol and flash layout, shared with the other images */
+#include "../Src/LIB/Protocol/Protocol.h"
 
-
-/*Start address for the "SENDER" application after the bootloader. */
-#define RECEIVER_APPLICATION_START_ADDRESS (0x8006400UL)
-
-/*Start address for new firmware after a reserved portion for Application 2. */
-#define NEW_FIRMWARE_START_ADDRESS (0x800dc00UL)
-#define NEW_FIRMWARE_END_ADDRESS  (0x8020000UL)
+/* RAM_VECTORS_ENABLE and RAM_ISR, shared with the application */
+#include "../Src/LIB/RamVectors/RamVectors.h"
 
 /* Exported functions prototypes ---------------------------------------------*/
 void Error_Handler(void);
 
+/* Protocol entry of a received CAN frame, called from the HAL callback or from PendSV */
+void CAN_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data);
+
 
 #endif /* __MAIN_H */
 
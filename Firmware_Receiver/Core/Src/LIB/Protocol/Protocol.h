@@ -0,0 +1,91 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: Protocol.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * CAN update protocol and flash layout shared by every image: the
+ * receiver, the bootloader, the application with its update agent and
+ * the sender. The projects include it through the Firmware_Receiver/
+ * Core/Src include path, a code or an address is only ever changed
+ * here.
+ */
+#ifndef PROTOCOL_H_
+#define PROTOCOL_H_
+
+/* Define the chunk size for data transmission */
+#define CHUNK_SIZE 8
+#define DATA_FRAME_ID 0x123
+#define ACK_FRAME_ID 0x456
+/* First byte of every ACK frame */
+#define ACK_FRAME_DATA 0x1F
+/*
+ * First byte of a busy frame, sent on ACK_FRAME_ID with the sequence bit
+ * instead of the ACK while the frame completed a page that is being
+ * programmed. The ACK follows once the page is in flash; until then the
+ * sender waits RTO_BUSY_TICKS without backing off, and a retransmission is
+ * answered with another busy frame.
+ */
+#define ACK_FRAME_BUSY 0x1E
+/*
+ * The LSB of the data frame ID carries the sequence bit of the frame
+ * (alternating bit protocol). A frame with the bit of the previous frame is a
+ * retransmission whose ACK was lost: it is acknowledged again but not stored.
+ */
+#define DATA_FRAME_SEQ_MASK 0x001
+
+/*
+ * Control channel: the sender issues a command in byte 0 of a CMD_FRAME_ID
+ * frame, the receiver answers on RESP_FRAME_ID with the command code ORed
+ * with RESP_POSITIVE followed by its payload, or RESP_NEGATIVE and the
+ * rejected command code.
+ */
+#define CMD_FRAME_ID 0x120
+#define RESP_FRAME_ID 0x450
+#define RESP_POSITIVE 0x40
+#define RESP_NEGATIVE 0x7F
+/* Resume query, answered with the next expected frame index (uint32_t, little endian) */
+#define CMD_RESUME_QUERY 0x01
+/* Read one entry of a latency histogram, see SRV/TRACE */
+#define CMD_READ_TRACE 0x02
+/* Clear all latency histograms */
+#define CMD_CLEAR_TRACE 0x03
+/* Start a benchmark session of the given size (uint32_t, little endian), see SRV/BENCH */
+#define CMD_BENCH_START 0x04
+/* Read one benchmark measurement, see SRV/BENCH */
+#define CMD_BENCH_RESULT 0x05
+/*
+ * Start an image session: the next data frames carry the SRV/IMAGE header,
+ * which is acknowledged once the receiver accepted it, then the image. The
+ * header is refused, and a corrupt image reported, with RESP_NEGATIVE and
+ * this code.
+ */
+#define CMD_IMAGE_START 0x06
+/*
+ * Leave the application for this receiver: an application with SRV/AGENT
+ * answers, then resets through the boot mailbox (SRV/BOOTMBX) and the
+ * bootloader starts the receiver without its menu. The receiver itself
+ * just answers, the sender can always send it before CMD_IMAGE_START.
+ */
+#define CMD_ENTER_UPDATE 0x07
+/*
+ * Read the error state of the receiver's CAN controller, answered with
+ * TEC, REC, the ESR flags EWGF, EPVF and BOFF (bits 0 to 2), the number
+ * of error passive and of bus-off entries (saturated at 255), then TEC
+ * and REC at the last error passive entry.
+ */
+#define CMD_READ_LINK 0x08
+
+/*Start address for the "SENDER" application after the bootloader. */
+#define RECEIVER_APPLICATION_START_ADDRESS (0x8006400UL)
+
+/*Start address for new firmware after a reserved portion for Application 2. Slot A of SRV/BOOTCTL */
+#define NEW_FIRMWARE_START_ADDRESS (0x800dc00UL)
+#define NEW_FIRMWARE_END_ADDRESS  (0x8020000UL)
+/* Size of each firmware slot, the largest image or benchmark session */
+#define NEW_FIRMWARE_SLOT_SIZE  (30UL * 1024UL)
+/* Slot B, an update goes to the slot that is not running, see SRV/BOOTCTL */
+#define NEW_FIRMWARE_SLOT_B_ADDRESS (0x8015400UL)
+
+#endif /* PROTOCOL_H_ */
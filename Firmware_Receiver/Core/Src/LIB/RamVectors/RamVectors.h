@@ -0,0 +1,133 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: RamVectors.h
+ * 	Created on: Oct 19, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * SRAM vector table option of the images with CAN interrupts, the
+ * receiver and the application with its update agent. The projects
+ * include it through the Firmware_Receiver/Core/Src include path, like
+ * LIB/Protocol, so both are built the same way.
+ *
+ * In the SRAM build the CAN RX0 interrupt does not go through
+ * HAL_CAN_IRQHandler: it copies the frame of FIFO 0 into a RAM_RxQueue_t
+ * and pends PendSV, which runs at the lowest priority and hands the frame
+ * to the protocol from flash. SysTick, at the same priority as RX0, only
+ * waits for the register copy.
+ */
+#ifndef RAMVECTORS_H_
+#define RAMVECTORS_H_
+
+/*
+ * 1 : the startup code copies the vector table to the SRAM (.ram_vector) and
+ *     points VTOR at the copy, the hot ISRs (CAN RX0 and SysTick with
+ *     HAL_IncTick) are linked into .RamFunc and run from the SRAM as well.
+ *     Taking them costs no flash access, whatever the wait states of the flash.
+ *     The frames are processed in PendSV, see below.
+ * 0 : vector table and ISRs in flash.
+ */
+#define RAM_VECTORS_ENABLE 0
+
+#if RAM_VECTORS_ENABLE == 1
+#define RAM_ISR __attribute__((section(".RamFunc")))
+#else
+#define RAM_ISR
+#endif
+
+#if (RAM_VECTORS_ENABLE == 1) && defined(HAL_CAN_MODULE_ENABLED)
+
+/* Frames held between the RX0 interrupt and PendSV, a power of two above the 3 of FIFO 0 */
+#define RAM_RX_QUEUE_SIZE   4U
+
+typedef struct
+{
+	CAN_RxHeaderTypeDef Header;
+	uint8_t Data[8];
+} RAM_RxFrame_t;
+
+typedef struct
+{
+	RAM_RxFrame_t Frame[RAM_RX_QUEUE_SIZE];
+	volatile uint8_t Head;      /* Written at the priority of the CAN interrupts */
+	volatile uint8_t Tail;      /* Written by PendSV */
+	volatile uint8_t Lost;      /* Frames released on a full queue, the sender retransmits them */
+} RAM_RxQueue_t;
+
+/**
+ * @brief Copy the frame at the output of FIFO 0 of CAN1 into Queue and pend PendSV.
+ *
+ * @details Does what HAL_CAN_IRQHandler and HAL_CAN_GetRxMessage do for a
+ * pending frame, one frame per call: the interrupt is taken again while
+ * FIFO 0 holds more. Inlined so that a RAM_ISR caller makes no flash access.
+ *
+ * @param Queue Queue the frame goes to, only written at one priority.
+ * @return None
+ */
+static inline __attribute__((always_inline)) void RAM_CanRxFifo0(RAM_RxQueue_t *Queue)
+{
+	RAM_RxFrame_t *Frame;
+	uint32_t Rir;
+	uint32_t Rdtr;
+	uint32_t Low;
+	uint32_t High;
+
+	if ((CAN1->RF0R & CAN_RF0R_FMP0) == 0U)
+	{
+		return;
+	}
+	if ((uint8_t)(Queue->Head - Queue->Tail) < RAM_RX_QUEUE_SIZE)
+	{
+		Frame = &Queue->Frame[Queue->Head & (RAM_RX_QUEUE_SIZE - 1U)];
+		Rir = CAN1->sFIFOMailBox[0].RIR;
+		Rdtr = CAN1->sFIFOMailBox[0].RDTR;
+		Low = CAN1->sFIFOMailBox[0].RDLR;
+		High = CAN1->sFIFOMailBox[0].RDHR;
+		Frame->Header.IDE = Rir & CAN_RI0R_IDE;
+		Frame->Header.StdId = (Rir & CAN_RI0R_STID) >> CAN_RI0R_STID_Pos;
+		Frame->Header.ExtId = (Rir & (CAN_RI0R_EXID | CAN_RI0R_STID)) >> CAN_RI0R_EXID_Pos;
+		Frame->Header.RTR = Rir & CAN_RI0R_RTR;
+		Frame->Header.DLC = Rdtr & CAN_RDT0R_DLC;
+		Frame->Header.FilterMatchIndex = (Rdtr & CAN_RDT0R_FMI) >> CAN_RDT0R_FMI_Pos;
+		Frame->Header.Timestamp = (Rdtr & CAN_RDT0R_TIME) >> CAN_RDT0R_TIME_Pos;
+		Frame->Data[0] = (uint8_t)Low;
+		Frame->Data[1] = (uint8_t)(Low >> 8);
+		Frame->Data[2] = (uint8_t)(Low >> 16);
+		Frame->Data[3] = (uint8_t)(Low >> 24);
+		Frame->Data[4] = (uint8_t)High;
+		Frame->Data[5] = (uint8_t)(High >> 8);
+		Frame->Data[6] = (uint8_t)(High >> 16);
+		Frame->Data[7] = (uint8_t)(High >> 24);
+		Queue->Head++;
+		SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+	}
+	else
+	{
+		Queue->Lost++;
+	}
+	CAN1->RF0R = CAN_RF0R_RFOM0;
+}
+
+/**
+ * @brief Hand the queued frames to Indication, oldest first, from PendSV_Handler.
+ *
+ * @param Queue Queue filled by RAM_CanRxFifo0.
+ * @param Indication Receiver of the frames, the protocol entry of the image.
+ * @return None
+ */
+static inline void RAM_CanRxDrain(RAM_RxQueue_t *Queue,
+		void (*Indication)(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data))
+{
+	RAM_RxFrame_t *Frame;
+
+	while (Queue->Tail != Queue->Head)
+	{
+		Frame = &Queue->Frame[Queue->Tail & (RAM_RX_QUEUE_SIZE - 1U)];
+		Indication(&Frame->Header, Frame->Data);
+		Queue->Tail++;
+	}
+}
+
+#endif /* RAM_VECTORS_ENABLE && HAL_CAN_MODULE_ENABLED */
+
+#endif /* RAMVECTORS_H_ */
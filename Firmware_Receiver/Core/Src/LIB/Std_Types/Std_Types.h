@@ -20,14 +20,14 @@ typedef unsigned char boolean;
 #define LOGIC_LOW         (0u)
 
 #define NULL_PTR    ((void*)0)
+#ifndef NULL
 #define NULL 0
-typedef unsigned char         uint8_t;          /*           0 .. 255              */
+#endif
+/* Unsigned types come from the toolchain, they are also used by the HAL */
+#include <stdint.h>
 typedef signed char           sint8_t;          /*        -128 .. +127             */
-typedef unsigned short        uint16_t;         /*           0 .. 65535            */
 typedef signed short          sint16_t;         /*      -32768 .. +32767           */
-typedef unsigned long         uint32_t;         /*           0 .. 4294967295       */
 typedef signed long           sint32_t;         /* -2147483648 .. +2147483647      */
-typedef unsigned long long    uint64_t;         /*       0 .. 18446744073709551615  */
 typedef signed long long      sint64_t;         /* -9223372036854775808 .. 9223372036854775807 */
 typedef float                 float32_t;
 typedef double                float64_t;
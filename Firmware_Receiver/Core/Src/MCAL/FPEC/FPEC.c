@@ -5,7 +5,7 @@
  *================================================================*/
 #include "FPEC.h"
 #include "FPEC_Cfg.h"
-#include "FPEC_private.h"
+#include "FPEC_Private.h"
 
 /**
  * @brief Initialize the Flash Program and Erase Controller (FPEC).
@@ -142,7 +142,7 @@ void MCAL_FPEC_FlashWrite(uint32_t Address, uint16_t *Data, uint32_t Length)
 	{	/*Set the PG bit in the FLASH_CR register to write on the flash.*/
 		SET_BIT(FPEC->FLASH_CR, PG);
 		/*Half word write operation.*/
-		*((volatile uint16_t *)(Address)) = Data[Counter];
+		FPEC_HALF_WORD(Address) = Data[Counter];
 		/* Waiting until the write operation is end */
 		while (GET_BIT(FPEC->FLASH_SR, BSY) == SET);
 
@@ -170,7 +170,7 @@ void MCAL_FPEC_FlashWrite(uint32_t Address, uint16_t *Data, uint32_t Length)
 uint32_t MCAL_FPEC_ReadWord(uint32_t DataAddress)
 {
     uint32_t Data = 0;
-    Data = *((volatile uint32_t*)(DataAddress));
+    Data = *((volatile uint32_t*)(uintptr_t)(DataAddress));
     return Data;
 }
 
@@ -22,8 +22,17 @@ typedef struct
 	volatile uint32_t FLASH_WRPR;
 }FPEC_t;
 
+#ifdef SIMULATION
+/*Register and flash models of the host simulation build*/
+#include "SIM_Fpec.h"
+#define FPEC			SIM_FPEC_Access()
+#define FPEC_HALF_WORD(Address)	(*SIM_FPEC_HalfWord(Address))
+#else
 /*FPEC Base Address*/
 #define FPEC			((volatile FPEC_t*)0x40022000)
+/*Flash half-word written in programming mode*/
+#define FPEC_HALF_WORD(Address)	(*((volatile uint16_t *)(Address)))
+#endif
 
 
 #endif
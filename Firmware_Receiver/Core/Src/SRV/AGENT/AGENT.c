@@ -0,0 +1,139 @@
+/*================================================================
+ * 	File Name: AGENT.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "main.h"
+#include "AGENT.h"
+#include "AGENT_Cfg.h"
+#include "../UPDATER/UPDATER.h"
+#include "../BOOTCTL/BOOTCTL.h"
+#include "../BOOTMBX/BOOTMBX.h"
+#include "../BOOTAPI/BOOTAPI.h"
+#include "../../MCAL/FPEC/FPEC.h"
+
+static CAN_HandleTypeDef *AgentCan;
+static const SRV_BOOTAPI_Table_t *BootApi;         /* Service table of the bootloader, NULL_PTR without one */
+static volatile uint8_t Status = AGENT_IDLE;
+static volatile uint8_t LeaveRequested = FALSE;     /* CMD_ENTER_UPDATE received */
+static volatile uint32_t LeaveTick;                 /* HAL_GetTick when it was received */
+
+void SRV_AGENT_Init(CAN_HandleTypeDef *Can, uint32_t RunningAddress)
+{
+	CAN_FilterTypeDef FilterConfig;
+
+	AgentCan = Can;
+	BootApi = SRV_BOOTAPI_Get(BOOTAPI_VERSION);
+	if (BootApi != NULL_PTR)
+	{
+		BootApi->FlashUnlock();
+	}
+	else
+	{
+		MCAL_FPEC_Init();
+	}
+	SRV_UPDATER_Init(Can);
+	SRV_UPDATER_SetBudget(AGENT_PROGRAM_BUDGET);
+	/* Whatever the boot control log says, the image running is never the target */
+	SRV_BOOTCTL_SetRunning((RunningAddress == NEW_FIRMWARE_SLOT_B_ADDRESS) ? BOOTCTL_SLOT_B : BOOTCTL_SLOT_A);
+	Status = AGENT_IDLE;
+	LeaveRequested = FALSE;
+
+	/* Data frames of both sequence bits, then the commands, as in the standalone receiver */
+	FilterConfig.FilterActivation = ENABLE;
+	FilterConfig.FilterFIFOAssignment = CAN_FILTER_FIFO0;
+	FilterConfig.FilterBank = AGENT_FILTER_BANK;
+	FilterConfig.FilterMode = CAN_FILTERMODE_IDMASK;
+	FilterConfig.FilterScale = CAN_FILTERSCALE_32BIT;
+	FilterConfig.FilterIdHigh = (DATA_FRAME_ID << 5);
+	FilterConfig.FilterIdLow = 0x0000;
+	FilterConfig.FilterMaskIdHigh = ((0x7FF & ~DATA_FRAME_SEQ_MASK) << 5);
+	FilterConfig.FilterMaskIdLow = 0x0000;
+	if (HAL_CAN_ConfigFilter(Can, &FilterConfig) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	FilterConfig.FilterBank = AGENT_FILTER_BANK + 1U;
+	FilterConfig.FilterIdHigh = (CMD_FRAME_ID << 5);
+	FilterConfig.FilterMaskIdHigh = (0x7FF << 5);
+	if (HAL_CAN_ConfigFilter(Can, &FilterConfig) != HAL_OK)
+	{
+		Error_Handler();
+	}
+}
+
+uint8_t SRV_AGENT_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data)
+{
+	uint8_t Update;
+
+	Update = (Header->IDE == CAN_ID_STD) &&
+	         (((Header->StdId & ~DATA_FRAME_SEQ_MASK) == (DATA_FRAME_ID & ~DATA_FRAME_SEQ_MASK)) ||
+	          (Header->StdId == CMD_FRAME_ID));
+	if (Update && (Status != AGENT_READY))
+	{
+		/* The updater answers it, the application leaves on its next call */
+		if ((Header->StdId == CMD_FRAME_ID) && (Header->DLC >= 1U) && (Data[0] == CMD_ENTER_UPDATE) && !LeaveRequested)
+		{
+			LeaveTick = HAL_GetTick();
+			LeaveRequested = TRUE;
+		}
+		SRV_UPDATER_RxIndication(Header, Data);
+	}
+	return Update ? TRUE : FALSE;
+}
+
+uint8_t SRV_AGENT_MainFunction(void)
+{
+	uint32_t Frames;
+	uint32_t Total;
+
+	if (LeaveRequested && (Status != AGENT_READY))
+	{
+		Status = AGENT_LEAVE;
+	}
+	else if (Status != AGENT_READY)
+	{
+		if (SRV_UPDATER_MainFunction() == TRUE)
+		{
+			Status = AGENT_READY;
+		}
+		else
+		{
+			Status = SRV_UPDATER_GetProgress(&Frames, &Total) ? AGENT_RECEIVING : AGENT_IDLE;
+		}
+	}
+	return Status;
+}
+
+void SRV_AGENT_EnterUpdater(void)
+{
+	/* The answer goes out first, the next call checks again */
+	if ((HAL_CAN_GetTxMailboxesFreeLevel(AgentCan) < 3U) && ((HAL_GetTick() - LeaveTick) < AGENT_LEAVE_TIMEOUT_MS))
+	{
+		return;
+	}
+	(void)HAL_CAN_AbortTxRequest(AgentCan, CAN_TX_MAILBOX0 | CAN_TX_MAILBOX1 | CAN_TX_MAILBOX2);
+	if (BootApi != NULL_PTR)
+	{
+		BootApi->Request(BOOTMBX_CMD_UPDATE);
+	}
+	else
+	{
+		SRV_BOOTMBX_Request(BOOTMBX_CMD_UPDATE);
+	}
+}
+
+uint8_t SRV_AGENT_GetProgress(void)
+{
+	uint32_t Frames;
+	uint32_t Total;
+
+	if (Status == AGENT_READY)
+	{
+		return 100U;
+	}
+	if (!SRV_UPDATER_GetProgress(&Frames, &Total) || (Total == 0U))
+	{
+		return 0U;
+	}
+	return (uint8_t)((Frames * 100U) / Total);
+}
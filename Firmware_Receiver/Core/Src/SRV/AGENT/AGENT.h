@@ -0,0 +1,101 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: AGENT.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Update agent for an application that takes its own updates, the
+ * protocol of SRV/UPDATER without the standalone receiver.
+ *
+ * The application links the SRV and MCAL modules of Firmware_Receiver,
+ * hands the frames of its CAN receive callback to SRV_AGENT_RxIndication
+ * and calls SRV_AGENT_MainFunction from its main loop or from a low
+ * priority interrupt. The image is programmed into the slot the
+ * application does not run from (SRV/BOOTCTL), while it keeps running:
+ *   - a frame costs its decoding in the receive interrupt,
+ *   - a call of the main function erases one page, or programs up to
+ *     AGENT_PROGRAM_BUDGET half-words, or checks one page of the image.
+ * The erase is the longest step, the CPU stalls on the flash bank for
+ * the 20 to 40ms it takes. The held back ACK of a page slows the sender
+ * down to the pace of the calls.
+ *
+ * Once the image is checked the new slot is recorded as active and the
+ * agent reports AGENT_READY: the application resets when it suits it and
+ * the bootloader starts the new image. Frames of the update are ignored
+ * from then on, the slot running now would be the next target.
+ *
+ * A sender may also ask for the standalone receiver with CMD_ENTER_UPDATE.
+ * The agent answers and reports AGENT_LEAVE, the application then calls
+ * SRV_AGENT_EnterUpdater, which resets into the receiver through the boot
+ * mailbox (SRV/BOOTMBX).
+ *
+ * The flash unlock and the mailbox request go through the service table
+ * of the bootloader (SRV/BOOTAPI) when it has one, through the modules
+ * linked into the application otherwise.
+ */
+#ifndef AGENT_H_
+#define AGENT_H_
+
+#include "main.h"
+
+#define AGENT_IDLE          0U   /**< No update in progress */
+#define AGENT_RECEIVING     1U   /**< An image session is open */
+#define AGENT_READY         2U   /**< The new image is active, it starts after the next reset */
+#define AGENT_LEAVE         3U   /**< The sender asked for the standalone receiver, see SRV_AGENT_EnterUpdater */
+
+/**
+ * @brief Initialize the agent and the filters of the update frames.
+ *
+ * @details To be called before HAL_CAN_Start, the application activates
+ * the receive notification and forwards the frames.
+ *
+ * @param Can Handle of the CAN peripheral of the update.
+ * @param RunningAddress Vector table of the application in flash (g_pfnVectors), the slot it runs from.
+ * @return None
+ */
+void SRV_AGENT_Init(CAN_HandleTypeDef *Can, uint32_t RunningAddress);
+
+/**
+ * @brief Process one received CAN frame if it belongs to the update.
+ *
+ * @details To be called from HAL_CAN_RxFifo0MsgPendingCallback.
+ *
+ * @param Header Header of the received frame.
+ * @param Data Payload of the received frame.
+ * @return uint8_t TRUE for a data or command frame of the update, FALSE for the application's own frames.
+ */
+uint8_t SRV_AGENT_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data);
+
+/**
+ * @brief Do one bounded step of the update.
+ *
+ * @details To be called cyclically, see the file description for the cost of a call.
+ *
+ * @param None
+ * @return uint8_t AGENT_IDLE, AGENT_RECEIVING, AGENT_READY or AGENT_LEAVE.
+ */
+uint8_t SRV_AGENT_MainFunction(void);
+
+/**
+ * @brief Reset into Firmware_Receiver, without the menu of the bootloader.
+ *
+ * @details Returns at once while frames are still in the transmit
+ * mailboxes, the answer to CMD_ENTER_UPDATE among them, to be called again
+ * on the next AGENT_LEAVE. After AGENT_LEAVE_TIMEOUT_MS they are aborted
+ * and the reset happens anyway, then it never returns.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_AGENT_EnterUpdater(void);
+
+/**
+ * @brief Get the progress of the update.
+ *
+ * @param None
+ * @return uint8_t Percentage of the frames received, 100 once AGENT_READY.
+ */
+uint8_t SRV_AGENT_GetProgress(void);
+
+#endif /* AGENT_H_ */
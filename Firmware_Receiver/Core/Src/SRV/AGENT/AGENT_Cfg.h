@@ -0,0 +1,30 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: AGENT_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef AGENT_CFG_H_
+#define AGENT_CFG_H_
+
+/*
+ * Half-words programmed per call of SRV_AGENT_MainFunction, 52.5us each.
+ * 32 keep a call below 2ms, a page then takes 16 calls after its erase.
+ */
+#define AGENT_PROGRAM_BUDGET    32U
+
+/*
+ * First of the two filter banks taking the frames of the update, the data
+ * frames (both sequence bits) and the commands. The application keeps the
+ * other banks for its own traffic.
+ */
+#define AGENT_FILTER_BANK       0U
+
+/*
+ * Milliseconds SRV_AGENT_EnterUpdater leaves the answer to CMD_ENTER_UPDATE
+ * to go out. Without a sender on the bus, or bus-off, the automatic
+ * retransmission would keep it queued, it is aborted then.
+ */
+#define AGENT_LEAVE_TIMEOUT_MS  20U
+
+#endif /* AGENT_CFG_H_ */
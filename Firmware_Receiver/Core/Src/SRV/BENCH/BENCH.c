@@ -0,0 +1,72 @@
+/*================================================================
+ * 	File Name: BENCH.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "BENCH.h"
+
+static uint32_t Frames = 0;
+static uint32_t FrameCycles = 0;
+static uint32_t Pages = 0;
+static uint32_t PageCycles = 0;
+
+void SRV_BENCH_Init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void SRV_BENCH_Start(void)
+{
+	Frames = 0;
+	FrameCycles = 0;
+	Pages = 0;
+	PageCycles = 0;
+}
+
+uint32_t SRV_BENCH_Now(void)
+{
+	return DWT->CYCCNT;
+}
+
+void SRV_BENCH_FrameDone(uint32_t Cycles)
+{
+	Frames++;
+	FrameCycles += Cycles;
+}
+
+void SRV_BENCH_PageDone(uint32_t Cycles)
+{
+	Pages++;
+	PageCycles += Cycles;
+}
+
+uint8_t SRV_BENCH_Read(uint8_t Index, uint8_t *Response)
+{
+	uint32_t Value;
+
+	switch (Index)
+	{
+	case BENCH_RESULT_FRAMES:
+		Value = Frames;
+		break;
+	case BENCH_RESULT_ISR_CYCLES:
+		Value = (Frames != 0U) ? (FrameCycles / Frames) : 0U;
+		break;
+	case BENCH_RESULT_FLASH_CYCLES:
+		Value = (Pages != 0U) ? (PageCycles / Pages) : 0U;
+		break;
+	case BENCH_RESULT_PAGES:
+		Value = Pages;
+		break;
+	default:
+		return 0;
+	}
+
+	Response[0] = CMD_BENCH_RESULT | RESP_POSITIVE;
+	Response[1] = Index;
+	Response[2] = (uint8_t)(Value);
+	Response[3] = (uint8_t)(Value >> 8);
+	Response[4] = (uint8_t)(Value >> 16);
+	Response[5] = (uint8_t)(Value >> 24);
+	return 6;
+}
@@ -0,0 +1,75 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: BENCH.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Receiver side measurements of the throughput benchmark.
+ *
+ * A benchmark session is started by the sender with CMD_BENCH_START
+ * and streams a synthetic payload through the normal receive and flash
+ * path. The cost of each stored frame and of each programmed page is
+ * measured with the DWT cycle counter and read back with CMD_BENCH_RESULT.
+ */
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include "main.h"
+
+/* CMD_BENCH_RESULT indexes, every result is a uint32_t */
+#define BENCH_RESULT_FRAMES             0U  /* Data frames stored */
+#define BENCH_RESULT_ISR_CYCLES         1U  /* Average cycles to handle one data frame */
+#define BENCH_RESULT_FLASH_CYCLES       2U  /* Average cycles to erase and program one page */
+#define BENCH_RESULT_PAGES              3U  /* Pages programmed */
+
+/**
+ * @brief Enable the DWT cycle counter.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_BENCH_Init(void);
+
+/**
+ * @brief Clear the measurements of the previous session.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_BENCH_Start(void);
+
+/**
+ * @brief Get the current cycle count.
+ *
+ * @param None
+ * @return uint32_t DWT cycle counter.
+ */
+uint32_t SRV_BENCH_Now(void);
+
+/**
+ * @brief Account the cycles spent on one stored data frame.
+ *
+ * @param Cycles Cycles measured with SRV_BENCH_Now.
+ * @return None
+ */
+void SRV_BENCH_FrameDone(uint32_t Cycles);
+
+/**
+ * @brief Account the cycles spent on erasing and programming one page.
+ *
+ * @param Cycles Cycles measured with SRV_BENCH_Now.
+ * @return None
+ */
+void SRV_BENCH_PageDone(uint32_t Cycles);
+
+/**
+ * @brief Build the answer of a CMD_BENCH_RESULT command.
+ *
+ * @param Index One of the BENCH_RESULT_* indexes.
+ * @param Response Buffer of 8 bytes receiving [code, index, uint32_t value].
+ * @return uint8_t Length of the answer, 0 if the index is invalid.
+ */
+uint8_t SRV_BENCH_Read(uint8_t Index, uint8_t *Response);
+
+#endif /* BENCH_H_ */
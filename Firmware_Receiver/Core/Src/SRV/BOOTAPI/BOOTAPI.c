@@ -0,0 +1,89 @@
+/*================================================================
+ * 	File Name: BOOTAPI.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "main.h"
+#include "BOOTAPI.h"
+#include "BOOTAPI_Cfg.h"
+
+#ifdef BOOTAPI_PROVIDER
+#include "../../MCAL/FPEC/FPEC.h"
+#include "../CRC/CRC.h"
+#include "../BOOTMBX/BOOTMBX.h"
+
+/* Built into the bootloader only, kept by the linker script whether it is referenced or not */
+const SRV_BOOTAPI_Table_t SRV_BOOTAPI_Table __attribute__((section(".boot_api"), used)) =
+{
+	BOOTAPI_MAGIC,
+	BOOTAPI_VERSION,
+	MCAL_FPEC_Init,
+	MCAL_FPEC_EraseFlashArea,
+	MCAL_FPEC_FlashWrite,
+	SRV_CRC_Update,
+	SRV_BOOTAPI_CanSend,
+	SRV_BOOTAPI_CanReceive,
+	SelectSlot,
+	SRV_BOOTMBX_Request
+};
+#endif
+
+const SRV_BOOTAPI_Table_t *SRV_BOOTAPI_Get(uint32_t MinVersion)
+{
+	const SRV_BOOTAPI_Table_t *Table = (const SRV_BOOTAPI_Table_t *)BOOTAPI_ADDRESS;
+
+	if ((Table->Magic != BOOTAPI_MAGIC) || (Table->Version < MinVersion))
+	{
+		return NULL_PTR;
+	}
+	return Table;
+}
+
+uint8_t SRV_BOOTAPI_CanSend(uint32_t Id, const uint8_t *Data, uint8_t Length)
+{
+	uint32_t Words[2] = {0, 0};
+	uint32_t Mailbox;
+	uint8_t Index;
+
+	/* A classic frame holds 8 bytes, the DLC field of TDTR 4 bits */
+	if ((Length > 8U) || ((CAN1->TSR & CAN_TSR_TME) == 0U))
+	{
+		return FALSE;
+	}
+	/* Bytes in the order of the data registers, byte 0 in the low byte of TDLR */
+	for (Index = 0; Index < Length; Index++)
+	{
+		Words[Index / 4U] |= (uint32_t)Data[Index] << (8U * (Index % 4U));
+	}
+	Mailbox = (CAN1->TSR & CAN_TSR_CODE) >> CAN_TSR_CODE_Pos;
+	CAN1->sTxMailBox[Mailbox].TDTR = (uint32_t)Length & CAN_TDT0R_DLC;
+	CAN1->sTxMailBox[Mailbox].TDLR = Words[0];
+	CAN1->sTxMailBox[Mailbox].TDHR = Words[1];
+	CAN1->sTxMailBox[Mailbox].TIR = (Id << CAN_TI0R_STID_Pos) | CAN_TI0R_TXRQ;
+	return TRUE;
+}
+
+uint8_t SRV_BOOTAPI_CanReceive(uint32_t *Id, uint8_t *Data, uint8_t *Length)
+{
+	uint32_t Words[2];
+	uint8_t Index;
+
+	if ((CAN1->RF0R & CAN_RF0R_FMP0) == 0U)
+	{
+		return FALSE;
+	}
+	*Id = (CAN1->sFIFOMailBox[0].RIR & CAN_RI0R_STID) >> CAN_RI0R_STID_Pos;
+	*Length = (uint8_t)(CAN1->sFIFOMailBox[0].RDTR & CAN_RDT0R_DLC);
+	if (*Length > 8U)
+	{
+		*Length = 8U;
+	}
+	Words[0] = CAN1->sFIFOMailBox[0].RDLR;
+	Words[1] = CAN1->sFIFOMailBox[0].RDHR;
+	for (Index = 0; Index < *Length; Index++)
+	{
+		Data[Index] = (uint8_t)(Words[Index / 4U] >> (8U * (Index % 4U)));
+	}
+	/* Release the output mailbox, the next frame moves up */
+	CAN1->RF0R = CAN_RF0R_RFOM0;
+	return TRUE;
+}
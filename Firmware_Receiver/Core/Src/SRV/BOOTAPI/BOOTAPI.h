@@ -0,0 +1,75 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: BOOTAPI.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Service table of Custom_Bootloader, the drivers it already holds
+ * made callable from the applications.
+ *
+ * The bootloader places one SRV_BOOTAPI_Table_t at a fixed address
+ * (BOOTAPI_ADDRESS). An application finds it with SRV_BOOTAPI_Get and
+ * calls through it instead of linking its own flash, CRC or CAN code.
+ *
+ * Versioning: entries are only ever appended, each addition raises
+ * BOOTAPI_VERSION. A caller asks for the version that has the entries
+ * it uses and gets NULL_PTR from an older bootloader, or from one without
+ * a table, and falls back to its own copy.
+ *
+ * Every service is stateless: it runs on the stack and the RAM of the
+ * caller, the bootloader's .data and .bss do not exist once the
+ * application runs. The CAN services poll CAN1 (standard identifiers,
+ * FIFO 0) after the caller configured the controller and its filters.
+ */
+#ifndef BOOTAPI_H_
+#define BOOTAPI_H_
+
+#include "../../LIB/Std_Types/Std_Types.h"
+
+#define BOOTAPI_VERSION         1UL
+
+typedef struct
+{
+	uint32_t Magic;                                                         /**< BOOTAPI_MAGIC */
+	uint32_t Version;                                                       /**< BOOTAPI_VERSION of the bootloader */
+	void (*FlashUnlock)(void);                                              /**< MCAL_FPEC_Init */
+	uint8_t (*FlashErase)(uint32_t StartPageAddress, uint32_t EndPageAddress); /**< MCAL_FPEC_EraseFlashArea */
+	void (*FlashWrite)(uint32_t Address, uint16_t *Data, uint32_t Length);  /**< MCAL_FPEC_FlashWrite, half-words */
+	uint32_t (*Crc)(uint32_t Crc, const uint8_t *Data, uint32_t Length);    /**< SRV_CRC_Update */
+	uint8_t (*CanSend)(uint32_t Id, const uint8_t *Data, uint8_t Length);   /**< SRV_BOOTAPI_CanSend */
+	uint8_t (*CanReceive)(uint32_t *Id, uint8_t *Data, uint8_t *Length);    /**< SRV_BOOTAPI_CanReceive */
+	uint32_t (*ActiveSlot)(void);                                           /**< Address of the slot the bootloader starts, 0 if none */
+	void (*Request)(uint32_t Command);                                      /**< SRV_BOOTMBX_Request */
+} SRV_BOOTAPI_Table_t;
+
+/**
+ * @brief Find the service table of the bootloader.
+ *
+ * @param MinVersion Version that has all the entries the caller uses.
+ * @return const SRV_BOOTAPI_Table_t* The table, NULL_PTR if the bootloader has
+ *         none or an older one.
+ */
+const SRV_BOOTAPI_Table_t *SRV_BOOTAPI_Get(uint32_t MinVersion);
+
+/**
+ * @brief Queue a data frame in a free transmit mailbox of CAN1.
+ *
+ * @param Id Standard identifier.
+ * @param Data Bytes of the frame.
+ * @param Length Number of bytes, 0 to 8.
+ * @return uint8_t TRUE if queued, FALSE if Length is above 8 or the three mailboxes are busy.
+ */
+uint8_t SRV_BOOTAPI_CanSend(uint32_t Id, const uint8_t *Data, uint8_t Length);
+
+/**
+ * @brief Take the oldest frame of FIFO 0 of CAN1.
+ *
+ * @param Id Receives the standard identifier.
+ * @param Data Receives the bytes, room for 8.
+ * @param Length Receives the number of bytes.
+ * @return uint8_t TRUE if a frame was taken, FALSE if the FIFO is empty.
+ */
+uint8_t SRV_BOOTAPI_CanReceive(uint32_t *Id, uint8_t *Data, uint8_t *Length);
+
+#endif /* BOOTAPI_H_ */
@@ -0,0 +1,24 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: BOOTAPI_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef BOOTAPI_CFG_H_
+#define BOOTAPI_CFG_H_
+
+/*
+ * BOOTAPI_ADDRESS : Address of the service table in the bootloader, the
+ *                   .boot_api section of Custom_Bootloader's linker
+ *                   script. Past the vector table, fixed for every
+ *                   bootloader version.
+ */
+#define BOOTAPI_ADDRESS         0x08000200UL
+
+/*
+ * BOOTAPI_MAGIC : Marks the table ("BAPI"), a bootloader without one has
+ *                 code or erased flash at BOOTAPI_ADDRESS.
+ */
+#define BOOTAPI_MAGIC           0x49504142UL
+
+#endif /* BOOTAPI_CFG_H_ */
@@ -0,0 +1,180 @@
+/*================================================================
+ * 	File Name: BOOTCTL.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "main.h"
+#include "BOOTCTL.h"
+#include "BOOTCTL_Cfg.h"
+#include "../../MCAL/FPEC/FPEC.h"
+
+#define BOOTCTL_RECORD_SIZE     8U
+#define BOOTCTL_RECORDS         (FLASH_PAGE_SIZE / BOOTCTL_RECORD_SIZE)
+#define BOOTCTL_ERASED          0xFFFFFFFFUL
+
+/* Initial stack pointers of an image point into the 20KB of SRAM */
+#define BOOTCTL_SRAM_MASK       0xFFFE0000UL
+#define BOOTCTL_SRAM_BASE       0x20000000UL
+
+static uint16_t LastSequence = 0;               /* 0 without a record */
+static uint8_t LastSlot = BOOTCTL_SLOT_A;
+static uint32_t LastPage = BOOTCTL_PAGE_0_ADDRESS;
+static uint32_t NextRecord = BOOTCTL_RECORDS;   /* Free record of LastPage, BOOTCTL_RECORDS if it is full */
+static uint8_t RunningSlot = BOOTCTL_SLOT_NONE; /* Slot of an application updating itself */
+
+/* Word 0 of a record, BOOTCTL_ERASED past the last record, 0 for a torn or foreign one */
+static uint32_t SRV_BOOTCTL_ReadRecord(uint32_t Page, uint32_t Index)
+{
+	uint32_t Word = MCAL_FPEC_ReadWord(Page + (Index * BOOTCTL_RECORD_SIZE));
+	uint32_t Check = MCAL_FPEC_ReadWord(Page + (Index * BOOTCTL_RECORD_SIZE) + ONE_WORD_SIZE);
+
+	if ((Word == BOOTCTL_ERASED) && (Check == BOOTCTL_ERASED))
+	{
+		return BOOTCTL_ERASED;
+	}
+	if ((Check != ~Word) || ((uint16_t)Word == 0U) || ((Word >> 16) > BOOTCTL_SLOT_B))
+	{
+		return 0U;
+	}
+	return Word;
+}
+
+static void SRV_BOOTCTL_ScanPage(uint32_t Page)
+{
+	uint32_t Index;
+	uint32_t Word;
+
+	for (Index = 0; Index < BOOTCTL_RECORDS; Index++)
+	{
+		Word = SRV_BOOTCTL_ReadRecord(Page, Index);
+		if (Word == BOOTCTL_ERASED)
+		{
+			break;
+		}
+		if ((uint16_t)Word > LastSequence)
+		{
+			LastSequence = (uint16_t)Word;
+			LastSlot = (uint8_t)(Word >> 16);
+			LastPage = Page;
+			NextRecord = BOOTCTL_RECORDS;
+		}
+	}
+	/* Records are only appended behind the last one */
+	if (Page == LastPage)
+	{
+		NextRecord = Index;
+	}
+}
+
+/* The slot itself if it holds an image, else the other one if that does */
+static uint8_t SRV_BOOTCTL_Bootable(uint8_t Slot)
+{
+	if (!SRV_BOOTCTL_HoldsImage(Slot))
+	{
+		Slot = (Slot == BOOTCTL_SLOT_A) ? BOOTCTL_SLOT_B : BOOTCTL_SLOT_A;
+		if (!SRV_BOOTCTL_HoldsImage(Slot))
+		{
+			Slot = BOOTCTL_SLOT_NONE;
+		}
+	}
+	return Slot;
+}
+
+void SRV_BOOTCTL_Init(void)
+{
+	LastSequence = 0;
+	LastSlot = BOOTCTL_SLOT_A;
+	LastPage = BOOTCTL_PAGE_0_ADDRESS;
+	NextRecord = BOOTCTL_RECORDS;
+	RunningSlot = BOOTCTL_SLOT_NONE;
+	SRV_BOOTCTL_ScanPage(BOOTCTL_PAGE_0_ADDRESS);
+	SRV_BOOTCTL_ScanPage(BOOTCTL_PAGE_1_ADDRESS);
+	if (LastSequence == 0U)
+	{
+		/* No record yet, the first one starts page 0 once erased */
+		NextRecord = BOOTCTL_RECORDS;
+		LastPage = BOOTCTL_PAGE_1_ADDRESS;
+	}
+}
+
+uint32_t SRV_BOOTCTL_SlotAddress(uint8_t Slot)
+{
+	return (Slot == BOOTCTL_SLOT_B) ? NEW_FIRMWARE_SLOT_B_ADDRESS : NEW_FIRMWARE_START_ADDRESS;
+}
+
+uint8_t SRV_BOOTCTL_HoldsImage(uint8_t Slot)
+{
+	return ((MCAL_FPEC_ReadWord(SRV_BOOTCTL_SlotAddress(Slot)) & BOOTCTL_SRAM_MASK) == BOOTCTL_SRAM_BASE) ? TRUE : FALSE;
+}
+
+void SRV_BOOTCTL_SetRunning(uint8_t Slot)
+{
+	RunningSlot = Slot;
+}
+
+uint8_t SRV_BOOTCTL_GetActive(void)
+{
+	if (RunningSlot != BOOTCTL_SLOT_NONE)
+	{
+		return RunningSlot;
+	}
+	return SRV_BOOTCTL_Bootable(LastSlot);
+}
+
+uint8_t SRV_BOOTCTL_GetActiveSlot(void)
+{
+	const uint32_t Pages[2] = {BOOTCTL_PAGE_0_ADDRESS, BOOTCTL_PAGE_1_ADDRESS};
+	uint16_t Sequence = 0;
+	uint8_t Slot = BOOTCTL_SLOT_A;
+	uint32_t Index;
+	uint32_t Word;
+	uint8_t Page;
+
+	for (Page = 0; Page < 2U; Page++)
+	{
+		for (Index = 0; Index < BOOTCTL_RECORDS; Index++)
+		{
+			Word = SRV_BOOTCTL_ReadRecord(Pages[Page], Index);
+			if (Word == BOOTCTL_ERASED)
+			{
+				break;
+			}
+			if ((uint16_t)Word > Sequence)
+			{
+				Sequence = (uint16_t)Word;
+				Slot = (uint8_t)(Word >> 16);
+			}
+		}
+	}
+	return SRV_BOOTCTL_Bootable(Slot);
+}
+
+uint8_t SRV_BOOTCTL_IsKnown(void)
+{
+	return ((LastSequence != 0U) || (RunningSlot != BOOTCTL_SLOT_NONE)) ? TRUE : FALSE;
+}
+
+uint8_t SRV_BOOTCTL_GetInactive(void)
+{
+	return (SRV_BOOTCTL_GetActive() == BOOTCTL_SLOT_A) ? BOOTCTL_SLOT_B : BOOTCTL_SLOT_A;
+}
+
+void SRV_BOOTCTL_Activate(uint8_t Slot)
+{
+	uint32_t Record[2];
+	uint32_t Address;
+
+	if (NextRecord >= BOOTCTL_RECORDS)
+	{
+		LastPage = (LastPage == BOOTCTL_PAGE_0_ADDRESS) ? BOOTCTL_PAGE_1_ADDRESS : BOOTCTL_PAGE_0_ADDRESS;
+		MCAL_FPEC_EraseFlashArea(LastPage, LastPage);
+		NextRecord = 0;
+	}
+	LastSequence++;
+	Record[0] = (uint32_t)LastSequence | ((uint32_t)Slot << 16);
+	Record[1] = ~Record[0];
+	Address = LastPage + (NextRecord * BOOTCTL_RECORD_SIZE);
+	/* Half-words in address order, the complement completes the record */
+	MCAL_FPEC_FlashWrite(Address, (uint16_t *)Record, BOOTCTL_RECORD_SIZE / TWO_BYTE);
+	NextRecord++;
+	LastSlot = Slot;
+}
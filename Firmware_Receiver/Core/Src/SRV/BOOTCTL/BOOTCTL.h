@@ -0,0 +1,126 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: BOOTCTL.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Boot control of the two application slots (A at 0x0800DC00, B at
+ * 0x08015400).
+ *
+ * The active slot is the one Custom_Bootloader starts. An update is
+ * always programmed into the other, inactive slot, so the running image
+ * stays intact and bootable until the new one is complete and verified.
+ * Only then is the new slot recorded as active, which switches the slots
+ * on the next reset.
+ *
+ * The selection is a log of 8-byte records in two flash pages:
+ *   half-word 0 : sequence number, counting from 1
+ *   half-word 1 : slot index
+ *   word 1      : complement of word 0, programmed last
+ * The valid record with the highest sequence number wins. A record torn
+ * by a reset has no matching complement and is ignored, so the switch is
+ * atomic. When the page of the last record is full, the next record
+ * starts the other page, erased first, and the last record stays valid
+ * until the new one is complete.
+ *
+ * Without any record the bootloader keeps starting slot A, as before
+ * there was a slot B.
+ */
+#ifndef BOOTCTL_H_
+#define BOOTCTL_H_
+
+#include "../../LIB/Std_Types/Std_Types.h"
+
+#define BOOTCTL_SLOT_A          0U
+#define BOOTCTL_SLOT_B          1U
+#define BOOTCTL_SLOT_NONE       0xFFU   /**< Neither slot holds an image */
+
+/**
+ * @brief Read the boot control log and find the active slot.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_BOOTCTL_Init(void);
+
+/**
+ * @brief Tell the slot the caller runs from, an application updating itself.
+ *
+ * @details That slot is the active one whatever the log says, an update
+ * never goes to it. The log is not changed. SRV_BOOTCTL_Init forgets it.
+ *
+ * @param Slot BOOTCTL_SLOT_A, BOOTCTL_SLOT_B, or BOOTCTL_SLOT_NONE for the standalone receiver.
+ * @return None
+ */
+void SRV_BOOTCTL_SetRunning(uint8_t Slot);
+
+/**
+ * @brief Get the slot the bootloader starts.
+ *
+ * @details The running slot if one was set. Else the slot of the last
+ * record, or slot A without a record, as long as it holds an image.
+ * Otherwise the other slot if that one does.
+ *
+ * @param None
+ * @return uint8_t BOOTCTL_SLOT_A, BOOTCTL_SLOT_B or BOOTCTL_SLOT_NONE.
+ */
+uint8_t SRV_BOOTCTL_GetActive(void);
+
+/**
+ * @brief Read the active slot straight from the log, for the bootloader.
+ *
+ * @details Reads the flash only, nothing is kept in RAM and
+ * SRV_BOOTCTL_Init is not needed. The slot of the last record, or slot A
+ * without a record, as long as it holds an image. Otherwise the other slot
+ * if that one does. The running slot is not taken into account.
+ *
+ * @param None
+ * @return uint8_t BOOTCTL_SLOT_A, BOOTCTL_SLOT_B or BOOTCTL_SLOT_NONE.
+ */
+uint8_t SRV_BOOTCTL_GetActiveSlot(void);
+
+/**
+ * @brief Check whether the active slot is known for sure.
+ *
+ * @details Until an update selected a slot, the slot holding an image may
+ * as well be one programmed at the factory as one cut short by a reset.
+ *
+ * @param None
+ * @return uint8_t TRUE once a record was written or the running slot was set.
+ */
+uint8_t SRV_BOOTCTL_IsKnown(void);
+
+/**
+ * @brief Get the slot an update is programmed into.
+ *
+ * @param None
+ * @return uint8_t The slot that is not active, slot A if none is.
+ */
+uint8_t SRV_BOOTCTL_GetInactive(void);
+
+/**
+ * @brief Get the first address of a slot.
+ *
+ * @param Slot BOOTCTL_SLOT_A or BOOTCTL_SLOT_B.
+ * @return uint32_t Address the images of the slot are linked at.
+ */
+uint32_t SRV_BOOTCTL_SlotAddress(uint8_t Slot);
+
+/**
+ * @brief Check whether a slot starts with a vector table.
+ *
+ * @param Slot BOOTCTL_SLOT_A or BOOTCTL_SLOT_B.
+ * @return uint8_t TRUE if its initial stack pointer points into the SRAM.
+ */
+uint8_t SRV_BOOTCTL_HoldsImage(uint8_t Slot);
+
+/**
+ * @brief Record a slot as active, the bootloader starts it from the next reset on.
+ *
+ * @param Slot Slot holding a verified image.
+ * @return None
+ */
+void SRV_BOOTCTL_Activate(uint8_t Slot);
+
+#endif /* BOOTCTL_H_ */
@@ -0,0 +1,18 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: BOOTCTL_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef BOOTCTL_CFG_H_
+#define BOOTCTL_CFG_H_
+
+/*
+ * BOOTCTL_PAGE_0_ADDRESS, BOOTCTL_PAGE_1_ADDRESS : The two flash pages of the
+ * boot control log, the last two pages of the flash. Custom_Bootloader reads
+ * them at the same addresses.
+ */
+#define BOOTCTL_PAGE_0_ADDRESS  0x0801F800UL
+#define BOOTCTL_PAGE_1_ADDRESS  0x0801FC00UL
+
+#endif /* BOOTCTL_CFG_H_ */
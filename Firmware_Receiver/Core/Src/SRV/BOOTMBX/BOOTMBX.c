@@ -0,0 +1,41 @@
+/*================================================================
+ * 	File Name: BOOTMBX.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "main.h"
+#include "BOOTMBX.h"
+#include "BOOTMBX_Cfg.h"
+
+typedef struct
+{
+	uint32_t Magic;
+	uint32_t Command;
+	uint32_t Check;             /* ~Command */
+	uint32_t Reserved;
+} SRV_BOOTMBX_t;
+
+/* First bytes of the SRAM in every image, see the NOINIT region of the linker scripts */
+static volatile SRV_BOOTMBX_t Mailbox __attribute__((section(".noinit")));
+
+void SRV_BOOTMBX_Request(uint32_t Command)
+{
+	__disable_irq();
+	Mailbox.Command = Command;
+	Mailbox.Check = ~Command;
+	Mailbox.Magic = BOOTMBX_MAGIC;
+	/* The stores reach the SRAM before the reset request */
+	__DSB();
+	NVIC_SystemReset();
+}
+
+uint32_t SRV_BOOTMBX_Take(void)
+{
+	uint32_t Command = BOOTMBX_CMD_NONE;
+
+	if ((Mailbox.Magic == BOOTMBX_MAGIC) && (Mailbox.Check == ~Mailbox.Command))
+	{
+		Command = Mailbox.Command;
+	}
+	Mailbox.Magic = 0;
+	return Command;
+}
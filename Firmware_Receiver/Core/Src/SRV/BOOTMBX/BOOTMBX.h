@@ -0,0 +1,53 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: BOOTMBX.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Boot mailbox, a request from a running image to the bootloader that
+ * survives a warm reset.
+ *
+ * The mailbox is the first 16 bytes of the SRAM, the .noinit section of
+ * the linker scripts of every project: the startup code neither copies
+ * nor clears it, so it keeps its content over NVIC_SystemReset. A power
+ * cycle leaves random values, which the magic and the complement of the
+ * command reject.
+ *
+ * Layout:
+ *   word 0 : BOOTMBX_MAGIC
+ *   word 1 : command
+ *   word 2 : complement of the command
+ *
+ * The bootloader reads the mailbox before anything else and clears it,
+ * so a request is served once and the next reset shows the menu again.
+ */
+#ifndef BOOTMBX_H_
+#define BOOTMBX_H_
+
+#include "../../LIB/Std_Types/Std_Types.h"
+
+#define BOOTMBX_CMD_NONE        0UL  /**< No request, the bootloader shows its menu */
+#define BOOTMBX_CMD_UPDATE      1UL  /**< Start Firmware_Receiver, an update follows */
+#define BOOTMBX_CMD_START       2UL  /**< Start the active slot, an update was just activated */
+
+/**
+ * @brief Leave a request for the bootloader and reset the MCU.
+ *
+ * @details Never returns. Pending transmissions are lost, the caller waits
+ * for its last frame first.
+ *
+ * @param Command BOOTMBX_CMD_UPDATE or BOOTMBX_CMD_START.
+ * @return None
+ */
+void SRV_BOOTMBX_Request(uint32_t Command);
+
+/**
+ * @brief Read and clear the request, what the bootloader does after a reset.
+ *
+ * @param None
+ * @return uint32_t The command left by SRV_BOOTMBX_Request, BOOTMBX_CMD_NONE if none.
+ */
+uint32_t SRV_BOOTMBX_Take(void);
+
+#endif /* BOOTMBX_H_ */
@@ -0,0 +1,18 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: BOOTMBX_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef BOOTMBX_CFG_H_
+#define BOOTMBX_CFG_H_
+
+/*
+ * BOOTMBX_MAGIC : Marks a request written by this module ("BMBX"). The SRAM
+ *                 holds random values after a power-up, the magic and the
+ *                 complement of the command tell a request from them.
+ *                 Custom_Bootloader links this module as well.
+ */
+#define BOOTMBX_MAGIC           0x58424D42UL
+
+#endif /* BOOTMBX_CFG_H_ */
@@ -0,0 +1,25 @@
+/*================================================================
+ * 	File Name: CRC.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "CRC.h"
+
+/* Remainders of the reflected polynomial 0xEDB88320 for every nibble */
+static const uint32_t NibbleTable[16] = {
+	0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+	0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+	0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+	0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+uint32_t SRV_CRC_Update(uint32_t Crc, const uint8_t *Data, uint32_t Length)
+{
+	Crc = ~Crc;
+	while (Length-- > 0U)
+	{
+		Crc ^= *Data++;
+		Crc = (Crc >> 4) ^ NibbleTable[Crc & 0x0FU];
+		Crc = (Crc >> 4) ^ NibbleTable[Crc & 0x0FU];
+	}
+	return ~Crc;
+}
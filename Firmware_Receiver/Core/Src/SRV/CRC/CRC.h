@@ -0,0 +1,30 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: CRC.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * CRC-32 (IEEE 802.3, reflected, the zlib and PNG checksum) computed in
+ * software with a 16 entry table, so it also runs on the host tools and
+ * the simulation, where there is no CRC peripheral.
+ */
+#ifndef CRC_H_
+#define CRC_H_
+
+#include "../../LIB/Std_Types/Std_Types.h"
+
+/* Value to start a new checksum with */
+#define CRC_INITIAL     0UL
+
+/**
+ * @brief Add a block of bytes to a checksum.
+ *
+ * @param Crc CRC_INITIAL, or the checksum of the bytes before Data.
+ * @param Data Bytes to add.
+ * @param Length Number of bytes.
+ * @return uint32_t Checksum of everything added so far.
+ */
+uint32_t SRV_CRC_Update(uint32_t Crc, const uint8_t *Data, uint32_t Length);
+
+#endif /* CRC_H_ */
@@ -0,0 +1,128 @@
+/*================================================================
+ * 	File Name: DELTA.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "DELTA.h"
+
+/* What the next delta byte is */
+#define DELTA_STATE_TAG         0U
+#define DELTA_STATE_LENGTH      1U
+#define DELTA_STATE_OFFSET      2U
+#define DELTA_STATE_INSERT      3U
+
+/* A LEB128 number longer than this does not fit into 32 bits */
+#define DELTA_MAX_SHIFT         28U
+
+static const uint8_t *BaseImage;
+static uint32_t BaseLength;
+static uint8_t State;
+static uint8_t Operation;
+static uint32_t Number;             /* LEB128 number being read */
+static uint8_t Shift;
+static uint32_t Length;             /* Bytes of the current operation not output yet */
+static uint32_t CopyOffset;
+
+void SRV_DELTA_Init(const uint8_t *Base, uint32_t BaseSize)
+{
+	BaseImage = Base;
+	BaseLength = BaseSize;
+	State = DELTA_STATE_TAG;
+	Length = 0;
+	Number = 0;
+	Shift = 0;
+}
+
+/* Add one byte to the LEB128 number, TRUE once it is complete */
+static uint8_t SRV_DELTA_ReadNumber(uint8_t Byte)
+{
+	Number |= (uint32_t)(Byte & 0x7FU) << Shift;
+	Shift += 7U;
+	return ((Byte & 0x80U) == 0U);
+}
+
+uint8_t SRV_DELTA_Apply(const uint8_t *Input, uint32_t *InputLength, uint8_t *Output, uint32_t *OutputLength)
+{
+	uint32_t Read = 0;
+	uint32_t Written = 0;
+	uint8_t Status = DELTA_OK;
+	uint8_t Byte;
+
+	while (Status == DELTA_OK)
+	{
+		/* Output as much of the current copy as fits */
+		if (State == DELTA_STATE_TAG)
+		{
+			while ((Length > 0U) && (Written < *OutputLength))
+			{
+				Output[Written++] = BaseImage[CopyOffset++];
+				Length--;
+			}
+		}
+		if ((Written == *OutputLength) || (Read == *InputLength))
+		{
+			break;
+		}
+
+		Byte = Input[Read++];
+		switch (State)
+		{
+		case DELTA_STATE_TAG:
+			Operation = Byte;
+			Number = 0;
+			Shift = 0;
+			State = DELTA_STATE_LENGTH;
+			if ((Operation != DELTA_OP_COPY) && (Operation != DELTA_OP_INSERT))
+			{
+				Status = DELTA_CORRUPT;
+			}
+			break;
+
+		case DELTA_STATE_LENGTH:
+			if (SRV_DELTA_ReadNumber(Byte))
+			{
+				Length = Number;
+				Number = 0;
+				Shift = 0;
+				State = (Operation == DELTA_OP_COPY) ? DELTA_STATE_OFFSET : DELTA_STATE_INSERT;
+				if (Length == 0U)
+				{
+					Status = DELTA_CORRUPT;
+				}
+			}
+			else if (Shift > DELTA_MAX_SHIFT)
+			{
+				Status = DELTA_CORRUPT;
+			}
+			break;
+
+		case DELTA_STATE_OFFSET:
+			if (SRV_DELTA_ReadNumber(Byte))
+			{
+				CopyOffset = Number;
+				State = DELTA_STATE_TAG;
+				if ((CopyOffset > BaseLength) || (Length > (BaseLength - CopyOffset)))
+				{
+					Status = DELTA_CORRUPT;
+				}
+			}
+			else if (Shift > DELTA_MAX_SHIFT)
+			{
+				Status = DELTA_CORRUPT;
+			}
+			break;
+
+		default:
+			Output[Written++] = Byte;
+			Length--;
+			if (Length == 0U)
+			{
+				State = DELTA_STATE_TAG;
+			}
+			break;
+		}
+	}
+
+	*InputLength = Read;
+	*OutputLength = Written;
+	return Status;
+}
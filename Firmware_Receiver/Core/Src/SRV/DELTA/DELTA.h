@@ -0,0 +1,55 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: DELTA.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Streaming patcher of delta updates.
+ *
+ * A delta rebuilds the new image from the image already in flash (the
+ * base) with two operations, each a tag byte followed by LEB128 numbers
+ * (7 bits per byte, least significant first, bit 7 set on all but the
+ * last byte):
+ *   DELTA_OP_COPY   length, offset : copy length bytes of the base from offset
+ *   DELTA_OP_INSERT length, bytes  : output the length bytes that follow
+ *
+ * Like SRV/LZSS the patcher keeps its whole state between calls, so the
+ * delta can be fed frame by frame and drained into the staging buffer.
+ * The base must stay unchanged until the whole delta is applied.
+ */
+#ifndef DELTA_H_
+#define DELTA_H_
+
+#include "../../LIB/Std_Types/Std_Types.h"
+
+#define DELTA_OP_COPY           0x01U
+#define DELTA_OP_INSERT         0x02U
+
+#define DELTA_OK                1U   /**< Input applied */
+#define DELTA_CORRUPT           0U   /**< Unknown operation or copy outside the base */
+
+/**
+ * @brief Restart the patcher at the beginning of a delta.
+ *
+ * @param Base First byte of the base image, readable memory (flash).
+ * @param BaseSize Size of the base image.
+ * @return None
+ */
+void SRV_DELTA_Init(const uint8_t *Base, uint32_t BaseSize);
+
+/**
+ * @brief Apply delta bytes until the input is consumed or the output is full.
+ *
+ * @details An operation that does not fit into the output is continued by
+ * the next call, which may be given no input at all.
+ *
+ * @param Input Next bytes of the delta.
+ * @param InputLength In: bytes available in Input. Out: bytes consumed.
+ * @param Output Buffer receiving the bytes of the new image.
+ * @param OutputLength In: free space in Output. Out: bytes written.
+ * @return uint8_t DELTA_OK, or DELTA_CORRUPT if the delta is invalid.
+ */
+uint8_t SRV_DELTA_Apply(const uint8_t *Input, uint32_t *InputLength, uint8_t *Output, uint32_t *OutputLength);
+
+#endif /* DELTA_H_ */
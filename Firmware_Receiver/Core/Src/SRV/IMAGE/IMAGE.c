@@ -0,0 +1,64 @@
+/*================================================================
+ * 	File Name: IMAGE.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "IMAGE.h"
+#include "../CRC/CRC.h"
+
+#define IMAGE_WORDS     (IMAGE_HEADER_SIZE / 4U)
+
+uint8_t SRV_IMAGE_Parse(const uint8_t *Bytes, uint32_t SlotAddress, uint32_t SlotSize, SRV_IMAGE_Header_t *Header)
+{
+	uint32_t *Fields = (uint32_t *)Header;
+	uint32_t Encoding;
+	uint8_t i;
+
+	for (i = 0; i < IMAGE_WORDS; i++)
+	{
+		Fields[i] = (uint32_t)Bytes[4U * i] | ((uint32_t)Bytes[4U * i + 1U] << 8) |
+		            ((uint32_t)Bytes[4U * i + 2U] << 16) | ((uint32_t)Bytes[4U * i + 3U] << 24);
+	}
+	if ((Header->Magic != IMAGE_MAGIC) ||
+		(SRV_CRC_Update(CRC_INITIAL, Bytes, IMAGE_HEADER_SIZE - 4U) != Header->HeaderCrc))
+	{
+		return IMAGE_INVALID;
+	}
+
+	/* At most one encoding */
+	Encoding = Header->Flags & (IMAGE_FLAG_LZSS | IMAGE_FLAG_DELTA | IMAGE_FLAG_SPARSE);
+	if ((Header->LoadAddress != SlotAddress) || (Header->Length == 0U) || (Header->Length > SlotSize) ||
+		(Header->StreamSize == 0U) || (Header->StreamSize > SlotSize) ||
+		(Encoding != Header->Flags) || ((Encoding & (Encoding - 1U)) != 0U))
+	{
+		return IMAGE_INVALID;
+	}
+	/* A plain image is sent as it is programmed */
+	if ((Encoding == 0U) && (Header->StreamSize != Header->Length))
+	{
+		return IMAGE_INVALID;
+	}
+	if ((Encoding == IMAGE_FLAG_DELTA) && ((Header->BaseLength == 0U) || (Header->BaseLength > SlotSize)))
+	{
+		return IMAGE_INVALID;
+	}
+	return IMAGE_OK;
+}
+
+void SRV_IMAGE_Build(SRV_IMAGE_Header_t *Header, uint8_t *Bytes)
+{
+	const uint32_t *Fields = (const uint32_t *)Header;
+	uint8_t i;
+
+	Header->Magic = IMAGE_MAGIC;
+	for (i = 0; i < IMAGE_WORDS; i++)
+	{
+		if (i == (IMAGE_WORDS - 1U))
+		{
+			Header->HeaderCrc = SRV_CRC_Update(CRC_INITIAL, Bytes, IMAGE_HEADER_SIZE - 4U);
+		}
+		Bytes[4U * i] = (uint8_t)Fields[i];
+		Bytes[4U * i + 1U] = (uint8_t)(Fields[i] >> 8);
+		Bytes[4U * i + 2U] = (uint8_t)(Fields[i] >> 16);
+		Bytes[4U * i + 3U] = (uint8_t)(Fields[i] >> 24);
+	}
+}
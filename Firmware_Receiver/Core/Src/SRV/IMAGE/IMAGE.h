@@ -0,0 +1,71 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: IMAGE.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Header that describes an image session, sent in the first data frames
+ * after CMD_IMAGE_START. It tells the receiver how large the image is and
+ * how the bytes after the header are encoded, so one receiver build takes
+ * images of any size up to the slot.
+ *
+ * Layout, IMAGE_HEADER_SIZE bytes of little endian uint32_t in the order
+ * of SRV_IMAGE_Header_t. HeaderCrc is the SRV/CRC checksum of the fields
+ * before it.
+ */
+#ifndef IMAGE_H_
+#define IMAGE_H_
+
+#include "../../LIB/Std_Types/Std_Types.h"
+
+#define IMAGE_MAGIC             0x31474D49UL    /* "IMG1" */
+#define IMAGE_HEADER_SIZE       40U
+
+/* The bytes after the header are an SRV/LZSS stream */
+#define IMAGE_FLAG_LZSS         0x00000001UL
+/* The bytes after the header are an SRV/DELTA patch against the image in the slot */
+#define IMAGE_FLAG_DELTA        0x00000002UL
+/* The bytes after the header are an SRV/SPARSE extent list */
+#define IMAGE_FLAG_SPARSE       0x00000004UL
+
+#define IMAGE_OK                1U   /**< Header intact and the image fits the slot */
+#define IMAGE_INVALID           0U   /**< Corrupt header, or an image this receiver cannot take */
+
+typedef struct
+{
+	uint32_t Magic;
+	uint32_t Flags;
+	uint32_t Length;        /* Bytes of the image once programmed */
+	uint32_t LoadAddress;   /* Address of the first byte */
+	uint32_t Version;
+	uint32_t ImageCrc;      /* Checksum of the Length image bytes */
+	uint32_t StreamSize;    /* Bytes after the header, Length unless encoded */
+	uint32_t BaseLength;    /* Delta only: size of the image the patch applies to */
+	uint32_t BaseCrc;       /* Delta only: its checksum */
+	uint32_t HeaderCrc;
+} SRV_IMAGE_Header_t;
+
+/**
+ * @brief Decode a received header and check it against the slot.
+ *
+ * @param Bytes The IMAGE_HEADER_SIZE bytes of the header.
+ * @param SlotAddress Address the image has to be built for.
+ * @param SlotSize Largest image and stream the slot takes.
+ * @param Header Receives the decoded fields.
+ * @return uint8_t IMAGE_OK, or IMAGE_INVALID.
+ */
+uint8_t SRV_IMAGE_Parse(const uint8_t *Bytes, uint32_t SlotAddress, uint32_t SlotSize, SRV_IMAGE_Header_t *Header);
+
+/**
+ * @brief Seal a header and lay it out for sending.
+ *
+ * @details For the tools that make images: Magic and HeaderCrc are filled in.
+ *
+ * @param Header Fields of the header.
+ * @param Bytes Buffer of IMAGE_HEADER_SIZE bytes.
+ * @return None
+ */
+void SRV_IMAGE_Build(SRV_IMAGE_Header_t *Header, uint8_t *Bytes);
+
+#endif /* IMAGE_H_ */
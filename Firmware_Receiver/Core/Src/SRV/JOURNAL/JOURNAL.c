@@ -0,0 +1,76 @@
+/*================================================================
+ * 	File Name: JOURNAL.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "JOURNAL.h"
+#include "JOURNAL_Cfg.h"
+#include "../../MCAL/FPEC/FPEC.h"
+
+#define JOURNAL_HEADER_SIZE     8U
+#define JOURNAL_ENTRY_EMPTY     0xFFFFU
+#define JOURNAL_MAX_ENTRIES     ((FLASH_PAGE_SIZE - JOURNAL_HEADER_SIZE) / TWO_BYTE)
+
+static uint16_t EntryCount = 0;
+
+static void SRV_JOURNAL_Start(uint32_t ImageTag)
+{
+	uint32_t Header[2] = {JOURNAL_MAGIC, ImageTag};
+
+	MCAL_FPEC_EraseFlashArea(JOURNAL_PAGE_ADDRESS, JOURNAL_PAGE_ADDRESS);
+	MCAL_FPEC_FlashWrite(JOURNAL_PAGE_ADDRESS, (uint16_t *)Header, JOURNAL_HEADER_SIZE / TWO_BYTE);
+	EntryCount = 0;
+}
+
+uint32_t SRV_JOURNAL_Open(uint32_t ImageTag)
+{
+	uint16_t Entry;
+
+	if ((MCAL_FPEC_ReadWord(JOURNAL_PAGE_ADDRESS) != JOURNAL_MAGIC) ||
+		(MCAL_FPEC_ReadWord(JOURNAL_PAGE_ADDRESS + ONE_WORD_SIZE) != ImageTag))
+	{
+		SRV_JOURNAL_Start(ImageTag);
+		return 0;
+	}
+
+	/* Count the entries that continue the sequence 0, 1, 2 ... */
+	for (EntryCount = 0; EntryCount < JOURNAL_MAX_ENTRIES; EntryCount++)
+	{
+		Entry = *((volatile uint16_t *)(JOURNAL_PAGE_ADDRESS + JOURNAL_HEADER_SIZE + (EntryCount * TWO_BYTE)));
+		if (Entry != EntryCount)
+		{
+			break;
+		}
+	}
+
+	/* An entry interrupted while being programmed can not be appended to anymore */
+	if ((EntryCount < JOURNAL_MAX_ENTRIES) && (Entry != JOURNAL_ENTRY_EMPTY))
+	{
+		SRV_JOURNAL_Start(ImageTag);
+		return 0;
+	}
+
+	return EntryCount;
+}
+
+uint8_t SRV_JOURNAL_CommitPage(uint16_t PageIndex)
+{
+	uint8_t ErrorState = E_OK;
+
+	if (EntryCount < JOURNAL_MAX_ENTRIES)
+	{
+		MCAL_FPEC_FlashWrite(JOURNAL_PAGE_ADDRESS + JOURNAL_HEADER_SIZE + (EntryCount * TWO_BYTE), &PageIndex, 1);
+		EntryCount++;
+	}
+	else
+	{
+		ErrorState = NOT_OK;
+	}
+
+	return ErrorState;
+}
+
+void SRV_JOURNAL_Close(void)
+{
+	MCAL_FPEC_EraseFlashArea(JOURNAL_PAGE_ADDRESS, JOURNAL_PAGE_ADDRESS);
+	EntryCount = 0;
+}
@@ -0,0 +1,53 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: JOURNAL.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Flash-persisted progress journal of an image download.
+ *
+ * Page layout:
+ *   word 0      : JOURNAL_MAGIC
+ *   word 1      : tag of the image being downloaded
+ *   half-word n : index of the n-th committed image page
+ *
+ * Entries are appended by programming erased half-words, so committing a
+ * page costs one flash half-word write and never an erase. A page is only
+ * journaled after it was fully programmed, a reset in between simply makes
+ * the page to be received and programmed again.
+ */
+#ifndef JOURNAL_H_
+#define JOURNAL_H_
+
+#include "../../LIB/Std_Types/Std_Types.h"
+
+/**
+ * @brief Open the journal for an image and get the download progress.
+ *
+ * @details If the journal page belongs to the same image the number of pages
+ * committed so far is returned. Otherwise the journal is restarted for the
+ * given image and 0 is returned.
+ *
+ * @param ImageTag Value identifying the image being downloaded.
+ * @return uint32_t Number of image pages already programmed, starting from page 0.
+ */
+uint32_t SRV_JOURNAL_Open(uint32_t ImageTag);
+
+/**
+ * @brief Record an image page as programmed.
+ *
+ * @param PageIndex Index of the page inside the image, pages must be committed in order.
+ * @return uint8_t ErrorState (E_OK if successful, NOT_OK if the journal is full)
+ */
+uint8_t SRV_JOURNAL_CommitPage(uint16_t PageIndex);
+
+/**
+ * @brief Erase the journal once the download is complete.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_JOURNAL_Close(void);
+
+#endif /* JOURNAL_H_ */
@@ -0,0 +1,19 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: JOURNAL_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef JOURNAL_CFG_H_
+#define JOURNAL_CFG_H_
+
+/*
+ * JOURNAL_PAGE_ADDRESS : Flash page holding the progress journal. It is the last
+ *                        page of the Firmware Receiver partition (see STM32F103C8TX_FLASH.ld).
+ */
+#define JOURNAL_PAGE_ADDRESS    0x0800D800UL
+
+/* Marks a journal page that was written by this module ("JRNL"). */
+#define JOURNAL_MAGIC           0x4C4E524AUL
+
+#endif /* JOURNAL_CFG_H_ */
@@ -0,0 +1,107 @@
+/*================================================================
+ * 	File Name: LZSS.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "LZSS.h"
+#include "LZSS_Cfg.h"
+
+#define LZSS_WINDOW_SIZE        (1UL << LZSS_OFFSET_BITS)
+#define LZSS_WINDOW_MASK        (LZSS_WINDOW_SIZE - 1UL)
+#define LZSS_ITEMS_PER_GROUP    8U
+
+/* What the next stream byte is */
+#define LZSS_STATE_FLAGS        0U
+#define LZSS_STATE_ITEM         1U
+#define LZSS_STATE_REF_HIGH     2U
+
+static uint8_t Window[LZSS_WINDOW_SIZE];
+static uint32_t Produced;           /* Bytes decoded since the start of the stream */
+static uint8_t State;
+static uint8_t Flags;
+static uint8_t ItemsLeft;           /* Items of the current group still to come */
+static uint8_t RefLow;
+static uint16_t MatchDistance;
+static uint16_t MatchLeft;          /* Bytes of the current match not output yet */
+
+static void SRV_LZSS_NextItem(void)
+{
+	Flags >>= 1;
+	ItemsLeft--;
+	State = (ItemsLeft == 0U) ? LZSS_STATE_FLAGS : LZSS_STATE_ITEM;
+}
+
+void SRV_LZSS_Init(void)
+{
+	Produced = 0;
+	State = LZSS_STATE_FLAGS;
+	Flags = 0;
+	ItemsLeft = 0;
+	MatchLeft = 0;
+}
+
+uint8_t SRV_LZSS_Decode(const uint8_t *Input, uint32_t *InputLength, uint8_t *Output, uint32_t *OutputLength)
+{
+	uint32_t Read = 0;
+	uint32_t Written = 0;
+	uint16_t Reference;
+	uint8_t Byte;
+
+	while (1)
+	{
+		/* Copy as much of the pending match as fits */
+		while ((MatchLeft > 0U) && (Written < *OutputLength))
+		{
+			Byte = Window[(Produced - MatchDistance) & LZSS_WINDOW_MASK];
+			Window[Produced & LZSS_WINDOW_MASK] = Byte;
+			Output[Written++] = Byte;
+			Produced++;
+			MatchLeft--;
+		}
+		if ((Written == *OutputLength) || (Read == *InputLength))
+		{
+			break;
+		}
+
+		Byte = Input[Read++];
+		switch (State)
+		{
+		case LZSS_STATE_FLAGS:
+			Flags = Byte;
+			ItemsLeft = LZSS_ITEMS_PER_GROUP;
+			State = LZSS_STATE_ITEM;
+			break;
+
+		case LZSS_STATE_ITEM:
+			if ((Flags & 1U) != 0U)
+			{
+				Window[Produced & LZSS_WINDOW_MASK] = Byte;
+				Output[Written++] = Byte;
+				Produced++;
+				SRV_LZSS_NextItem();
+			}
+			else
+			{
+				RefLow = Byte;
+				State = LZSS_STATE_REF_HIGH;
+			}
+			break;
+
+		default:
+			Reference = (uint16_t)(RefLow | ((uint16_t)Byte << 8));
+			MatchDistance = (uint16_t)((Reference & LZSS_WINDOW_MASK) + 1U);
+			MatchLeft = (uint16_t)((Reference >> LZSS_OFFSET_BITS) + LZSS_MIN_MATCH);
+			if (MatchDistance > Produced)
+			{
+				*InputLength = Read;
+				*OutputLength = Written;
+				return LZSS_CORRUPT;
+			}
+			SRV_LZSS_NextItem();
+			break;
+		}
+	}
+
+	*InputLength = Read;
+	*OutputLength = Written;
+	return LZSS_OK;
+}
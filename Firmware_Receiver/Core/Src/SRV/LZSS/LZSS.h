@@ -0,0 +1,50 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: LZSS.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Streaming decoder of the compressed image format.
+ *
+ * The stream is a sequence of groups: one flag byte followed by up to
+ * eight items, flag bit 0 describing the first item. A set bit is a
+ * literal byte, a cleared bit a back-reference of two bytes (little
+ * endian) holding distance - 1 in its LZSS_OFFSET_BITS low bits and
+ * length - LZSS_MIN_MATCH in the bits above.
+ *
+ * The decoder keeps its whole state between calls, so the stream can be
+ * fed frame by frame and the output drained into a buffer of any size.
+ * Its only memory is a window of the last 2^LZSS_OFFSET_BITS output bytes.
+ */
+#ifndef LZSS_H_
+#define LZSS_H_
+
+#include "../../LIB/Std_Types/Std_Types.h"
+
+#define LZSS_OK                 1U   /**< Input decoded */
+#define LZSS_CORRUPT            0U   /**< Back-reference before the start of the output */
+
+/**
+ * @brief Restart the decoder at the beginning of a stream.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_LZSS_Init(void);
+
+/**
+ * @brief Decode stream bytes until the input is consumed or the output is full.
+ *
+ * @details A match that does not fit into the output is continued by the
+ * next call, which may be given no input at all.
+ *
+ * @param Input Next bytes of the stream.
+ * @param InputLength In: bytes available in Input. Out: bytes consumed.
+ * @param Output Buffer receiving the decoded bytes.
+ * @param OutputLength In: free space in Output. Out: bytes written.
+ * @return uint8_t LZSS_OK, or LZSS_CORRUPT if the stream is invalid.
+ */
+uint8_t SRV_LZSS_Decode(const uint8_t *Input, uint32_t *InputLength, uint8_t *Output, uint32_t *OutputLength);
+
+#endif /* LZSS_H_ */
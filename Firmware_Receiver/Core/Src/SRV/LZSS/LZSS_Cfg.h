@@ -0,0 +1,20 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: LZSS_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef LZSS_CFG_H_
+#define LZSS_CFG_H_
+
+/*
+ * LZSS_OFFSET_BITS : Bits of a back-reference holding the distance. The window
+ *                    kept in RAM is 2^LZSS_OFFSET_BITS bytes. The encoder of the
+ *                    host tools includes this file, both sides must agree.
+ */
+#define LZSS_OFFSET_BITS        10U
+
+/* Shortest match worth a two byte back-reference. */
+#define LZSS_MIN_MATCH          3U
+
+#endif /* LZSS_CFG_H_ */
@@ -0,0 +1,105 @@
+/*================================================================
+ * 	File Name: SPARSE.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "SPARSE.h"
+
+/* What the next byte of the list is */
+#define SPARSE_STATE_TAG        0U
+#define SPARSE_STATE_LENGTH     1U
+#define SPARSE_STATE_VALUE      2U
+#define SPARSE_STATE_DATA       3U
+
+/* A LEB128 number longer than this does not fit into 32 bits */
+#define SPARSE_MAX_SHIFT        28U
+
+static uint8_t State;
+static uint8_t Operation;
+static uint32_t Number;             /* LEB128 number being read */
+static uint8_t Shift;
+static uint32_t Length;             /* Bytes of the current extent not output yet */
+static uint8_t FillValue;
+
+void SRV_SPARSE_Init(void)
+{
+	State = SPARSE_STATE_TAG;
+	Length = 0;
+	Number = 0;
+	Shift = 0;
+}
+
+uint8_t SRV_SPARSE_Expand(const uint8_t *Input, uint32_t *InputLength, uint8_t *Output, uint32_t *OutputLength)
+{
+	uint32_t Read = 0;
+	uint32_t Written = 0;
+	uint8_t Status = SPARSE_OK;
+	uint8_t Byte;
+
+	while (Status == SPARSE_OK)
+	{
+		/* Output as much of the current fill as fits */
+		if (State == SPARSE_STATE_TAG)
+		{
+			while ((Length > 0U) && (Written < *OutputLength))
+			{
+				Output[Written++] = FillValue;
+				Length--;
+			}
+		}
+		if ((Written == *OutputLength) || (Read == *InputLength))
+		{
+			break;
+		}
+
+		Byte = Input[Read++];
+		switch (State)
+		{
+		case SPARSE_STATE_TAG:
+			Operation = Byte;
+			Number = 0;
+			Shift = 0;
+			State = SPARSE_STATE_LENGTH;
+			if ((Operation != SPARSE_OP_DATA) && (Operation != SPARSE_OP_FILL))
+			{
+				Status = SPARSE_CORRUPT;
+			}
+			break;
+
+		case SPARSE_STATE_LENGTH:
+			Number |= (uint32_t)(Byte & 0x7FU) << Shift;
+			Shift += 7U;
+			if ((Byte & 0x80U) == 0U)
+			{
+				Length = Number;
+				State = (Operation == SPARSE_OP_FILL) ? SPARSE_STATE_VALUE : SPARSE_STATE_DATA;
+				if (Length == 0U)
+				{
+					Status = SPARSE_CORRUPT;
+				}
+			}
+			else if (Shift > SPARSE_MAX_SHIFT)
+			{
+				Status = SPARSE_CORRUPT;
+			}
+			break;
+
+		case SPARSE_STATE_VALUE:
+			FillValue = Byte;
+			State = SPARSE_STATE_TAG;
+			break;
+
+		default:
+			Output[Written++] = Byte;
+			Length--;
+			if (Length == 0U)
+			{
+				State = SPARSE_STATE_TAG;
+			}
+			break;
+		}
+	}
+
+	*InputLength = Read;
+	*OutputLength = Written;
+	return Status;
+}
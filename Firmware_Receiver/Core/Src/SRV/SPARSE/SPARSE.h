@@ -0,0 +1,56 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: SPARSE.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Streaming expander of sparse images.
+ *
+ * A sparse image is a list of extents that cover the image from its
+ * first byte, each extent starting where the previous one ended. An
+ * extent is a tag byte followed by its length as a LEB128 number (7 bits
+ * per byte, least significant first, bit 7 set on all but the last byte):
+ *   SPARSE_OP_DATA length, bytes : the length bytes that follow
+ *   SPARSE_OP_FILL length, value : length times the byte value
+ *
+ * Alignment gaps and unused tails (0xFF, erased flash) and zeroed tables
+ * cost a few bytes on the bus instead of a frame per 8 bytes. The fill is
+ * generated here, and the updater does not program erased halfwords.
+ *
+ * Like SRV/DELTA the expander keeps its whole state between calls, so a
+ * fill longer than the staging buffer is drained without further input.
+ */
+#ifndef SPARSE_H_
+#define SPARSE_H_
+
+#include "../../LIB/Std_Types/Std_Types.h"
+
+#define SPARSE_OP_DATA          0x01U
+#define SPARSE_OP_FILL          0x02U
+
+#define SPARSE_OK               1U   /**< Input expanded */
+#define SPARSE_CORRUPT          0U   /**< Unknown tag or an empty extent */
+
+/**
+ * @brief Restart the expander at the beginning of an extent list.
+ *
+ * @return None
+ */
+void SRV_SPARSE_Init(void);
+
+/**
+ * @brief Expand extents until the input is consumed or the output is full.
+ *
+ * @details An extent that does not fit into the output is continued by
+ * the next call, which may be given no input at all.
+ *
+ * @param Input Next bytes of the extent list.
+ * @param InputLength In: bytes available in Input. Out: bytes consumed.
+ * @param Output Buffer receiving the bytes of the image.
+ * @param OutputLength In: free space in Output. Out: bytes written.
+ * @return uint8_t SPARSE_OK, or SPARSE_CORRUPT if the list is invalid.
+ */
+uint8_t SRV_SPARSE_Expand(const uint8_t *Input, uint32_t *InputLength, uint8_t *Output, uint32_t *OutputLength);
+
+#endif /* SPARSE_H_ */
@@ -0,0 +1,191 @@
+/*================================================================
+ * 	File Name: TRACE.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "TRACE.h"
+
+#if TRACE_ENABLE == 1
+
+typedef struct
+{
+	uint16_t Bucket[TRACE_BUCKETS];
+	uint32_t Samples;
+	uint16_t Min;
+	uint16_t Max;
+} TRACE_Histogram_t;
+
+static TRACE_Histogram_t Histogram[TRACE_HIST_COUNT];
+static CAN_HandleTypeDef *TraceCan;
+
+static volatile uint32_t IrqEntryCycles = 0;
+static uint16_t LastDataTimestamp = 0;
+static uint8_t HasLastData = FALSE;
+
+static uint32_t AckMailbox = 0;                 /* 0 when no ACK is being tracked */
+static uint16_t AckDataTimestamp = 0;
+
+static void SRV_TRACE_Record(uint8_t Id, uint32_t Value)
+{
+	TRACE_Histogram_t *Hist = &Histogram[Id];
+	uint32_t Bucket;
+
+	if (Value > 0xFFFFU)
+	{
+		Value = 0xFFFFU;
+	}
+
+	/* log2 bucket: 0 -> 0, [2^(k-1), 2^k) -> k */
+	Bucket = (Value == 0U) ? 0U : (32U - __CLZ(Value));
+	if (Bucket >= TRACE_BUCKETS)
+	{
+		Bucket = TRACE_BUCKETS - 1U;
+	}
+
+	if (Hist->Bucket[Bucket] < 0xFFFFU)
+	{
+		Hist->Bucket[Bucket]++;
+	}
+	if (Hist->Samples == 0U || Value < Hist->Min)
+	{
+		Hist->Min = (uint16_t)Value;
+	}
+	if (Value > Hist->Max)
+	{
+		Hist->Max = (uint16_t)Value;
+	}
+	Hist->Samples++;
+}
+
+void SRV_TRACE_Init(CAN_HandleTypeDef *Can)
+{
+	TraceCan = Can;
+
+	/* Enable the DWT cycle counter */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	SRV_TRACE_Clear();
+}
+
+void SRV_TRACE_IrqEntry(void)
+{
+	IrqEntryCycles = DWT->CYCCNT;
+}
+
+void SRV_TRACE_DataFrame(uint32_t RxTimestamp)
+{
+	SRV_TRACE_Record(TRACE_HIST_ISR_DELAY, DWT->CYCCNT - IrqEntryCycles);
+
+	if (HasLastData)
+	{
+		/* The CAN timer is 16 bits wide, the subtraction handles one wrap */
+		SRV_TRACE_Record(TRACE_HIST_FRAME_GAP, (uint16_t)((uint16_t)RxTimestamp - LastDataTimestamp));
+	}
+	LastDataTimestamp = (uint16_t)RxTimestamp;
+	HasLastData = TRUE;
+
+	SRV_TRACE_Poll();
+}
+
+void SRV_TRACE_AckQueued(uint32_t Mailbox, uint32_t RxTimestamp)
+{
+	/* A previous ACK still in flight is not measured */
+	AckMailbox = Mailbox;
+	AckDataTimestamp = (uint16_t)RxTimestamp;
+}
+
+void SRV_TRACE_Poll(void)
+{
+	uint32_t Index;
+	uint16_t AckTimestamp;
+
+	if (AckMailbox == 0U)
+	{
+		return;
+	}
+
+	Index = (AckMailbox == CAN_TX_MAILBOX0) ? 0U : ((AckMailbox == CAN_TX_MAILBOX1) ? 1U : 2U);
+
+	/* Wait until the mailbox is empty again, TXOK tells whether it was sent or aborted */
+	if ((TraceCan->Instance->TSR & (CAN_TSR_TME0 << Index)) == 0U)
+	{
+		return;
+	}
+	if ((TraceCan->Instance->TSR & (CAN_TSR_TXOK0 << (8U * Index))) != 0U)
+	{
+		AckTimestamp = (uint16_t)HAL_CAN_GetTxTimestamp(TraceCan, AckMailbox);
+		SRV_TRACE_Record(TRACE_HIST_ACK_LATENCY, (uint16_t)(AckTimestamp - AckDataTimestamp));
+	}
+	AckMailbox = 0U;
+}
+
+void SRV_TRACE_Clear(void)
+{
+	for (uint8_t Id = 0; Id < TRACE_HIST_COUNT; Id++)
+	{
+		for (uint8_t Bucket = 0; Bucket < TRACE_BUCKETS; Bucket++)
+		{
+			Histogram[Id].Bucket[Bucket] = 0;
+		}
+		Histogram[Id].Samples = 0;
+		Histogram[Id].Min = 0;
+		Histogram[Id].Max = 0;
+	}
+	HasLastData = FALSE;
+	AckMailbox = 0U;
+}
+
+uint8_t SRV_TRACE_Read(const uint8_t *Request, uint8_t Length, uint8_t *Response)
+{
+	const TRACE_Histogram_t *Hist;
+	uint8_t Index;
+
+	if (Length < 3 || Request[1] >= TRACE_HIST_COUNT)
+	{
+		return 0;
+	}
+
+	Hist = &Histogram[Request[1]];
+	Index = Request[2];
+	Response[0] = Request[0] | RESP_POSITIVE;
+	Response[1] = Request[1];
+	Response[2] = Index;
+
+	if (Index < TRACE_BUCKETS)
+	{
+		Response[3] = (uint8_t)(Hist->Bucket[Index]);
+		Response[4] = (uint8_t)(Hist->Bucket[Index] >> 8);
+		if ((Index + 1U) < TRACE_BUCKETS)
+		{
+			Response[5] = (uint8_t)(Hist->Bucket[Index + 1U]);
+			Response[6] = (uint8_t)(Hist->Bucket[Index + 1U] >> 8);
+		}
+		else
+		{
+			Response[5] = 0;
+			Response[6] = 0;
+		}
+		return 7;
+	}
+	else if (Index == TRACE_INDEX_SAMPLES)
+	{
+		Response[3] = (uint8_t)(Hist->Samples);
+		Response[4] = (uint8_t)(Hist->Samples >> 8);
+		Response[5] = (uint8_t)(Hist->Samples >> 16);
+		Response[6] = (uint8_t)(Hist->Samples >> 24);
+		return 7;
+	}
+	else if (Index == TRACE_INDEX_MIN_MAX)
+	{
+		Response[3] = (uint8_t)(Hist->Min);
+		Response[4] = (uint8_t)(Hist->Min >> 8);
+		Response[5] = (uint8_t)(Hist->Max);
+		Response[6] = (uint8_t)(Hist->Max >> 8);
+		return 7;
+	}
+
+	return 0;
+}
+
+#endif /* TRACE_ENABLE */
@@ -0,0 +1,115 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: TRACE.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Per-frame latency instrumentation based on the bxCAN hardware
+ * timestamps. With TTCM enabled the 16-bit CAN timer counts bit times
+ * and is captured at the start of frame of every received (RDTxR) and
+ * transmitted (TDTxR) frame. Three histograms are recorded:
+ *
+ *  - TRACE_HIST_ACK_LATENCY : data frame SOF to ACK frame SOF, in bit times.
+ *                             This is the send-to-ACK latency seen on the bus.
+ *  - TRACE_HIST_FRAME_GAP   : SOF to SOF of consecutive data frames, in bit times.
+ *  - TRACE_HIST_ISR_DELAY   : CPU cycles from the CAN RX0 IRQ entry to the
+ *                             frame reaching the updater (HAL dispatch cost).
+ *
+ * The histograms are read over the control channel with CMD_READ_TRACE.
+ */
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include "main.h"
+#include "TRACE_Cfg.h"
+#include "../../LIB/Std_Types/Std_Types.h"
+
+/* Histogram identifiers */
+#define TRACE_HIST_ACK_LATENCY      0U
+#define TRACE_HIST_FRAME_GAP        1U
+#define TRACE_HIST_ISR_DELAY        2U
+#define TRACE_HIST_COUNT            3U
+
+/* CMD_READ_TRACE indexes after the buckets */
+#define TRACE_INDEX_SAMPLES         0x10U   /* uint32_t sample count */
+#define TRACE_INDEX_MIN_MAX         0x11U   /* uint16_t minimum, uint16_t maximum */
+
+#if TRACE_ENABLE == 1
+
+/**
+ * @brief Start the cycle counter and clear all histograms.
+ *
+ * @param Can Handle of the CAN peripheral running in time triggered mode.
+ * @return None
+ */
+void SRV_TRACE_Init(CAN_HandleTypeDef *Can);
+
+/**
+ * @brief Capture the cycle counter on entry of the CAN RX0 interrupt.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_TRACE_IrqEntry(void);
+
+/**
+ * @brief Record a received data frame.
+ *
+ * @param RxTimestamp Hardware timestamp of the frame (CAN_RxHeaderTypeDef.Timestamp).
+ * @return None
+ */
+void SRV_TRACE_DataFrame(uint32_t RxTimestamp);
+
+/**
+ * @brief Remember an ACK queued for a data frame, its latency is recorded once it left the mailbox.
+ *
+ * @param Mailbox Mailbox returned by HAL_CAN_AddTxMessage.
+ * @param RxTimestamp Hardware timestamp of the acknowledged data frame.
+ * @return None
+ */
+void SRV_TRACE_AckQueued(uint32_t Mailbox, uint32_t RxTimestamp);
+
+/**
+ * @brief Record the latency of the last ACK if it was transmitted in the meantime.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_TRACE_Poll(void);
+
+/**
+ * @brief Clear all histograms.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_TRACE_Clear(void);
+
+/**
+ * @brief Build the answer of a CMD_READ_TRACE command.
+ *
+ * @details Request: [CMD_READ_TRACE, histogram, index]. An index below TRACE_BUCKETS
+ * returns the counts of buckets index and index + 1 as two uint16_t, the
+ * TRACE_INDEX_* indexes return the histogram summary.
+ *
+ * @param Request Command payload.
+ * @param Length Command length.
+ * @param Response Buffer of 8 bytes receiving the answer.
+ * @return uint8_t Length of the answer, 0 if the request is invalid.
+ */
+uint8_t SRV_TRACE_Read(const uint8_t *Request, uint8_t Length, uint8_t *Response);
+
+#else
+
+#define SRV_TRACE_Init(Can)
+#define SRV_TRACE_IrqEntry()
+#define SRV_TRACE_DataFrame(RxTimestamp)
+#define SRV_TRACE_AckQueued(Mailbox, RxTimestamp)   ((void)(Mailbox), (void)(RxTimestamp))
+#define SRV_TRACE_Poll()
+#define SRV_TRACE_Clear()
+#define SRV_TRACE_Read(Request, Length, Response)   (0U)
+
+#endif /* TRACE_ENABLE */
+
+#endif /* TRACE_H_ */
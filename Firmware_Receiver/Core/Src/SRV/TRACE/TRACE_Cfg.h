@@ -0,0 +1,24 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: TRACE_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef TRACE_CFG_H_
+#define TRACE_CFG_H_
+
+/*
+ * TRACE_ENABLE:
+ * 1- Enable the CAN time triggered mode (TTCM) and record the latency histograms.
+ * 0- Instrumentation compiled out, the CAN runs without timestamps.
+ */
+#define TRACE_ENABLE        0
+
+/*
+ * Number of log2 buckets per histogram. Bucket 0 counts zero values,
+ * bucket k counts values in [2^(k-1), 2^k), the last bucket also collects
+ * everything above its range.
+ */
+#define TRACE_BUCKETS       16U
+
+#endif /* TRACE_CFG_H_ */
@@ -0,0 +1,732 @@
+/*================================================================
+ * 	File Name: UPDATER.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "UPDATER.h"
+#include "../JOURNAL/JOURNAL.h"
+#include "../TRACE/TRACE.h"
+#include "../BENCH/BENCH.h"
+#include "../LZSS/LZSS.h"
+#include "../DELTA/DELTA.h"
+#include "../SPARSE/SPARSE.h"
+#include "../CRC/CRC.h"
+#include "../IMAGE/IMAGE.h"
+#include "../BOOTCTL/BOOTCTL.h"
+#include "../../MCAL/FPEC/FPEC.h"
+
+#define FRAMES_PER_PAGE     (FLASH_PAGE_SIZE / CHUNK_SIZE)
+#define HEADER_FRAMES       (IMAGE_HEADER_SIZE / CHUNK_SIZE)
+/* Milliseconds the last ACK gets to leave its mailbox, without a sender or bus-off it is aborted then */
+#define LAST_ACK_TIMEOUT_MS 20U
+
+/* What the data frames of the current session carry */
+#define SESSION_IDLE        0U      /* Nothing, data frames are not acknowledged */
+#define SESSION_HEADER      1U      /* The header of an image, see CMD_IMAGE_START */
+#define SESSION_IMAGE       2U      /* The image, plain or encoded */
+#define SESSION_BENCH       3U      /* A benchmark payload, not an image */
+
+/* Work left on the pending page, one step per call of the main function when a budget is set */
+#define PAGE_STEP_ERASE     0U      /* Erase the page the staging buffer goes to */
+#define PAGE_STEP_PROGRAM   1U      /* Program the staging buffer from ProgramIndex */
+#define PAGE_STEP_VERIFY    2U      /* Last page done, check the image from VerifyOffset */
+#define PAGE_STEP_ACK       3U      /* Image activated, send the held back ACK and close the journal */
+
+/* Decoder of an encoded session, SRV_LZSS_Decode, SRV_DELTA_Apply or SRV_SPARSE_Expand, all return 1 on success */
+typedef uint8_t (*SRV_UPDATER_Decoder_t)(const uint8_t *Input, uint32_t *InputLength, uint8_t *Output, uint32_t *OutputLength);
+
+static CAN_HandleTypeDef *UpdaterCan;
+static CAN_TxHeaderTypeDef AckHeader;
+static CAN_TxHeaderTypeDef RespHeader;
+static uint32_t TxMailbox;
+
+static uint16_t PageBuffer[FLASH_PAGE_SIZE / TWO_BYTE];   /* Staging buffer of the page being received */
+static volatile uint32_t ReceivedFrameCount = 0;
+static volatile uint32_t SessionFrames = 0;               /* Frames of the current session */
+static volatile uint32_t FirstDataFrame = 0;              /* Frames before the first page, the image header */
+static volatile uint8_t SessionState = SESSION_IDLE;
+static volatile uint8_t PagePending = FALSE;              /* Page complete, waiting to be programmed */
+static volatile uint8_t PendingSeq = 0;                   /* Sequence bit of the held back ACK */
+static volatile uint32_t PendingTimestamp = 0;            /* Hardware timestamp of the frame it acknowledges */
+
+static uint8_t HeaderBytes[IMAGE_HEADER_SIZE];           /* Header of the image session as received */
+static SRV_IMAGE_Header_t Image;                          /* The header once accepted */
+static uint8_t TargetSlot;                                /* Inactive slot the session is programmed into */
+static uint32_t TargetAddress;                            /* Its first address */
+
+/* Encoded session, see IMAGE_FLAG_LZSS, IMAGE_FLAG_DELTA and IMAGE_FLAG_SPARSE */
+static volatile uint8_t StreamMode = FALSE;
+static volatile uint8_t StreamError = FALSE;              /* Stream found corrupt, reported by the main loop */
+static SRV_UPDATER_Decoder_t StreamDecoder;
+static uint32_t StagedBytes = 0;                          /* Decoded bytes in the staging buffer */
+static uint32_t OutputCount = 0;                          /* Decoded bytes of the image so far */
+static uint8_t LeftoverInput[CHUNK_SIZE];                 /* Input of the frame that filled the page, not decoded yet */
+static uint8_t LeftoverLength = 0;
+
+static uint32_t ProgramBudget = 0;                        /* Half-words programmed per call, 0 for a whole page */
+static uint8_t PageStep = PAGE_STEP_ERASE;
+static uint32_t PageAddress;                              /* Page being programmed */
+static uint32_t PageHalfWords;                            /* Half-words of the staging buffer it takes */
+static uint32_t ProgramIndex;                             /* First half-word not programmed yet */
+static uint32_t PageStart;                                /* SRV_BENCH_Now at the erase */
+static uint32_t VerifyOffset;                             /* Bytes of the image checked so far */
+static uint32_t VerifyCrc;
+static uint8_t LastAckQueued = FALSE;                     /* Session done, waiting for its last ACK to go out */
+static uint32_t LastAckTick;                              /* HAL_GetTick when it was queued */
+
+/* Error state of the controller, see CMD_READ_LINK */
+static uint8_t PassiveCount = 0;                          /* Error passive entries */
+static uint8_t BusOffCount = 0;                           /* Bus-off entries, the controller recovers on its own */
+static uint8_t PassiveTec = 0;                            /* TEC and REC at the last error passive entry */
+static uint8_t PassiveRec = 0;
+static uint8_t WasPassive = FALSE;
+static uint8_t WasBusOff = FALSE;
+
+static void SRV_UPDATER_SendAck(uint8_t Seq, uint32_t RxTimestamp)
+{
+	uint8_t AckData[2] = {ACK_FRAME_DATA, Seq};
+
+	if (HAL_CAN_AddTxMessage(UpdaterCan, &AckHeader, AckData, &TxMailbox) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	SRV_TRACE_AckQueued(TxMailbox, RxTimestamp);
+}
+
+/* The frame Seq completed the page being programmed, its ACK follows */
+static void SRV_UPDATER_SendBusy(uint8_t Seq)
+{
+	uint8_t BusyData[2] = {ACK_FRAME_BUSY, Seq};
+
+	if (HAL_CAN_AddTxMessage(UpdaterCan, &AckHeader, BusyData, &TxMailbox) != HAL_OK)
+	{
+		Error_Handler();
+	}
+}
+
+/* Decode the image of the accepted header with Decoder */
+static void SRV_UPDATER_OpenStream(SRV_UPDATER_Decoder_t Decoder)
+{
+	/* The decoder state is not journaled, an encoded session always starts over */
+	SRV_JOURNAL_Close();
+	StreamMode = TRUE;
+	StreamDecoder = Decoder;
+	StagedBytes = 0;
+	OutputCount = 0;
+	LeftoverLength = 0;
+}
+
+/* Decode stream bytes into the staging buffer, keeping what does not fit for the next page */
+static uint8_t SRV_UPDATER_Expand(const uint8_t *Data, uint8_t Length)
+{
+	uint32_t Consumed = Length;
+	uint32_t Space = FLASH_PAGE_SIZE - StagedBytes;
+	uint8_t i;
+
+	if (Space > (Image.Length - OutputCount))
+	{
+		Space = Image.Length - OutputCount;
+	}
+	if (!StreamDecoder(Data, &Consumed, (uint8_t *)PageBuffer + StagedBytes, &Space))
+	{
+		return FALSE;
+	}
+	StagedBytes += Space;
+	OutputCount += Space;
+
+	/* What follows the end of the image is the padding of the last frame */
+	if (OutputCount >= Image.Length)
+	{
+		Consumed = Length;
+	}
+	for (i = 0; i < (Length - Consumed); i++)
+	{
+		LeftoverInput[i] = Data[Consumed + i];
+	}
+	LeftoverLength = (uint8_t)(Length - Consumed);
+	return TRUE;
+}
+
+/* The staging buffer holds a full page or the end of the image */
+static uint8_t SRV_UPDATER_StagedPageComplete(void)
+{
+	return (StagedBytes == FLASH_PAGE_SIZE) || (OutputCount >= Image.Length);
+}
+
+static void SRV_UPDATER_HandleCommand(const uint8_t *Data, uint8_t Length)
+{
+	uint8_t RespData[8] = {0};
+	uint32_t Size;
+
+	if (Length < 1)
+	{
+		return;
+	}
+
+	switch (Data[0])
+	{
+	case CMD_RESUME_QUERY:
+		/* Only an accepted image has a place to continue from */
+		if (SessionState != SESSION_IMAGE)
+		{
+			RespData[0] = RESP_NEGATIVE;
+			RespData[1] = Data[0];
+			RespHeader.DLC = 2;
+			break;
+		}
+		/* Frame index the sender has to continue from */
+		RespData[0] = CMD_RESUME_QUERY | RESP_POSITIVE;
+		RespData[1] = (uint8_t)(ReceivedFrameCount);
+		RespData[2] = (uint8_t)(ReceivedFrameCount >> 8);
+		RespData[3] = (uint8_t)(ReceivedFrameCount >> 16);
+		RespData[4] = (uint8_t)(ReceivedFrameCount >> 24);
+		RespHeader.DLC = 5;
+		break;
+
+	case CMD_READ_TRACE:
+		RespHeader.DLC = SRV_TRACE_Read(Data, Length, RespData);
+		if (RespHeader.DLC == 0)
+		{
+			RespData[0] = RESP_NEGATIVE;
+			RespData[1] = Data[0];
+			RespHeader.DLC = 2;
+		}
+		break;
+
+	case CMD_CLEAR_TRACE:
+		SRV_TRACE_Clear();
+		RespData[0] = CMD_CLEAR_TRACE | RESP_POSITIVE;
+		RespHeader.DLC = 1;
+		break;
+
+	case CMD_BENCH_START:
+		Size = (Length >= 5) ? ((uint32_t)Data[1] | ((uint32_t)Data[2] << 8) |
+		                        ((uint32_t)Data[3] << 16) | ((uint32_t)Data[4] << 24)) : 0;
+		if (PagePending || Size == 0 || Size > NEW_FIRMWARE_SLOT_SIZE)
+		{
+			RespData[0] = RESP_NEGATIVE;
+			RespData[1] = Data[0];
+			RespHeader.DLC = 2;
+			break;
+		}
+		/* The payload overwrites the inactive slot, a half downloaded image cannot be resumed anymore */
+		SRV_JOURNAL_Close();
+		SRV_BENCH_Start();
+		TargetSlot = SRV_BOOTCTL_GetInactive();
+		TargetAddress = SRV_BOOTCTL_SlotAddress(TargetSlot);
+		SessionState = SESSION_BENCH;
+		StreamMode = FALSE;
+		FirstDataFrame = 0;
+		SessionFrames = (Size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+		ReceivedFrameCount = 0;
+		RespData[0] = CMD_BENCH_START | RESP_POSITIVE;
+		RespHeader.DLC = 1;
+		break;
+
+	case CMD_IMAGE_START:
+		if (PagePending || StreamError)
+		{
+			RespData[0] = RESP_NEGATIVE;
+			RespData[1] = Data[0];
+			RespHeader.DLC = 2;
+			break;
+		}
+		/* The journal stays as it is until the header tells which image follows */
+		SessionState = SESSION_HEADER;
+		StreamMode = FALSE;
+		FirstDataFrame = 0;
+		SessionFrames = HEADER_FRAMES;
+		ReceivedFrameCount = 0;
+		RespData[0] = CMD_IMAGE_START | RESP_POSITIVE;
+		RespHeader.DLC = 1;
+		break;
+
+	case CMD_ENTER_UPDATE:
+		/* Already here */
+		RespData[0] = CMD_ENTER_UPDATE | RESP_POSITIVE;
+		RespHeader.DLC = 1;
+		break;
+
+	case CMD_READ_LINK:
+		RespData[0] = CMD_READ_LINK | RESP_POSITIVE;
+		RespData[1] = (uint8_t)((UpdaterCan->Instance->ESR & CAN_ESR_TEC) >> CAN_ESR_TEC_Pos);
+		RespData[2] = (uint8_t)((UpdaterCan->Instance->ESR & CAN_ESR_REC) >> CAN_ESR_REC_Pos);
+		RespData[3] = (uint8_t)(UpdaterCan->Instance->ESR & (CAN_ESR_EWGF | CAN_ESR_EPVF | CAN_ESR_BOFF));
+		RespData[4] = PassiveCount;
+		RespData[5] = BusOffCount;
+		RespData[6] = PassiveTec;
+		RespData[7] = PassiveRec;
+		RespHeader.DLC = 8;
+		break;
+
+	case CMD_BENCH_RESULT:
+		RespHeader.DLC = (Length >= 2) ? SRV_BENCH_Read(Data[1], RespData) : 0;
+		if (RespHeader.DLC == 0)
+		{
+			RespData[0] = RESP_NEGATIVE;
+			RespData[1] = Data[0];
+			RespHeader.DLC = 2;
+		}
+		break;
+
+	default:
+		RespData[0] = RESP_NEGATIVE;
+		RespData[1] = Data[0];
+		RespHeader.DLC = 2;
+		break;
+	}
+
+	if (HAL_CAN_AddTxMessage(UpdaterCan, &RespHeader, RespData, &TxMailbox) != HAL_OK)
+	{
+		Error_Handler();
+	}
+}
+
+static void SRV_UPDATER_HandleData(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data)
+{
+	uint8_t *Staging = (uint8_t *)PageBuffer;
+	uint8_t Seq = (uint8_t)((Header->StdId ^ DATA_FRAME_ID) & DATA_FRAME_SEQ_MASK);
+	uint32_t Offset;
+	uint8_t PageComplete;
+
+	SRV_TRACE_DataFrame(Header->Timestamp);
+
+	/* The staging buffer is being programmed, a retransmission of the frame that completed it is told so */
+	if (PagePending && !StreamError && (Seq == PendingSeq))
+	{
+		SRV_UPDATER_SendBusy(Seq);
+		return;
+	}
+	if (PagePending || StreamError || (SessionState == SESSION_IDLE))
+	{
+		return;
+	}
+
+	/* Anything but the expected sequence bit is a retransmission of the previous frame */
+	if (Seq != (ReceivedFrameCount & DATA_FRAME_SEQ_MASK) || ReceivedFrameCount >= SessionFrames)
+	{
+		SRV_UPDATER_SendAck(Seq, Header->Timestamp);
+		return;
+	}
+
+	if (SessionState == SESSION_HEADER)
+	{
+		for (uint8_t i = 0; i < CHUNK_SIZE; i++)
+		{
+			HeaderBytes[(ReceivedFrameCount * CHUNK_SIZE) + i] = Data[i];
+		}
+		ReceivedFrameCount++;
+		/* The main loop checks the header before its last frame is acknowledged */
+		PageComplete = (ReceivedFrameCount >= HEADER_FRAMES);
+	}
+	else if (StreamMode)
+	{
+		if (!SRV_UPDATER_Expand(Data, CHUNK_SIZE))
+		{
+			StreamError = TRUE;
+			return;
+		}
+		ReceivedFrameCount++;
+		PageComplete = SRV_UPDATER_StagedPageComplete() || (ReceivedFrameCount >= SessionFrames);
+	}
+	else
+	{
+		Offset = ((ReceivedFrameCount - FirstDataFrame) % FRAMES_PER_PAGE) * CHUNK_SIZE;
+		for (uint8_t i = 0; i < CHUNK_SIZE; i++)
+		{
+			Staging[Offset + i] = Data[i];
+		}
+		ReceivedFrameCount++;
+		PageComplete = (((ReceivedFrameCount - FirstDataFrame) % FRAMES_PER_PAGE) == 0) ||
+		               (ReceivedFrameCount >= SessionFrames);
+	}
+
+	if (PageComplete)
+	{
+		/* Hold the ACK back until the page is in flash, the sender stops its timeout meanwhile */
+		PendingSeq = Seq;
+		PendingTimestamp = Header->Timestamp;
+		PagePending = TRUE;
+		SRV_UPDATER_SendBusy(Seq);
+	}
+	else
+	{
+		SRV_UPDATER_SendAck(Seq, Header->Timestamp);
+	}
+}
+
+/* Program the staging buffer into the page just erased, skipping the halfwords that stay erased.
+ * At most ProgramBudget halfwords are programmed, TRUE once the page is done */
+static uint8_t SRV_UPDATER_ProgramPage(void)
+{
+	uint32_t Start;
+	uint32_t End;
+	uint32_t Allowed = (ProgramBudget != 0U) ? ProgramBudget : PageHalfWords;
+
+	while ((ProgramIndex < PageHalfWords) && (Allowed > 0U))
+	{
+		Start = ProgramIndex;
+		while ((Start < PageHalfWords) && (PageBuffer[Start] == 0xFFFFU))
+		{
+			Start++;
+		}
+		End = Start;
+		while ((End < PageHalfWords) && (PageBuffer[End] != 0xFFFFU) && ((End - Start) < Allowed))
+		{
+			End++;
+		}
+		if (End > Start)
+		{
+			MCAL_FPEC_FlashWrite(PageAddress + (Start * TWO_BYTE), &PageBuffer[Start], End - Start);
+			Allowed -= End - Start;
+		}
+		ProgramIndex = End;
+	}
+	return (ProgramIndex >= PageHalfWords) ? TRUE : FALSE;
+}
+
+/* The last ACK left its mailbox, or was aborted after LAST_ACK_TIMEOUT_MS */
+static uint8_t SRV_UPDATER_LastAckSent(void)
+{
+	if (HAL_CAN_IsTxMessagePending(UpdaterCan, TxMailbox) && ((HAL_GetTick() - LastAckTick) < LAST_ACK_TIMEOUT_MS))
+	{
+		return FALSE;
+	}
+	(void)HAL_CAN_AbortTxRequest(UpdaterCan, TxMailbox);
+	LastAckQueued = FALSE;
+	return TRUE;
+}
+
+/* Refuse the header or give up the image, the sender has to open a new session */
+static void SRV_UPDATER_Reject(void)
+{
+	uint8_t RespData[2] = {RESP_NEGATIVE, CMD_IMAGE_START};
+
+	__disable_irq();
+	RespHeader.DLC = 2;
+	if (HAL_CAN_AddTxMessage(UpdaterCan, &RespHeader, RespData, &TxMailbox) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	SessionState = SESSION_IDLE;
+	StreamMode = FALSE;
+	StreamError = FALSE;
+	PagePending = FALSE;
+	PageStep = PAGE_STEP_ERASE;
+	__enable_irq();
+}
+
+/* Check the received header and set the session up for the image it describes */
+static void SRV_UPDATER_OpenImage(void)
+{
+	uint32_t CommittedPages;
+	uint8_t BaseSlot;
+
+	/* The image has to be linked for the slot that is not running. Until an
+	 * update selected a slot, the header picks it: slot A may hold the factory
+	 * image as well as the first pages of an image cut short by a reset */
+	TargetSlot = SRV_BOOTCTL_GetInactive();
+	if (!SRV_BOOTCTL_IsKnown() &&
+		!SRV_IMAGE_Parse(HeaderBytes, SRV_BOOTCTL_SlotAddress(TargetSlot), NEW_FIRMWARE_SLOT_SIZE, &Image))
+	{
+		TargetSlot = (TargetSlot == BOOTCTL_SLOT_A) ? BOOTCTL_SLOT_B : BOOTCTL_SLOT_A;
+	}
+	TargetAddress = SRV_BOOTCTL_SlotAddress(TargetSlot);
+	BaseSlot = (TargetSlot == BOOTCTL_SLOT_A) ? BOOTCTL_SLOT_B : BOOTCTL_SLOT_A;
+
+	/* A delta only fits the image it was made against, the one running */
+	if (!SRV_IMAGE_Parse(HeaderBytes, TargetAddress, NEW_FIRMWARE_SLOT_SIZE, &Image) ||
+		(((Image.Flags & IMAGE_FLAG_DELTA) != 0U) &&
+		 (!SRV_BOOTCTL_HoldsImage(BaseSlot) ||
+		  (SRV_CRC_Update(CRC_INITIAL, (const uint8_t *)(uintptr_t)SRV_BOOTCTL_SlotAddress(BaseSlot), Image.BaseLength) !=
+		   Image.BaseCrc))))
+	{
+		SRV_UPDATER_Reject();
+		return;
+	}
+
+	FirstDataFrame = HEADER_FRAMES;
+	SessionFrames = HEADER_FRAMES + ((Image.StreamSize + CHUNK_SIZE - 1) / CHUNK_SIZE);
+	if ((Image.Flags & IMAGE_FLAG_LZSS) != 0U)
+	{
+		SRV_LZSS_Init();
+		SRV_UPDATER_OpenStream(SRV_LZSS_Decode);
+	}
+	else if ((Image.Flags & IMAGE_FLAG_SPARSE) != 0U)
+	{
+		SRV_SPARSE_Init();
+		SRV_UPDATER_OpenStream(SRV_SPARSE_Expand);
+	}
+	else if ((Image.Flags & IMAGE_FLAG_DELTA) != 0U)
+	{
+		/* The base is read from the running slot while the new image is built in the other one */
+		SRV_DELTA_Init((const uint8_t *)(uintptr_t)SRV_BOOTCTL_SlotAddress(BaseSlot), Image.BaseLength);
+		SRV_UPDATER_OpenStream(SRV_DELTA_Apply);
+	}
+	else
+	{
+		/* Continue after the last page of this image that made it to flash before a reset */
+		CommittedPages = SRV_JOURNAL_Open(Image.ImageCrc);
+		ReceivedFrameCount = HEADER_FRAMES + (CommittedPages * FRAMES_PER_PAGE);
+		if (ReceivedFrameCount > SessionFrames)
+		{
+			ReceivedFrameCount = SessionFrames;
+		}
+	}
+
+	__disable_irq();
+	SessionState = SESSION_IMAGE;
+	PagePending = FALSE;
+	SRV_UPDATER_SendAck(PendingSeq, PendingTimestamp);
+	__enable_irq();
+}
+
+void SRV_UPDATER_Init(CAN_HandleTypeDef *Can)
+{
+	UpdaterCan = Can;
+
+	AckHeader.IDE = CAN_ID_STD;
+	AckHeader.StdId = ACK_FRAME_ID;
+	AckHeader.RTR = CAN_RTR_DATA;
+	AckHeader.DLC = 2; /* ACK code and sequence bit */
+
+	RespHeader.IDE = CAN_ID_STD;
+	RespHeader.StdId = RESP_FRAME_ID;
+	RespHeader.RTR = CAN_RTR_DATA;
+
+	/* Nothing is received before CMD_IMAGE_START, the journal is opened by the header */
+	SessionState = SESSION_IDLE;
+	SessionFrames = 0;
+	ReceivedFrameCount = 0;
+	PagePending = FALSE;
+	PageStep = PAGE_STEP_ERASE;
+	StreamMode = FALSE;
+	StreamError = FALSE;
+	LastAckQueued = FALSE;
+	PassiveCount = 0;
+	BusOffCount = 0;
+	WasPassive = FALSE;
+	WasBusOff = FALSE;
+	SRV_BOOTCTL_Init();
+	SRV_BENCH_Init();
+}
+
+void SRV_UPDATER_ErrorIndication(void)
+{
+	uint32_t Esr = UpdaterCan->Instance->ESR;
+	uint8_t IsPassive = ((Esr & CAN_ESR_EPVF) != 0U);
+	uint8_t IsBusOff = ((Esr & CAN_ESR_BOFF) != 0U);
+
+	/* Count transitions, not every error frame seen while in the state */
+	if (IsPassive && !WasPassive)
+	{
+		PassiveTec = (uint8_t)((Esr & CAN_ESR_TEC) >> CAN_ESR_TEC_Pos);
+		PassiveRec = (uint8_t)((Esr & CAN_ESR_REC) >> CAN_ESR_REC_Pos);
+		PassiveCount += (PassiveCount < 0xFFU) ? 1U : 0U;
+	}
+	if (IsBusOff && !WasBusOff)
+	{
+		BusOffCount += (BusOffCount < 0xFFU) ? 1U : 0U;
+	}
+	WasPassive = IsPassive;
+	WasBusOff = IsBusOff;
+
+	/* The state is read back from ESR, the HAL error code is only a latch */
+	HAL_CAN_ResetError(UpdaterCan);
+}
+
+void SRV_UPDATER_SetBudget(uint32_t HalfWords)
+{
+	ProgramBudget = HalfWords;
+}
+
+uint8_t SRV_UPDATER_GetProgress(uint32_t *Frames, uint32_t *Total)
+{
+	*Frames = ReceivedFrameCount;
+	*Total = SessionFrames;
+	return (SessionState == SESSION_IMAGE) || (SessionState == SESSION_HEADER);
+}
+
+void SRV_UPDATER_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data)
+{
+	uint32_t Start;
+	uint32_t Stored;
+
+	if (Header->IDE != CAN_ID_STD)
+	{
+		return;
+	}
+
+	if ((Header->StdId & ~DATA_FRAME_SEQ_MASK) == (DATA_FRAME_ID & ~DATA_FRAME_SEQ_MASK) && Header->DLC == CHUNK_SIZE)
+	{
+		Start = SRV_BENCH_Now();
+		Stored = ReceivedFrameCount;
+		SRV_UPDATER_HandleData(Header, Data);
+		if ((SessionState == SESSION_BENCH) && ReceivedFrameCount != Stored)
+		{
+			SRV_BENCH_FrameDone(SRV_BENCH_Now() - Start);
+		}
+	}
+	else if (Header->StdId == CMD_FRAME_ID)
+	{
+		SRV_UPDATER_HandleCommand(Data, (uint8_t)Header->DLC);
+	}
+}
+
+uint8_t SRV_UPDATER_MainFunction(void)
+{
+	uint32_t PageIndex;
+	uint32_t PageBytes;
+	uint32_t Bytes;
+
+	if (LastAckQueued)
+	{
+		return SRV_UPDATER_LastAckSent();
+	}
+	if (StreamError)
+	{
+		SRV_UPDATER_Reject();
+		return FALSE;
+	}
+	if (!PagePending)
+	{
+		return FALSE;
+	}
+	if (SessionState == SESSION_HEADER)
+	{
+		SRV_UPDATER_OpenImage();
+		return FALSE;
+	}
+
+	if (PageStep == PAGE_STEP_ERASE)
+	{
+		if (StreamMode)
+		{
+			PageIndex = (OutputCount - 1) / FLASH_PAGE_SIZE;
+			PageBytes = StagedBytes;
+			if ((PageBytes % TWO_BYTE) != 0)
+			{
+				((uint8_t *)PageBuffer)[PageBytes++] = 0xFF;
+			}
+		}
+		else
+		{
+			PageIndex = (ReceivedFrameCount - FirstDataFrame - 1) / FRAMES_PER_PAGE;
+			PageBytes = (ReceivedFrameCount - FirstDataFrame - (PageIndex * FRAMES_PER_PAGE)) * CHUNK_SIZE;
+		}
+		PageAddress = TargetAddress + (PageIndex * FLASH_PAGE_SIZE);
+		PageHalfWords = PageBytes / TWO_BYTE;
+		ProgramIndex = 0;
+
+		PageStart = SRV_BENCH_Now();
+		MCAL_FPEC_EraseFlashArea(PageAddress, PageAddress);
+		PageStep = PAGE_STEP_PROGRAM;
+		/* The erase stalls the CPU for the whole page, the programming follows in the next calls */
+		if (ProgramBudget != 0U)
+		{
+			return FALSE;
+		}
+	}
+
+	if (PageStep == PAGE_STEP_PROGRAM)
+	{
+		if (!SRV_UPDATER_ProgramPage())
+		{
+			return FALSE;
+		}
+		PageStep = PAGE_STEP_ERASE;
+		if (SessionState == SESSION_BENCH)
+		{
+			SRV_BENCH_PageDone(SRV_BENCH_Now() - PageStart);
+		}
+		else if (!StreamMode)
+		{
+			SRV_JOURNAL_CommitPage((uint16_t)((PageAddress - TargetAddress) / FLASH_PAGE_SIZE));
+		}
+
+		if (StreamMode)
+		{
+			/* Decode the rest of the frame that filled the page before acknowledging it */
+			StagedBytes = 0;
+			if ((OutputCount < Image.Length) && !SRV_UPDATER_Expand(LeftoverInput, LeftoverLength))
+			{
+				StreamError = TRUE;
+				return FALSE;
+			}
+			if ((StagedBytes > 0) && (SRV_UPDATER_StagedPageComplete() || (ReceivedFrameCount >= SessionFrames)))
+			{
+				return FALSE;
+			}
+			/* The stream ended before the image was complete */
+			if ((ReceivedFrameCount >= SessionFrames) && (OutputCount < Image.Length))
+			{
+				StreamError = TRUE;
+				return FALSE;
+			}
+		}
+
+		if ((SessionState == SESSION_IMAGE) && (ReceivedFrameCount >= SessionFrames))
+		{
+			PageStep = PAGE_STEP_VERIFY;
+			VerifyOffset = 0;
+			VerifyCrc = CRC_INITIAL;
+		}
+	}
+
+	/* The last frame is only acknowledged when the slot holds the image of the header,
+	 * which then becomes the slot the bootloader starts. It is checked a page per call */
+	if (PageStep == PAGE_STEP_VERIFY)
+	{
+		do
+		{
+			Bytes = Image.Length - VerifyOffset;
+			if (Bytes > FLASH_PAGE_SIZE)
+			{
+				Bytes = FLASH_PAGE_SIZE;
+			}
+			VerifyCrc = SRV_CRC_Update(VerifyCrc, (const uint8_t *)(uintptr_t)(TargetAddress + VerifyOffset), Bytes);
+			VerifyOffset += Bytes;
+		} while ((ProgramBudget == 0U) && (VerifyOffset < Image.Length));
+		if (VerifyOffset < Image.Length)
+		{
+			return FALSE;
+		}
+		if (VerifyCrc != Image.ImageCrc)
+		{
+			SRV_JOURNAL_Close();
+			SRV_UPDATER_Reject();
+			return FALSE;
+		}
+		SRV_BOOTCTL_Activate(TargetSlot);
+		/* The record may take an erase, the journal takes one when closed */
+		PageStep = PAGE_STEP_ACK;
+		if (ProgramBudget != 0U)
+		{
+			return FALSE;
+		}
+	}
+	PageStep = PAGE_STEP_ERASE;
+
+	/* The ISR must not use the mailboxes while the held back ACK is queued */
+	__disable_irq();
+	PagePending = FALSE;
+	SRV_UPDATER_SendAck(PendingSeq, PendingTimestamp);
+	__enable_irq();
+
+	if (ReceivedFrameCount < SessionFrames)
+	{
+		return FALSE;
+	}
+
+	/* A benchmark payload is not an image, stay here for the result queries */
+	if (SessionState == SESSION_BENCH)
+	{
+		return FALSE;
+	}
+
+	SRV_JOURNAL_Close();
+	SessionState = SESSION_IDLE;
+	/* Let the last ACK leave the mailbox before the caller resets the MCU, checked again on the next calls */
+	LastAckQueued = TRUE;
+	LastAckTick = HAL_GetTick();
+	return SRV_UPDATER_LastAckSent();
+}
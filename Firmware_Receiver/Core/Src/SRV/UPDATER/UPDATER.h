@@ -0,0 +1,115 @@
+/*================================================================
+ *	Project Name: Firmware_Receiver
+ * 	File Name: UPDATER.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Receiving side of the firmware update protocol.
+ *
+ * Data frames are collected into a one page staging buffer. When a page
+ * is complete the ACK of its last frame is held back until the page was
+ * programmed and journaled, which throttles the sender to the flash
+ * speed. That frame is answered with ACK_FRAME_BUSY right away, and again
+ * for each of its retransmissions, so the sender waits for the page
+ * instead of timing out. Other frames that arrive meanwhile are dropped.
+ *
+ * An image session opens with CMD_IMAGE_START and the SRV/IMAGE header in
+ * the first data frames. The last header frame is acknowledged once the
+ * header was checked, the image length, encoding and checksum all come
+ * from it. A plain image is journaled under its checksum, so the sender
+ * can resume it after a reset, and the last frame of every image is only
+ * acknowledged when the slot holds the image of the header.
+ *
+ * Every session is programmed into the inactive slot of SRV/BOOTCTL, the
+ * header has to be linked for it. The image that is running stays intact
+ * until the new one is verified and recorded as active, just before the
+ * last acknowledge.
+ *
+ * A compressed image (IMAGE_FLAG_LZSS) is decoded straight into the
+ * staging buffer. The frame that fills a page is acknowledged once the
+ * page is programmed and the rest of the frame decoded into the next one.
+ * Its pages are not journaled, an interrupted compressed download starts
+ * over.
+ *
+ * A delta (IMAGE_FLAG_DELTA) is decoded the same way by SRV/DELTA, which
+ * reads the old image from the running slot.
+ *
+ * A sparse image (IMAGE_FLAG_SPARSE) is expanded by SRV/SPARSE like a
+ * compressed one. A fill that covers several pages is drained page by
+ * page from the main loop without another frame. Halfwords left erased
+ * (0xFFFF) are never programmed, so erased runs cost only the page erase.
+ *
+ * The main function does the work of a page in steps: the erase, the
+ * programming of SRV_UPDATER_SetBudget half-words per call and, after the
+ * last page, the check of the image a page per call. Without a budget a
+ * page is erased and programmed in one call, as the standalone receiver
+ * does. With one, an application keeps its main loop running during an
+ * update; only the page erase (20 to 40ms) stalls it, the CPU cannot fetch
+ * from the flash bank while it is erased.
+ */
+#ifndef UPDATER_H_
+#define UPDATER_H_
+
+#include "main.h"
+
+/**
+ * @brief Initialize the updater, it waits for CMD_IMAGE_START or CMD_BENCH_START.
+ *
+ * @param Can Handle of the CAN peripheral used to answer the sender.
+ * @return None
+ */
+void SRV_UPDATER_Init(CAN_HandleTypeDef *Can);
+
+/**
+ * @brief Process one received CAN frame (data or command).
+ *
+ * @details To be called from HAL_CAN_RxFifo0MsgPendingCallback.
+ *
+ * @param Header Header of the received frame.
+ * @param Data Payload of the received frame.
+ * @return None
+ */
+void SRV_UPDATER_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data);
+
+/**
+ * @brief Record the error state of the controller, answered to CMD_READ_LINK.
+ *
+ * @details To be called from HAL_CAN_ErrorCallback with the error passive and
+ * bus-off interrupts enabled. The HAL error code is reset.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_UPDATER_ErrorIndication(void);
+
+/**
+ * @brief Program the staged page when it is complete.
+ *
+ * @details To be called cyclically from the main loop. Each call erases one
+ * page, or programs up to the budget, or checks one page of the image.
+ *
+ * @param None
+ * @return uint8_t TRUE once the whole image is programmed and the last ACK was sent,
+ * or aborted after 20ms without a sender on the bus.
+ */
+uint8_t SRV_UPDATER_MainFunction(void);
+
+/**
+ * @brief Limit the flash programming done by one call of SRV_UPDATER_MainFunction.
+ *
+ * @param HalfWords Half-words programmed per call (52.5us each), 0 to program a page per call.
+ * @return None
+ */
+void SRV_UPDATER_SetBudget(uint32_t HalfWords);
+
+/**
+ * @brief Get the progress of the image session.
+ *
+ * @param Frames Receives the frames received, the header included.
+ * @param Total Receives the frames of the session, known once the header is accepted.
+ * @return uint8_t TRUE while an image session is open.
+ */
+uint8_t SRV_UPDATER_GetProgress(uint32_t *Frames, uint32_t *Total);
+
+#endif /* UPDATER_H_ */
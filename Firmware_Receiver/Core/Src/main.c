@@ -6,17 +6,30 @@
   */
 /*
  *   |============================|0x08000000
- *   |         Bootloader         |               >>> 25KB
+ *   |         Bootloader         |               >>> 8KB
+ *   |============================|0x08002000
+ *   |  Bootloader (HAL) or free  |               >>> 17KB
  *   |============================|0x08006400
- *   | 	 Firmware Receiver        |			      >>> 30KB
+ *   |     Firmware Receiver      |               >>> 29KB
+ *   |============================|0x0800d800
+ *   | Download journal (JOURNAL) |               >>> 1KB
  *   |============================|0x0800dc00
- *   |         New Firmware       |			      >>> 30KB
+ *   |   New Firmware (slot A)    |               >>> 30KB
  *   |============================|0x08015400
+ *   |   New Firmware (slot B)    |               >>> 30KB
+ *   |============================|0x0801cc00
+ *   |            Free            |               >>> 11KB
+ *   |============================|0x0801f800
+ *   | Boot control (SRV/BOOTCTL) |               >>> 2KB
+ *   |============================|0x08020000
 */
 
 #include "main.h"
 #include "HAL/LED/LED.h"
 #include "MCAL/FPEC/FPEC.h"
+#include "SRV/UPDATER/UPDATER.h"
+#include "SRV/TRACE/TRACE.h"
+#include "SRV/BOOTMBX/BOOTMBX.h"
 
 
 
@@ -28,16 +41,6 @@ CAN_FilterTypeDef FilterConfig;/* - Configuration for CAN message filtering sett
 CAN_RxHeaderTypeDef RxHeader;  /* - Header information of received CAN messages. */
 uint8_t RxData[8];			   /* - An array to store received CAN message data, with a maximum length of 8 bytes. */
 /*====================================================================================================================*/
-/*Sender Configurations*/
-CAN_TxHeaderTypeDef TxHeader;  /* - Header information for CAN messages to be transmitted. */
-uint8_t TxData[8] = {0x1F};    /* ACK frame data*/
-uint32_t TxMailbox;            /* - Stores the mailbox number where a transmitted CAN message is placed. */
-/*====================================================================================================================*/
-
-uint8_t isFlashed = FALSE;
-uint8_t dataToWrite[APPLICATION_SIZE] = {0x00};
-volatile uint32_t ReceivedFrameCount = 0;
-volatile uint32_t dataCheck = 0;
 
 void resetTxMailbox(CAN_HandleTypeDef* hcan, uint32_t mailbox) {
 
@@ -48,56 +51,43 @@ void resetTxMailbox(CAN_HandleTypeDef* hcan, uint32_t mailbox) {
 /* Function to perform a software reset */
 static void SoftwareReset(void)
 {
-    /* Perform a software reset using NVIC_SystemReset() */
-    NVIC_SystemReset();
+    /* Reset with a request in the boot mailbox: the bootloader starts the slot just
+       activated right away, without its menu and without waiting for button 2 */
+    SRV_BOOTMBX_Request(BOOTMBX_CMD_START);
 }
 /*====================================================================================================================*/
 /*                                            Rx Handler                                                              */
 /*====================================================================================================================*/
-void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
+void CAN_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data)
 {
 	HAL_GPIO_WritePin(GPIOC, LED_BLUE, GPIO_PIN_SET);
 
+    SRV_UPDATER_RxIndication(Header, Data);
+}
+
+#if RAM_VECTORS_ENABLE == 0
+/* The SRAM build reads FIFO 0 in stm32f1xx_it.c and calls CAN_RxIndication from PendSV */
+void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
+{
     if (HAL_CAN_GetRxMessage(hcan, CAN_RX_FIFO0, &RxHeader, RxData) != HAL_OK)
     {
         Error_Handler();
         return;
     }
 
-    if (RxHeader.StdId == 0x123 && RxHeader.DLC == 8)
-        {
-            /* Calculate the index to start storing data in the buffer */
-            uint32_t startIndex = ReceivedFrameCount * 8;
-
-            /* Copy the received data into the buffer starting from the calculated index */
-            for (uint8_t i = 0; i < 8; i++)
-            {
-                dataToWrite[startIndex + i] = RxData[i];
-            }
-
-            ReceivedFrameCount++;
-
-            /* Send an ACK frame */
-            TxHeader.IDE = CAN_ID_STD;
-            TxHeader.StdId = 0x456; /* ACK frame ID */
-            TxHeader.RTR = CAN_RTR_DATA;
-            TxHeader.DLC = 1; /* ACK frame DLC */
-            if (HAL_CAN_AddTxMessage(hcan, &TxHeader, TxData, &TxMailbox) != HAL_OK)
-            {
-                Error_Handler();
-            }
-
-            /* Check if the desired number of frames has been received */
-            if (ReceivedFrameCount >= (APPLICATION_SIZE / 8))
-            {
-                dataCheck = 1;
-                /* Disable CAN RX FIFO0 message pending interrupt since data reception is complete */
-                if (HAL_CAN_DeactivateNotification(hcan, CAN_IT_RX_FIFO0_MSG_PENDING) != HAL_OK)
-                {
-                    Error_Handler();
-                }
-            }
-        }
+    CAN_RxIndication(&RxHeader, RxData);
+}
+#endif
+
+/*====================================================================================================================*/
+/*                                            Error Handler                                                           */
+/*====================================================================================================================*/
+void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan)
+{
+    /* Bus-off recovery is done by the controller after 128x11 recessive bits,
+       the ACKs held in the mailboxes go out again once it rejoins the bus.
+       TEC, REC and the error passive and bus-off entries are read with CMD_READ_LINK. */
+    SRV_UPDATER_ErrorIndication();
 }
 /*====================================================================================================================*/
 /*                                           Private function prototypes                                              */
@@ -123,9 +113,16 @@ int main(void)
   MX_NVIC_Init();
   MX_CAN_Init();
   MCAL_FPEC_Init();
+#if RAM_VECTORS_ENABLE == 0
   SCB->VTOR = RECEIVER_APPLICATION_START_ADDRESS;
+#endif
 /*====================================================================================================================*/
   HAL_GPIO_WritePin(GPIOC, LED_GREEN, GPIO_PIN_SET);
+/*====================================================================================================================*/
+  /* Restore the progress of an interrupted download from the journal */
+  SRV_UPDATER_Init(&hcan);
+  /* Latency histograms, compiled out unless TRACE_ENABLE is set in TRACE_Cfg.h */
+  SRV_TRACE_Init(&hcan);
 /*====================================================================================================================*/
   /* Configure CAN Filter */
   FilterConfig.FilterActivation = ENABLE;
@@ -136,38 +133,37 @@ int main(void)
   /* Set the filter identifier and mask for the ACK frame from the receiver */
   FilterConfig.FilterIdHigh = (DATA_FRAME_ID << 5);
   FilterConfig.FilterIdLow = 0x0000;
-  FilterConfig.FilterMaskIdHigh = (0xFFFF << 5); /*Mask all bits of the ID*/
+  FilterConfig.FilterMaskIdHigh = ((0x7FF & ~DATA_FRAME_SEQ_MASK) << 5); /*Mask all bits of the ID but the sequence bit*/
   FilterConfig.FilterMaskIdLow = 0x0000;
 
   if (HAL_CAN_ConfigFilter(&hcan, &FilterConfig) != HAL_OK)
   {
       Error_Handler();
   }
+  /* Second bank for the commands of the control channel */
+  FilterConfig.FilterBank = 1;
+  FilterConfig.FilterIdHigh = (CMD_FRAME_ID << 5);
+  FilterConfig.FilterMaskIdHigh = (0x7FF << 5);
+  if (HAL_CAN_ConfigFilter(&hcan, &FilterConfig) != HAL_OK)
+  {
+      Error_Handler();
+  }
 /*====================================================================================================================*/
 
-  /* Enable CAN RX FIFO0 message pending interrupt */
-  if (HAL_CAN_ActivateNotification(&hcan, CAN_IT_RX_FIFO0_MSG_PENDING) != HAL_OK)
+  /* Enable CAN RX FIFO0 message pending and error interrupts */
+  if (HAL_CAN_ActivateNotification(&hcan, CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_ERROR_WARNING | CAN_IT_ERROR_PASSIVE |
+                                          CAN_IT_BUSOFF | CAN_IT_LAST_ERROR_CODE | CAN_IT_ERROR) != HAL_OK)
   {
       Error_Handler();
   }
   HAL_CAN_Start(&hcan);
   while (1)
       {
-          if (dataCheck == 1)
+          /* Program each page as soon as it is complete, reset once the image is in flash */
+          if (SRV_UPDATER_MainFunction() == TRUE)
           {
-              if (!isFlashed)
-              {
-                  /* Erase a section of Flash memory */
-                  MCAL_FPEC_EraseFlashArea(NEW_FIRMWARE_START_ADDRESS, NEW_FIRMWARE_END_ADDRESS);
-                  /* Write data to Flash memory */
-                  MCAL_FPEC_FlashWrite(NEW_FIRMWARE_START_ADDRESS, (uint16_t*)dataToWrite, APPLICATION_SIZE);
-                  isFlashed = 1;
-                  dataCheck = 0;
-                  SoftwareReset();
-              }
+              SoftwareReset();
           }
-
-
       }
 }
 
@@ -215,6 +211,13 @@ static void MX_NVIC_Init(void)
   /* USB_LP_CAN1_RX0_IRQn interrupt configuration */
   HAL_NVIC_SetPriority(USB_LP_CAN1_RX0_IRQn, 0, 0);
   HAL_NVIC_EnableIRQ(USB_LP_CAN1_RX0_IRQn);
+  /* CAN1_SCE_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(CAN1_SCE_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(CAN1_SCE_IRQn);
+#if RAM_VECTORS_ENABLE == 1
+  /* The RX0 interrupt hands its frames over in PendSV, below every interrupt */
+  HAL_NVIC_SetPriority(PendSV_IRQn, 15, 0);
+#endif
 }
 /**
   * @brief CAN Initialization Function
@@ -229,10 +232,14 @@ static void MX_CAN_Init(void)
   hcan.Init.SyncJumpWidth = CAN_SJW_1TQ;
   hcan.Init.TimeSeg1 = CAN_BS1_2TQ;
   hcan.Init.TimeSeg2 = CAN_BS2_2TQ;
+#if TRACE_ENABLE == 1
+  hcan.Init.TimeTriggeredMode = ENABLE;  /* Hardware timestamps in RDTxR/TDTxR for SRV/TRACE */
+#else
   hcan.Init.TimeTriggeredMode = DISABLE;
-  hcan.Init.AutoBusOff = DISABLE;
+#endif
+  hcan.Init.AutoBusOff = ENABLE;  /* Rejoin the bus after 128x11 recessive bits without software */
   hcan.Init.AutoWakeUp = DISABLE;
-  hcan.Init.AutoRetransmission = DISABLE;
+  hcan.Init.AutoRetransmission = ENABLE; /* A lost arbitration or bus error must not silently drop an ACK */
   hcan.Init.ReceiveFifoLocked = DISABLE;
   hcan.Init.TransmitFifoPriority = ENABLE;
   if (HAL_CAN_Init(&hcan) != HAL_OK)
@@ -23,6 +23,7 @@
 #include "stm32f1xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "SRV/TRACE/TRACE.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -42,6 +43,19 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN PV */
+/* Worst entry latency of SysTick_Handler in core cycles, counted by SysTick since its
+   reload. Read it with a debugger to compare the RAM_VECTORS_ENABLE builds */
+uint32_t tickEntryCyclesMax = 0;
+
+#if RAM_VECTORS_ENABLE == 1
+/* System exceptions and the IRQs up to USBWakeUp */
+#define VECTOR_TABLE_WORDS (16U + (uint32_t)USBWakeUp_IRQn + 1U)
+/* Filled by the startup code, VTOR needs the power of two above the table size as alignment */
+uint32_t ramVectors[VECTOR_TABLE_WORDS] __attribute__((section(".ram_vector"), aligned(256)));
+
+/* Frames of FIFO 0 read by the RX0 interrupt, processed in PendSV_Handler */
+static RAM_RxQueue_t RxQueue;
+#endif
 
 /* USER CODE END PV */
 
@@ -52,6 +66,27 @@
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+#if RAM_VECTORS_ENABLE == 1
+/* Tick counter of stm32f1xx_hal.c */
+extern __IO uint32_t uwTick;
+
+/**
+  * @brief The tick of the HAL, replaces its weak definition to run from the SRAM.
+  */
+RAM_ISR void HAL_IncTick(void)
+{
+  uwTick += (uint32_t)uwTickFreq;
+}
+
+/**
+  * @brief A frame HAL_CAN_IRQHandler finds in FIFO 0 from the SCE interrupt goes
+  *        to the queue as well, both CAN interrupts have the same priority.
+  */
+void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
+{
+  RAM_CanRxFifo0(&RxQueue);
+}
+#endif
 
 /* USER CODE END 0 */
 
@@ -169,6 +204,10 @@ void DebugMon_Handler(void)
 void PendSV_Handler(void)
 {
   /* USER CODE BEGIN PendSV_IRQn 0 */
+#if RAM_VECTORS_ENABLE == 1
+  /* Lowest priority, the protocol runs here with every interrupt free to preempt it */
+  RAM_CanRxDrain(&RxQueue, CAN_RxIndication);
+#endif
 
   /* USER CODE END PendSV_IRQn 0 */
   /* USER CODE BEGIN PendSV_IRQn 1 */
@@ -179,9 +218,15 @@ void PendSV_Handler(void)
 /**
   * @brief This function handles System tick timer.
   */
-void SysTick_Handler(void)
+RAM_ISR void SysTick_Handler(void)
 {
   /* USER CODE BEGIN SysTick_IRQn 0 */
+  uint32_t Cycles = SysTick->LOAD - SysTick->VAL;
+
+  if (Cycles > tickEntryCyclesMax)
+  {
+    tickEntryCyclesMax = Cycles;
+  }
 
   /* USER CODE END SysTick_IRQn 0 */
   HAL_IncTick();
@@ -200,17 +245,36 @@ void SysTick_Handler(void)
 /**
   * @brief This function handles USB low priority or CAN RX0 interrupts.
   */
-void USB_LP_CAN1_RX0_IRQHandler(void)
+RAM_ISR void USB_LP_CAN1_RX0_IRQHandler(void)
 {
   /* USER CODE BEGIN USB_LP_CAN1_RX0_IRQn 0 */
+  SRV_TRACE_IrqEntry();
 
   /* USER CODE END USB_LP_CAN1_RX0_IRQn 0 */
+#if RAM_VECTORS_ENABLE == 1
+  RAM_CanRxFifo0(&RxQueue);
+#else
   HAL_CAN_IRQHandler(&hcan);
+#endif
   /* USER CODE BEGIN USB_LP_CAN1_RX0_IRQn 1 */
 
   /* USER CODE END USB_LP_CAN1_RX0_IRQn 1 */
 }
 
+/**
+  * @brief This function handles CAN SCE interrupt.
+  */
+void CAN1_SCE_IRQHandler(void)
+{
+  /* USER CODE BEGIN CAN1_SCE_IRQn 0 */
+
+  /* USER CODE END CAN1_SCE_IRQn 0 */
+  HAL_CAN_IRQHandler(&hcan);
+  /* USER CODE BEGIN CAN1_SCE_IRQn 1 */
+
+  /* USER CODE END CAN1_SCE_IRQn 1 */
+}
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
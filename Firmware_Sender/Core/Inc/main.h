@@ -26,14 +26,27 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f1xx_hal.h"
 
-#define APPLICATION_SIZE  6856
-extern uint8_t dataToWrite[APPLICATION_SIZE];
-
-/* Define the chunk size for data transmission */
-#define CHUNK_SIZE 8
-/* CAN message IDs */
-#define DATA_FRAME_ID 0x123
-#define ACK_FRAME_ID 0x456
+/* A data frame in the layout of a bxCAN transmit mailbox, stored into one as it is */
+typedef struct
+{
+    uint32_t TIR;     /* Identifier with the sequence bit of the frame, TXRQ set */
+    uint32_t TDTR;    /* DLC */
+    uint32_t TDLR;    /* Bytes 0..3, little endian */
+    uint32_t TDHR;    /* Bytes 4..7 */
+} TxFrame_t;
+
+/* Image to send: the header the receiver sizes the session from, then the image.
+   Written by HostFlasher/ImagePacker, one record per data frame. dataToWriteSize
+   counts the session bytes, the last frame is padded with 0xFF. */
+extern const TxFrame_t dataToWrite[];
+extern const uint32_t dataToWriteSize;
+/* Size of the header at the start of dataToWrite, see SRV/IMAGE of Firmware_Receiver */
+#define IMAGE_HEADER_SIZE 40U
+
+/* CAN protocol and flash layout of Firmware_Receiver/Core/Src/LIB/Protocol, shared by every image */
+#include "LIB/Protocol/Protocol.h"
+/* Data frame identifier carrying the sequence bit of the frame, the ACK echoes the bit in its second byte */
+#define DATA_FRAME_ID_SEQ(FRAME) (DATA_FRAME_ID ^ ((FRAME) & DATA_FRAME_SEQ_MASK))
 
 /* Exported functions prototypes ---------------------------------------------*/
 void Error_Handler(void);
@@ -1,227 +1,918 @@
 /*================================================================
  *	Project Name: CANtx
  * 	File Name: Application-HEX.c
- * 	Created on: Sep 26, 2023
- * 	Author: HELMY-PC
  *================================================================
+ * Generated by HostFlasher/ImagePacker, do not edit.
+ *
+ * One record per data frame, the words stored into a bxCAN transmit
+ * mailbox: TIR with the sequence bit and TXRQ, TDTR, TDLR and TDHR.
  */
 #include "main.h"
-#define APPLICATION_SIZE  6856
 
-uint8_t dataToWrite[APPLICATION_SIZE] = {
-    0x00, 0x50, 0x00, 0x20, 0xad, 0x2f, 0x00, 0x08, 0xf1, 0x2e, 0x00, 0x08, 0xfd, 0x2e, 0x00, 0x08, 0x03, 0x2f, 0x00, 0x08, 0x09, 0x2f, 0x00, 0x08, 0x0f, 0x2f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2f, 0x00, 0x08, 0x21, 0x2f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x2f, 0x00, 0x08, 0x39, 0x2f, 0x00, 0x08,
-    0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08,
-    0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08,
-    0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08,
-    0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08,
-    0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08,
-    0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0xf5, 0x2f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf8, 0x08, 0xf1, 0x10, 0xb5, 0x05, 0x4c, 0x23, 0x78, 0x33, 0xb9, 0x04, 0x4b, 0x13, 0xb1, 0x04, 0x48, 0xaf, 0xf3, 0x00, 0x80, 0x01, 0x23,
-    0x23, 0x70, 0x10, 0xbd, 0x0c, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x08, 0x08, 0xb5, 0x03, 0x4b, 0x1b, 0xb1, 0x03, 0x49, 0x03, 0x48, 0xaf, 0xf3, 0x00, 0x80, 0x08, 0xbd,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x5c, 0x42, 0x00, 0x08, 0x80, 0xb4, 0x83, 0xb0, 0x00, 0xaf, 0x03, 0x46, 0xfb, 0x80, 0x08, 0x4b, 0x1b, 0x68, 0x00, 0x22, 0x5a, 0x62, 0x00, 0xbf,
-    0x05, 0x4b, 0x1b, 0x68, 0x5a, 0x6a, 0xfb, 0x88, 0x9a, 0x42, 0xf9, 0xd3, 0x00, 0xbf, 0x0c, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x00, 0xbf, 0x28, 0x00, 0x00, 0x20, 0x80, 0xb5, 0x82, 0xb0,
-    0x00, 0xaf, 0x03, 0x46, 0x39, 0x60, 0xfb, 0x71, 0x3b, 0x68, 0xdb, 0xb2, 0x1a, 0x46, 0x4f, 0xf4, 0x00, 0x61, 0x23, 0x48, 0x00, 0xf0, 0xf2, 0xfd, 0xfb, 0x79, 0xdb, 0x08, 0xdb, 0xb2, 0x03, 0xf0,
-    0x01, 0x03, 0xdb, 0xb2, 0x1a, 0x46, 0x4f, 0xf4, 0x80, 0x51, 0x1e, 0x48, 0x00, 0xf0, 0xe6, 0xfd, 0xfb, 0x79, 0x9b, 0x08, 0xdb, 0xb2, 0x03, 0xf0, 0x01, 0x03, 0xdb, 0xb2, 0x1a, 0x46, 0x4f, 0xf4,
-    0x00, 0x51, 0x18, 0x48, 0x00, 0xf0, 0xda, 0xfd, 0xfb, 0x79, 0x5b, 0x08, 0xdb, 0xb2, 0x03, 0xf0, 0x01, 0x03, 0xdb, 0xb2, 0x1a, 0x46, 0x4f, 0xf4, 0x80, 0x41, 0x12, 0x48, 0x00, 0xf0, 0xce, 0xfd,
-    0xfb, 0x79, 0x03, 0xf0, 0x01, 0x03, 0xdb, 0xb2, 0x1a, 0x46, 0x4f, 0xf4, 0x00, 0x41, 0x0d, 0x48, 0x00, 0xf0, 0xc4, 0xfd, 0x01, 0x22, 0x4f, 0xf4, 0x80, 0x71, 0x09, 0x48, 0x00, 0xf0, 0xbe, 0xfd,
-    0x14, 0x20, 0xff, 0xf7, 0xa3, 0xff, 0x00, 0x22, 0x4f, 0xf4, 0x80, 0x71, 0x04, 0x48, 0x00, 0xf0, 0xb5, 0xfd, 0x14, 0x20, 0xff, 0xf7, 0x9a, 0xff, 0x00, 0xbf, 0x08, 0x37, 0xbd, 0x46, 0x80, 0xbd,
-    0x00, 0x08, 0x01, 0x40, 0x00, 0x0c, 0x01, 0x40, 0x80, 0xb5, 0x84, 0xb0, 0x00, 0xaf, 0x03, 0x46, 0xfb, 0x71, 0xfb, 0x79, 0x1b, 0x09, 0xfb, 0x73, 0xfb, 0x7b, 0x00, 0x21, 0x18, 0x46, 0xff, 0xf7,
-    0x9d, 0xff, 0xfb, 0x79, 0x03, 0xf0, 0x0f, 0x03, 0xfb, 0x73, 0xfb, 0x7b, 0x00, 0x21, 0x18, 0x46, 0xff, 0xf7, 0x94, 0xff, 0x00, 0xbf, 0x10, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x80, 0xb5, 0x84, 0xb0,
-    0x00, 0xaf, 0x03, 0x46, 0xfb, 0x71, 0xfb, 0x79, 0x1b, 0x09, 0xfb, 0x73, 0xfb, 0x7b, 0x01, 0x21, 0x18, 0x46, 0xff, 0xf7, 0x83, 0xff, 0xfb, 0x79, 0x03, 0xf0, 0x0f, 0x03, 0xfb, 0x73, 0xfb, 0x7b,
-    0x01, 0x21, 0x18, 0x46, 0xff, 0xf7, 0x7a, 0xff, 0x00, 0xbf, 0x10, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x80, 0xb5, 0x00, 0xaf, 0x01, 0x20, 0xff, 0xf7, 0xc7, 0xff, 0x02, 0x20, 0x00, 0xf0, 0x0e, 0xfb,
-    0x00, 0xbf, 0x80, 0xbd, 0x80, 0xb5, 0x82, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x39, 0x60, 0x7b, 0x68, 0x00, 0x2b, 0x02, 0xd0, 0x01, 0x2b, 0x05, 0xd0, 0x09, 0xe0, 0x3b, 0x68, 0x43, 0xf0, 0x80, 0x03,
-    0x3b, 0x60, 0x04, 0xe0, 0x3b, 0x68, 0x43, 0xf0, 0xc0, 0x03, 0x3b, 0x60, 0x00, 0xbf, 0x3b, 0x68, 0xdb, 0xb2, 0x18, 0x46, 0xff, 0xf7, 0xa8, 0xff, 0x00, 0xbf, 0x08, 0x37, 0xbd, 0x46, 0x80, 0xbd,
-    0x80, 0xb5, 0x00, 0xaf, 0x32, 0x20, 0x00, 0xf0, 0xe9, 0xfa, 0x30, 0x20, 0xff, 0xf7, 0x9c, 0xff, 0x05, 0x20, 0x00, 0xf0, 0xe3, 0xfa, 0x30, 0x20, 0xff, 0xf7, 0x96, 0xff, 0x01, 0x20, 0x00, 0xf0,
-    0xdd, 0xfa, 0x30, 0x20, 0xff, 0xf7, 0x90, 0xff, 0x0a, 0x20, 0x00, 0xf0, 0xd7, 0xfa, 0x20, 0x20, 0xff, 0xf7, 0x8a, 0xff, 0x0a, 0x20, 0x00, 0xf0, 0xd1, 0xfa, 0x28, 0x20, 0xff, 0xf7, 0x84, 0xff,
-    0x01, 0x20, 0x00, 0xf0, 0xcb, 0xfa, 0x08, 0x20, 0xff, 0xf7, 0x7e, 0xff, 0x01, 0x20, 0x00, 0xf0, 0xc5, 0xfa, 0x01, 0x20, 0xff, 0xf7, 0x78, 0xff, 0x01, 0x20, 0x00, 0xf0, 0xbf, 0xfa, 0x01, 0x20,
-    0x00, 0xf0, 0xbc, 0xfa, 0x06, 0x20, 0xff, 0xf7, 0x6f, 0xff, 0x01, 0x20, 0x00, 0xf0, 0xb6, 0xfa, 0x0c, 0x20, 0xff, 0xf7, 0x69, 0xff, 0x00, 0xbf, 0x80, 0xbd, 0x80, 0xb5, 0x82, 0xb0, 0x00, 0xaf,
-    0x78, 0x60, 0x06, 0xe0, 0x7b, 0x68, 0x5a, 0x1c, 0x7a, 0x60, 0x1b, 0x78, 0x18, 0x46, 0xff, 0xf7, 0x75, 0xff, 0x7b, 0x68, 0x1b, 0x78, 0x00, 0x2b, 0xf4, 0xd1, 0x00, 0xbf, 0x08, 0x37, 0xbd, 0x46,
-    0x80, 0xbd, 0x80, 0xb5, 0x00, 0xaf, 0x00, 0x20, 0x00, 0xf0, 0x0e, 0xf8, 0x00, 0x20, 0x00, 0xf0, 0x0b, 0xf8, 0x00, 0x20, 0x00, 0xf0, 0x08, 0xf8, 0x04, 0x20, 0x00, 0xf0, 0x05, 0xf8, 0x02, 0x20,
-    0x00, 0xf0, 0x02, 0xf8, 0x00, 0xbf, 0x80, 0xbd, 0x80, 0xb5, 0x82, 0xb0, 0x00, 0xaf, 0x03, 0x46, 0xfb, 0x71, 0xfb, 0x79, 0x02, 0x2b, 0x02, 0xd0, 0x04, 0x2b, 0x00, 0xd0, 0x07, 0xe0, 0xfb, 0x79,
-    0x9b, 0xb2, 0x00, 0x22, 0x19, 0x46, 0x04, 0x48, 0x00, 0xf0, 0xd8, 0xfc, 0x00, 0xbf, 0x00, 0xbf, 0x08, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x00, 0xbf, 0x00, 0x08, 0x01, 0x40, 0x80, 0xb5, 0x00, 0xaf,
-    0x00, 0xf0, 0x0a, 0xfa, 0x00, 0xf0, 0x2a, 0xf8, 0x00, 0xf0, 0xa6, 0xf8, 0xff, 0xf7, 0xc9, 0xff, 0x00, 0xf0, 0x60, 0xf8, 0x0d, 0x48, 0x01, 0xf0, 0xee, 0xf8, 0xff, 0xf7, 0x71, 0xff, 0xff, 0xf7,
-    0x47, 0xff, 0x00, 0x21, 0x00, 0x20, 0xff, 0xf7, 0x4d, 0xff, 0x09, 0x48, 0xff, 0xf7, 0xa5, 0xff, 0x04, 0x21, 0x01, 0x20, 0xff, 0xf7, 0x46, 0xff, 0x06, 0x48, 0xff, 0xf7, 0x9e, 0xff, 0x01, 0x22,
-    0x4f, 0xf4, 0x80, 0x41, 0x04, 0x48, 0x00, 0xf0, 0xa9, 0xfc, 0xfe, 0xe7, 0x28, 0x00, 0x00, 0x20, 0x74, 0x42, 0x00, 0x08, 0x84, 0x42, 0x00, 0x08, 0x00, 0x10, 0x01, 0x40, 0x80, 0xb5, 0x90, 0xb0,
-    0x00, 0xaf, 0x07, 0xf1, 0x18, 0x03, 0x28, 0x22, 0x00, 0x21, 0x18, 0x46, 0x01, 0xf0, 0xfe, 0xfa, 0x3b, 0x1d, 0x00, 0x22, 0x1a, 0x60, 0x5a, 0x60, 0x9a, 0x60, 0xda, 0x60, 0x1a, 0x61, 0x02, 0x23,
-    0xbb, 0x61, 0x01, 0x23, 0xbb, 0x62, 0x10, 0x23, 0xfb, 0x62, 0x00, 0x23, 0x7b, 0x63, 0x07, 0xf1, 0x18, 0x03, 0x18, 0x46, 0x00, 0xf0, 0x9a, 0xfc, 0x03, 0x46, 0x00, 0x2b, 0x01, 0xd0, 0x00, 0xf0,
-    0xe1, 0xf8, 0x0f, 0x23, 0x7b, 0x60, 0x00, 0x23, 0xbb, 0x60, 0x00, 0x23, 0xfb, 0x60, 0x00, 0x23, 0x3b, 0x61, 0x00, 0x23, 0x7b, 0x61, 0x3b, 0x1d, 0x00, 0x21, 0x18, 0x46, 0x00, 0xf0, 0x06, 0xff,
-    0x03, 0x46, 0x00, 0x2b, 0x01, 0xd0, 0x00, 0xf0, 0xcd, 0xf8, 0x00, 0xbf, 0x40, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x00, 0x00, 0x80, 0xb5, 0x86, 0xb0, 0x00, 0xaf, 0x07, 0xf1, 0x08, 0x03, 0x00, 0x22,
-    0x1a, 0x60, 0x5a, 0x60, 0x9a, 0x60, 0xda, 0x60, 0x3b, 0x46, 0x00, 0x22, 0x1a, 0x60, 0x5a, 0x60, 0x17, 0x4b, 0x18, 0x4a, 0x1a, 0x60, 0x16, 0x4b, 0x47, 0x22, 0x5a, 0x60, 0x14, 0x4b, 0x00, 0x22,
-    0x9a, 0x60, 0x13, 0x4b, 0x4f, 0xf6, 0xfe, 0x72, 0xda, 0x60, 0x11, 0x4b, 0x00, 0x22, 0x1a, 0x61, 0x0f, 0x4b, 0x00, 0x22, 0x5a, 0x61, 0x0e, 0x4b, 0x00, 0x22, 0x9a, 0x61, 0x0c, 0x48, 0x01, 0xf0,
-    0x3f, 0xf8, 0x4f, 0xf4, 0x80, 0x53, 0xbb, 0x60, 0x07, 0xf1, 0x08, 0x03, 0x19, 0x46, 0x08, 0x48, 0x01, 0xf0, 0x84, 0xf8, 0x00, 0x23, 0x3b, 0x60, 0x00, 0x23, 0x7b, 0x60, 0x3b, 0x46, 0x19, 0x46,
-    0x03, 0x48, 0x01, 0xf0, 0x2b, 0xfa, 0x00, 0xbf, 0x18, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x00, 0xbf, 0x28, 0x00, 0x00, 0x20, 0x00, 0x2c, 0x01, 0x40, 0x80, 0xb5, 0x88, 0xb0, 0x00, 0xaf, 0x07, 0xf1,
-    0x10, 0x03, 0x00, 0x22, 0x1a, 0x60, 0x5a, 0x60, 0x9a, 0x60, 0xda, 0x60, 0x39, 0x4b, 0x9b, 0x69, 0x38, 0x4a, 0x43, 0xf0, 0x10, 0x03, 0x93, 0x61, 0x36, 0x4b, 0x9b, 0x69, 0x03, 0xf0, 0x10, 0x03,
-    0xfb, 0x60, 0xfb, 0x68, 0x33, 0x4b, 0x9b, 0x69, 0x32, 0x4a, 0x43, 0xf0, 0x20, 0x03, 0x93, 0x61, 0x30, 0x4b, 0x9b, 0x69, 0x03, 0xf0, 0x20, 0x03, 0xbb, 0x60, 0xbb, 0x68, 0x2d, 0x4b, 0x9b, 0x69,
-    0x2c, 0x4a, 0x43, 0xf0, 0x04, 0x03, 0x93, 0x61, 0x2a, 0x4b, 0x9b, 0x69, 0x03, 0xf0, 0x04, 0x03, 0x7b, 0x60, 0x7b, 0x68, 0x27, 0x4b, 0x9b, 0x69, 0x26, 0x4a, 0x43, 0xf0, 0x08, 0x03, 0x93, 0x61,
-    0x24, 0x4b, 0x9b, 0x69, 0x03, 0xf0, 0x08, 0x03, 0x3b, 0x60, 0x3b, 0x68, 0x00, 0x22, 0x4f, 0xf4, 0x60, 0x41, 0x21, 0x48, 0x00, 0xf0, 0xe2, 0xfb, 0x00, 0x22, 0x40, 0xf6, 0x06, 0x11, 0x1f, 0x48,
-    0x00, 0xf0, 0xdc, 0xfb, 0x00, 0x22, 0x4f, 0xf4, 0x70, 0x41, 0x1d, 0x48, 0x00, 0xf0, 0xd6, 0xfb, 0x4f, 0xf4, 0x60, 0x43, 0x3b, 0x61, 0x01, 0x23, 0x7b, 0x61, 0x00, 0x23, 0xbb, 0x61, 0x02, 0x23,
-    0xfb, 0x61, 0x07, 0xf1, 0x10, 0x03, 0x19, 0x46, 0x13, 0x48, 0x00, 0xf0, 0x6d, 0xfa, 0x40, 0xf6, 0x06, 0x13, 0x3b, 0x61, 0x01, 0x23, 0x7b, 0x61, 0x00, 0x23, 0xbb, 0x61, 0x02, 0x23, 0xfb, 0x61,
-    0x07, 0xf1, 0x10, 0x03, 0x19, 0x46, 0x0d, 0x48, 0x00, 0xf0, 0x5e, 0xfa, 0x4f, 0xf4, 0x70, 0x43, 0x3b, 0x61, 0x01, 0x23, 0x7b, 0x61, 0x00, 0x23, 0xbb, 0x61, 0x02, 0x23, 0xfb, 0x61, 0x07, 0xf1,
-    0x10, 0x03, 0x19, 0x46, 0x06, 0x48, 0x00, 0xf0, 0x4f, 0xfa, 0x00, 0xbf, 0x20, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x00, 0xbf, 0x00, 0x10, 0x02, 0x40, 0x00, 0x10, 0x01, 0x40, 0x00, 0x08, 0x01, 0x40,
-    0x00, 0x0c, 0x01, 0x40, 0x80, 0xb4, 0x00, 0xaf, 0x00, 0xbf, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb4, 0x85, 0xb0, 0x00, 0xaf, 0x15, 0x4b, 0x9b, 0x69, 0x14, 0x4a, 0x43, 0xf0, 0x01, 0x03,
-    0x93, 0x61, 0x12, 0x4b, 0x9b, 0x69, 0x03, 0xf0, 0x01, 0x03, 0xbb, 0x60, 0xbb, 0x68, 0x0f, 0x4b, 0xdb, 0x69, 0x0e, 0x4a, 0x43, 0xf0, 0x80, 0x53, 0xd3, 0x61, 0x0c, 0x4b, 0xdb, 0x69, 0x03, 0xf0,
-    0x80, 0x53, 0x7b, 0x60, 0x7b, 0x68, 0x0a, 0x4b, 0x5b, 0x68, 0xfb, 0x60, 0xfb, 0x68, 0x23, 0xf0, 0xe0, 0x63, 0xfb, 0x60, 0xfb, 0x68, 0x43, 0xf0, 0x00, 0x73, 0xfb, 0x60, 0x04, 0x4a, 0xfb, 0x68,
-    0x53, 0x60, 0x00, 0xbf, 0x14, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x00, 0x10, 0x02, 0x40, 0x00, 0x00, 0x01, 0x40, 0x80, 0xb4, 0x85, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x7b, 0x68, 0x1b, 0x68,
-    0x09, 0x4a, 0x93, 0x42, 0x0b, 0xd1, 0x09, 0x4b, 0x9b, 0x69, 0x08, 0x4a, 0x43, 0xf4, 0x00, 0x63, 0x93, 0x61, 0x06, 0x4b, 0x9b, 0x69, 0x03, 0xf4, 0x00, 0x63, 0xfb, 0x60, 0xfb, 0x68, 0x00, 0xbf,
-    0x14, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x00, 0x2c, 0x01, 0x40, 0x00, 0x10, 0x02, 0x40, 0x80, 0xb4, 0x00, 0xaf, 0x00, 0xbf, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb4, 0x00, 0xaf,
-    0xfe, 0xe7, 0x80, 0xb4, 0x00, 0xaf, 0xfe, 0xe7, 0x80, 0xb4, 0x00, 0xaf, 0xfe, 0xe7, 0x80, 0xb4, 0x00, 0xaf, 0xfe, 0xe7, 0x80, 0xb4, 0x00, 0xaf, 0x00, 0xbf, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47,
-    0x80, 0xb4, 0x00, 0xaf, 0x00, 0xbf, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb4, 0x00, 0xaf, 0x00, 0xbf, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb5, 0x00, 0xaf, 0x00, 0xf0, 0xa2, 0xf8,
-    0x00, 0xbf, 0x80, 0xbd, 0x80, 0xb4, 0x00, 0xaf, 0x15, 0x4b, 0x1b, 0x68, 0x14, 0x4a, 0x43, 0xf0, 0x01, 0x03, 0x13, 0x60, 0x12, 0x4b, 0x5a, 0x68, 0x11, 0x49, 0x12, 0x4b, 0x13, 0x40, 0x4b, 0x60,
-    0x0f, 0x4b, 0x1b, 0x68, 0x0e, 0x4a, 0x23, 0xf0, 0x84, 0x73, 0x23, 0xf4, 0x80, 0x33, 0x13, 0x60, 0x0b, 0x4b, 0x1b, 0x68, 0x0a, 0x4a, 0x23, 0xf4, 0x80, 0x23, 0x13, 0x60, 0x08, 0x4b, 0x5b, 0x68,
-    0x07, 0x4a, 0x23, 0xf4, 0xfe, 0x03, 0x53, 0x60, 0x05, 0x4b, 0x4f, 0xf4, 0x1f, 0x02, 0x9a, 0x60, 0x05, 0x4b, 0x4f, 0xf0, 0x00, 0x62, 0x9a, 0x60, 0x00, 0xbf, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47,
-    0x00, 0x10, 0x02, 0x40, 0x00, 0x00, 0xff, 0xf8, 0x00, 0xed, 0x00, 0xe0, 0x00, 0x21, 0x03, 0xe0, 0x0b, 0x4b, 0x5b, 0x58, 0x43, 0x50, 0x04, 0x31, 0x0a, 0x48, 0x0b, 0x4b, 0x42, 0x18, 0x9a, 0x42,
-    0xf6, 0xd3, 0x0a, 0x4a, 0x02, 0xe0, 0x00, 0x23, 0x42, 0xf8, 0x04, 0x3b, 0x08, 0x4b, 0x9a, 0x42, 0xf9, 0xd3, 0xff, 0xf7, 0xb7, 0xff, 0x01, 0xf0, 0x15, 0xf9, 0xff, 0xf7, 0xff, 0xfd, 0x70, 0x47,
-    0xbc, 0x42, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x0c, 0x00, 0x00, 0x20, 0x0c, 0x00, 0x00, 0x20, 0x6c, 0x00, 0x00, 0x20, 0xfe, 0xe7, 0x00, 0x00, 0x80, 0xb5, 0x00, 0xaf, 0x08, 0x4b, 0x1b, 0x68,
-    0x07, 0x4a, 0x43, 0xf0, 0x10, 0x03, 0x13, 0x60, 0x03, 0x20, 0x00, 0xf0, 0x29, 0xf9, 0x00, 0x20, 0x00, 0xf0, 0x08, 0xf8, 0xff, 0xf7, 0x1c, 0xff, 0x00, 0x23, 0x18, 0x46, 0x80, 0xbd, 0x00, 0xbf,
-    0x00, 0x20, 0x02, 0x40, 0x80, 0xb5, 0x82, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x12, 0x4b, 0x1a, 0x68, 0x12, 0x4b, 0x1b, 0x78, 0x19, 0x46, 0x4f, 0xf4, 0x7a, 0x73, 0xb3, 0xfb, 0xf1, 0xf3, 0xb2, 0xfb,
-    0xf3, 0xf3, 0x18, 0x46, 0x00, 0xf0, 0x33, 0xf9, 0x03, 0x46, 0x00, 0x2b, 0x01, 0xd0, 0x01, 0x23, 0x0e, 0xe0, 0x7b, 0x68, 0x0f, 0x2b, 0x0a, 0xd8, 0x00, 0x22, 0x79, 0x68, 0x4f, 0xf0, 0xff, 0x30,
-    0x00, 0xf0, 0x09, 0xf9, 0x06, 0x4a, 0x7b, 0x68, 0x13, 0x60, 0x00, 0x23, 0x00, 0xe0, 0x01, 0x23, 0x18, 0x46, 0x08, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x20,
-    0x04, 0x00, 0x00, 0x20, 0x80, 0xb4, 0x00, 0xaf, 0x05, 0x4b, 0x1b, 0x78, 0x1a, 0x46, 0x05, 0x4b, 0x1b, 0x68, 0x13, 0x44, 0x03, 0x4a, 0x13, 0x60, 0x00, 0xbf, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47,
-    0x08, 0x00, 0x00, 0x20, 0x68, 0x00, 0x00, 0x20, 0x80, 0xb4, 0x00, 0xaf, 0x02, 0x4b, 0x1b, 0x68, 0x18, 0x46, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x68, 0x00, 0x00, 0x20, 0x80, 0xb5, 0x84, 0xb0,
-    0x00, 0xaf, 0x78, 0x60, 0xff, 0xf7, 0xf0, 0xff, 0xb8, 0x60, 0x7b, 0x68, 0xfb, 0x60, 0xfb, 0x68, 0xb3, 0xf1, 0xff, 0x3f, 0x05, 0xd0, 0x09, 0x4b, 0x1b, 0x78, 0x1a, 0x46, 0xfb, 0x68, 0x13, 0x44,
-    0xfb, 0x60, 0x00, 0xbf, 0xff, 0xf7, 0xe0, 0xff, 0x02, 0x46, 0xbb, 0x68, 0xd3, 0x1a, 0xfa, 0x68, 0x9a, 0x42, 0xf7, 0xd8, 0x00, 0xbf, 0x10, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x08, 0x00, 0x00, 0x20,
-    0x80, 0xb4, 0x85, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x7b, 0x68, 0x03, 0xf0, 0x07, 0x03, 0xfb, 0x60, 0x0c, 0x4b, 0xdb, 0x68, 0xbb, 0x60, 0xba, 0x68, 0x4f, 0xf6, 0xff, 0x03, 0x13, 0x40, 0xbb, 0x60,
-    0xfb, 0x68, 0x1a, 0x02, 0xbb, 0x68, 0x13, 0x43, 0x43, 0xf0, 0xbf, 0x63, 0x43, 0xf4, 0x00, 0x33, 0xbb, 0x60, 0x04, 0x4a, 0xbb, 0x68, 0xd3, 0x60, 0x00, 0xbf, 0x14, 0x37, 0xbd, 0x46, 0x80, 0xbc,
-    0x70, 0x47, 0x00, 0xbf, 0x00, 0xed, 0x00, 0xe0, 0x80, 0xb4, 0x00, 0xaf, 0x04, 0x4b, 0xdb, 0x68, 0x1b, 0x0a, 0x03, 0xf0, 0x07, 0x03, 0x18, 0x46, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x00, 0xbf,
-    0x00, 0xed, 0x00, 0xe0, 0x80, 0xb4, 0x83, 0xb0, 0x00, 0xaf, 0x03, 0x46, 0x39, 0x60, 0xfb, 0x71, 0x97, 0xf9, 0x07, 0x30, 0x00, 0x2b, 0x0a, 0xdb, 0x3b, 0x68, 0xda, 0xb2, 0x0c, 0x49, 0x97, 0xf9,
-    0x07, 0x30, 0x12, 0x01, 0xd2, 0xb2, 0x0b, 0x44, 0x83, 0xf8, 0x00, 0x23, 0x0a, 0xe0, 0x3b, 0x68, 0xda, 0xb2, 0x08, 0x49, 0xfb, 0x79, 0x03, 0xf0, 0x0f, 0x03, 0x04, 0x3b, 0x12, 0x01, 0xd2, 0xb2,
-    0x0b, 0x44, 0x1a, 0x76, 0x00, 0xbf, 0x0c, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x00, 0xbf, 0x00, 0xe1, 0x00, 0xe0, 0x00, 0xed, 0x00, 0xe0, 0x80, 0xb4, 0x89, 0xb0, 0x00, 0xaf, 0xf8, 0x60,
-    0xb9, 0x60, 0x7a, 0x60, 0xfb, 0x68, 0x03, 0xf0, 0x07, 0x03, 0xfb, 0x61, 0xfb, 0x69, 0xc3, 0xf1, 0x07, 0x03, 0x04, 0x2b, 0x28, 0xbf, 0x04, 0x23, 0xbb, 0x61, 0xfb, 0x69, 0x04, 0x33, 0x06, 0x2b,
-    0x02, 0xd9, 0xfb, 0x69, 0x03, 0x3b, 0x00, 0xe0, 0x00, 0x23, 0x7b, 0x61, 0x4f, 0xf0, 0xff, 0x32, 0xbb, 0x69, 0x02, 0xfa, 0x03, 0xf3, 0xda, 0x43, 0xbb, 0x68, 0x1a, 0x40, 0x7b, 0x69, 0x9a, 0x40,
-    0x4f, 0xf0, 0xff, 0x31, 0x7b, 0x69, 0x01, 0xfa, 0x03, 0xf3, 0xd9, 0x43, 0x7b, 0x68, 0x0b, 0x40, 0x13, 0x43, 0x18, 0x46, 0x24, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb5, 0x82, 0xb0,
-    0x00, 0xaf, 0x78, 0x60, 0x7b, 0x68, 0x01, 0x3b, 0xb3, 0xf1, 0x80, 0x7f, 0x01, 0xd3, 0x01, 0x23, 0x0f, 0xe0, 0x0a, 0x4a, 0x7b, 0x68, 0x01, 0x3b, 0x53, 0x60, 0x0f, 0x21, 0x4f, 0xf0, 0xff, 0x30,
-    0xff, 0xf7, 0x90, 0xff, 0x05, 0x4b, 0x00, 0x22, 0x9a, 0x60, 0x04, 0x4b, 0x07, 0x22, 0x1a, 0x60, 0x00, 0x23, 0x18, 0x46, 0x08, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x00, 0xbf, 0x10, 0xe0, 0x00, 0xe0,
-    0x80, 0xb5, 0x82, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x78, 0x68, 0xff, 0xf7, 0x49, 0xff, 0x00, 0xbf, 0x08, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x80, 0xb5, 0x86, 0xb0, 0x00, 0xaf, 0x03, 0x46, 0xb9, 0x60,
-    0x7a, 0x60, 0xfb, 0x73, 0x00, 0x23, 0x7b, 0x61, 0xff, 0xf7, 0x5e, 0xff, 0x78, 0x61, 0x7a, 0x68, 0xb9, 0x68, 0x78, 0x69, 0xff, 0xf7, 0x90, 0xff, 0x02, 0x46, 0x97, 0xf9, 0x0f, 0x30, 0x11, 0x46,
-    0x18, 0x46, 0xff, 0xf7, 0x5f, 0xff, 0x00, 0xbf, 0x18, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x80, 0xb5, 0x82, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x78, 0x68, 0xff, 0xf7, 0xb0, 0xff, 0x03, 0x46, 0x18, 0x46,
-    0x08, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x00, 0x00, 0x80, 0xb4, 0x8b, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x39, 0x60, 0x00, 0x23, 0x7b, 0x62, 0x00, 0x23, 0x3b, 0x62, 0x27, 0xe1, 0x01, 0x22, 0x7b, 0x6a,
-    0x02, 0xfa, 0x03, 0xf3, 0xfb, 0x61, 0x3b, 0x68, 0x1b, 0x68, 0xfa, 0x69, 0x13, 0x40, 0xbb, 0x61, 0xba, 0x69, 0xfb, 0x69, 0x9a, 0x42, 0x40, 0xf0, 0x16, 0x81, 0x3b, 0x68, 0x5b, 0x68, 0x12, 0x2b,
-    0x34, 0xd0, 0x12, 0x2b, 0x0d, 0xd8, 0x02, 0x2b, 0x2b, 0xd0, 0x02, 0x2b, 0x04, 0xd8, 0x00, 0x2b, 0x31, 0xd0, 0x01, 0x2b, 0x1c, 0xd0, 0x48, 0xe0, 0x03, 0x2b, 0x43, 0xd0, 0x11, 0x2b, 0x1b, 0xd0,
-    0x43, 0xe0, 0x89, 0x4a, 0x93, 0x42, 0x26, 0xd0, 0x87, 0x4a, 0x93, 0x42, 0x06, 0xd8, 0x87, 0x4a, 0x93, 0x42, 0x20, 0xd0, 0x86, 0x4a, 0x93, 0x42, 0x1d, 0xd0, 0x36, 0xe0, 0x85, 0x4a, 0x93, 0x42,
-    0x19, 0xd0, 0x85, 0x4a, 0x93, 0x42, 0x16, 0xd0, 0x84, 0x4a, 0x93, 0x42, 0x13, 0xd0, 0x2c, 0xe0, 0x3b, 0x68, 0xdb, 0x68, 0x3b, 0x62, 0x28, 0xe0, 0x3b, 0x68, 0xdb, 0x68, 0x04, 0x33, 0x3b, 0x62,
-    0x23, 0xe0, 0x3b, 0x68, 0xdb, 0x68, 0x08, 0x33, 0x3b, 0x62, 0x1e, 0xe0, 0x3b, 0x68, 0xdb, 0x68, 0x0c, 0x33, 0x3b, 0x62, 0x19, 0xe0, 0x3b, 0x68, 0x9b, 0x68, 0x00, 0x2b, 0x02, 0xd1, 0x04, 0x23,
-    0x3b, 0x62, 0x12, 0xe0, 0x3b, 0x68, 0x9b, 0x68, 0x01, 0x2b, 0x05, 0xd1, 0x08, 0x23, 0x3b, 0x62, 0x7b, 0x68, 0xfa, 0x69, 0x1a, 0x61, 0x08, 0xe0, 0x08, 0x23, 0x3b, 0x62, 0x7b, 0x68, 0xfa, 0x69,
-    0x5a, 0x61, 0x02, 0xe0, 0x00, 0x23, 0x3b, 0x62, 0x00, 0xbf, 0xbb, 0x69, 0xff, 0x2b, 0x01, 0xd8, 0x7b, 0x68, 0x01, 0xe0, 0x7b, 0x68, 0x04, 0x33, 0x7b, 0x61, 0xbb, 0x69, 0xff, 0x2b, 0x02, 0xd8,
-    0x7b, 0x6a, 0x9b, 0x00, 0x02, 0xe0, 0x7b, 0x6a, 0x08, 0x3b, 0x9b, 0x00, 0x3b, 0x61, 0x7b, 0x69, 0x1a, 0x68, 0x0f, 0x21, 0x3b, 0x69, 0x01, 0xfa, 0x03, 0xf3, 0xdb, 0x43, 0x1a, 0x40, 0x39, 0x6a,
-    0x3b, 0x69, 0x01, 0xfa, 0x03, 0xf3, 0x1a, 0x43, 0x7b, 0x69, 0x1a, 0x60, 0x3b, 0x68, 0x5b, 0x68, 0x03, 0xf0, 0x80, 0x53, 0x00, 0x2b, 0x00, 0xf0, 0x96, 0x80, 0x59, 0x4b, 0x9b, 0x69, 0x58, 0x4a,
-    0x43, 0xf0, 0x01, 0x03, 0x93, 0x61, 0x56, 0x4b, 0x9b, 0x69, 0x03, 0xf0, 0x01, 0x03, 0xbb, 0x60, 0xbb, 0x68, 0x54, 0x4a, 0x7b, 0x6a, 0x9b, 0x08, 0x02, 0x33, 0x52, 0xf8, 0x23, 0x30, 0xfb, 0x60,
-    0x7b, 0x6a, 0x03, 0xf0, 0x03, 0x03, 0x9b, 0x00, 0x0f, 0x22, 0x02, 0xfa, 0x03, 0xf3, 0xdb, 0x43, 0xfa, 0x68, 0x13, 0x40, 0xfb, 0x60, 0x7b, 0x68, 0x4b, 0x4a, 0x93, 0x42, 0x13, 0xd0, 0x7b, 0x68,
-    0x4a, 0x4a, 0x93, 0x42, 0x0d, 0xd0, 0x7b, 0x68, 0x49, 0x4a, 0x93, 0x42, 0x07, 0xd0, 0x7b, 0x68, 0x48, 0x4a, 0x93, 0x42, 0x01, 0xd1, 0x03, 0x23, 0x06, 0xe0, 0x04, 0x23, 0x04, 0xe0, 0x02, 0x23,
-    0x02, 0xe0, 0x01, 0x23, 0x00, 0xe0, 0x00, 0x23, 0x7a, 0x6a, 0x02, 0xf0, 0x03, 0x02, 0x92, 0x00, 0x93, 0x40, 0xfa, 0x68, 0x13, 0x43, 0xfb, 0x60, 0x3a, 0x49, 0x7b, 0x6a, 0x9b, 0x08, 0x02, 0x33,
-    0xfa, 0x68, 0x41, 0xf8, 0x23, 0x20, 0x3b, 0x68, 0x5b, 0x68, 0x03, 0xf4, 0x80, 0x33, 0x00, 0x2b, 0x06, 0xd0, 0x39, 0x4b, 0x1a, 0x68, 0x38, 0x49, 0xbb, 0x69, 0x13, 0x43, 0x0b, 0x60, 0x06, 0xe0,
-    0x35, 0x4b, 0x1a, 0x68, 0xbb, 0x69, 0xdb, 0x43, 0x33, 0x49, 0x13, 0x40, 0x0b, 0x60, 0x3b, 0x68, 0x5b, 0x68, 0x03, 0xf4, 0x00, 0x33, 0x00, 0x2b, 0x06, 0xd0, 0x2f, 0x4b, 0x5a, 0x68, 0x2e, 0x49,
-    0xbb, 0x69, 0x13, 0x43, 0x4b, 0x60, 0x06, 0xe0, 0x2b, 0x4b, 0x5a, 0x68, 0xbb, 0x69, 0xdb, 0x43, 0x29, 0x49, 0x13, 0x40, 0x4b, 0x60, 0x3b, 0x68, 0x5b, 0x68, 0x03, 0xf4, 0x80, 0x13, 0x00, 0x2b,
-    0x06, 0xd0, 0x25, 0x4b, 0x9a, 0x68, 0x24, 0x49, 0xbb, 0x69, 0x13, 0x43, 0x8b, 0x60, 0x06, 0xe0, 0x21, 0x4b, 0x9a, 0x68, 0xbb, 0x69, 0xdb, 0x43, 0x1f, 0x49, 0x13, 0x40, 0x8b, 0x60, 0x3b, 0x68,
-    0x5b, 0x68, 0x03, 0xf4, 0x00, 0x13, 0x00, 0x2b, 0x06, 0xd0, 0x1b, 0x4b, 0xda, 0x68, 0x1a, 0x49, 0xbb, 0x69, 0x13, 0x43, 0xcb, 0x60, 0x06, 0xe0, 0x17, 0x4b, 0xda, 0x68, 0xbb, 0x69, 0xdb, 0x43,
-    0x15, 0x49, 0x13, 0x40, 0xcb, 0x60, 0x7b, 0x6a, 0x01, 0x33, 0x7b, 0x62, 0x3b, 0x68, 0x1a, 0x68, 0x7b, 0x6a, 0x22, 0xfa, 0x03, 0xf3, 0x00, 0x2b, 0x7f, 0xf4, 0xd0, 0xae, 0x00, 0xbf, 0x2c, 0x37,
-    0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x00, 0xbf, 0x00, 0x00, 0x21, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x31, 0x10, 0x00, 0x00, 0x32, 0x10, 0x00, 0x00, 0x22, 0x10,
-    0x00, 0x10, 0x02, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x08, 0x01, 0x40, 0x00, 0x0c, 0x01, 0x40, 0x00, 0x10, 0x01, 0x40, 0x00, 0x14, 0x01, 0x40, 0x00, 0x04, 0x01, 0x40, 0x80, 0xb4, 0x83, 0xb0,
-    0x00, 0xaf, 0x78, 0x60, 0x0b, 0x46, 0x7b, 0x80, 0x13, 0x46, 0x7b, 0x70, 0x7b, 0x78, 0x00, 0x2b, 0x03, 0xd0, 0x7a, 0x88, 0x7b, 0x68, 0x1a, 0x61, 0x03, 0xe0, 0x7b, 0x88, 0x1a, 0x04, 0x7b, 0x68,
-    0x1a, 0x61, 0x00, 0xbf, 0x0c, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb5, 0x86, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x7b, 0x68, 0x00, 0x2b, 0x01, 0xd1, 0x01, 0x23, 0x6c, 0xe2, 0x7b, 0x68,
-    0x1b, 0x68, 0x03, 0xf0, 0x01, 0x03, 0x00, 0x2b, 0x00, 0xf0, 0x87, 0x80, 0x92, 0x4b, 0x5b, 0x68, 0x03, 0xf0, 0x0c, 0x03, 0x04, 0x2b, 0x0c, 0xd0, 0x8f, 0x4b, 0x5b, 0x68, 0x03, 0xf0, 0x0c, 0x03,
-    0x08, 0x2b, 0x12, 0xd1, 0x8c, 0x4b, 0x5b, 0x68, 0x03, 0xf4, 0x80, 0x33, 0xb3, 0xf5, 0x80, 0x3f, 0x0b, 0xd1, 0x89, 0x4b, 0x1b, 0x68, 0x03, 0xf4, 0x00, 0x33, 0x00, 0x2b, 0x6c, 0xd0, 0x7b, 0x68,
-    0x5b, 0x68, 0x00, 0x2b, 0x68, 0xd1, 0x01, 0x23, 0x46, 0xe2, 0x7b, 0x68, 0x5b, 0x68, 0xb3, 0xf5, 0x80, 0x3f, 0x06, 0xd1, 0x80, 0x4b, 0x1b, 0x68, 0x7f, 0x4a, 0x43, 0xf4, 0x80, 0x33, 0x13, 0x60,
-    0x2e, 0xe0, 0x7b, 0x68, 0x5b, 0x68, 0x00, 0x2b, 0x0c, 0xd1, 0x7b, 0x4b, 0x1b, 0x68, 0x7a, 0x4a, 0x23, 0xf4, 0x80, 0x33, 0x13, 0x60, 0x78, 0x4b, 0x1b, 0x68, 0x77, 0x4a, 0x23, 0xf4, 0x80, 0x23,
-    0x13, 0x60, 0x1d, 0xe0, 0x7b, 0x68, 0x5b, 0x68, 0xb3, 0xf5, 0xa0, 0x2f, 0x0c, 0xd1, 0x72, 0x4b, 0x1b, 0x68, 0x71, 0x4a, 0x43, 0xf4, 0x80, 0x23, 0x13, 0x60, 0x6f, 0x4b, 0x1b, 0x68, 0x6e, 0x4a,
-    0x43, 0xf4, 0x80, 0x33, 0x13, 0x60, 0x0b, 0xe0, 0x6b, 0x4b, 0x1b, 0x68, 0x6a, 0x4a, 0x23, 0xf4, 0x80, 0x33, 0x13, 0x60, 0x68, 0x4b, 0x1b, 0x68, 0x67, 0x4a, 0x23, 0xf4, 0x80, 0x23, 0x13, 0x60,
-    0x7b, 0x68, 0x5b, 0x68, 0x00, 0x2b, 0x13, 0xd0, 0xff, 0xf7, 0x0e, 0xfd, 0x38, 0x61, 0x08, 0xe0, 0xff, 0xf7, 0x0a, 0xfd, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a, 0x64, 0x2b, 0x01, 0xd9, 0x03, 0x23,
-    0xfa, 0xe1, 0x5d, 0x4b, 0x1b, 0x68, 0x03, 0xf4, 0x00, 0x33, 0x00, 0x2b, 0xf0, 0xd0, 0x14, 0xe0, 0xff, 0xf7, 0xfa, 0xfc, 0x38, 0x61, 0x08, 0xe0, 0xff, 0xf7, 0xf6, 0xfc, 0x02, 0x46, 0x3b, 0x69,
-    0xd3, 0x1a, 0x64, 0x2b, 0x01, 0xd9, 0x03, 0x23, 0xe6, 0xe1, 0x53, 0x4b, 0x1b, 0x68, 0x03, 0xf4, 0x00, 0x33, 0x00, 0x2b, 0xf0, 0xd1, 0x00, 0xe0, 0x00, 0xbf, 0x7b, 0x68, 0x1b, 0x68, 0x03, 0xf0,
-    0x02, 0x03, 0x00, 0x2b, 0x63, 0xd0, 0x4c, 0x4b, 0x5b, 0x68, 0x03, 0xf0, 0x0c, 0x03, 0x00, 0x2b, 0x0b, 0xd0, 0x49, 0x4b, 0x5b, 0x68, 0x03, 0xf0, 0x0c, 0x03, 0x08, 0x2b, 0x1c, 0xd1, 0x46, 0x4b,
-    0x5b, 0x68, 0x03, 0xf4, 0x80, 0x33, 0x00, 0x2b, 0x16, 0xd1, 0x43, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x02, 0x03, 0x00, 0x2b, 0x05, 0xd0, 0x7b, 0x68, 0x1b, 0x69, 0x01, 0x2b, 0x01, 0xd0, 0x01, 0x23,
-    0xba, 0xe1, 0x3d, 0x4b, 0x1b, 0x68, 0x23, 0xf0, 0xf8, 0x02, 0x7b, 0x68, 0x5b, 0x69, 0xdb, 0x00, 0x39, 0x49, 0x13, 0x43, 0x0b, 0x60, 0x3a, 0xe0, 0x7b, 0x68, 0x1b, 0x69, 0x00, 0x2b, 0x20, 0xd0,
-    0x36, 0x4b, 0x01, 0x22, 0x1a, 0x60, 0xff, 0xf7, 0xaf, 0xfc, 0x38, 0x61, 0x08, 0xe0, 0xff, 0xf7, 0xab, 0xfc, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a, 0x02, 0x2b, 0x01, 0xd9, 0x03, 0x23, 0x9b, 0xe1,
-    0x2d, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x02, 0x03, 0x00, 0x2b, 0xf0, 0xd0, 0x2a, 0x4b, 0x1b, 0x68, 0x23, 0xf0, 0xf8, 0x02, 0x7b, 0x68, 0x5b, 0x69, 0xdb, 0x00, 0x27, 0x49, 0x13, 0x43, 0x0b, 0x60,
-    0x15, 0xe0, 0x26, 0x4b, 0x00, 0x22, 0x1a, 0x60, 0xff, 0xf7, 0x8e, 0xfc, 0x38, 0x61, 0x08, 0xe0, 0xff, 0xf7, 0x8a, 0xfc, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a, 0x02, 0x2b, 0x01, 0xd9, 0x03, 0x23,
-    0x7a, 0xe1, 0x1d, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x02, 0x03, 0x00, 0x2b, 0xf0, 0xd1, 0x7b, 0x68, 0x1b, 0x68, 0x03, 0xf0, 0x08, 0x03, 0x00, 0x2b, 0x3a, 0xd0, 0x7b, 0x68, 0x9b, 0x69, 0x00, 0x2b,
-    0x19, 0xd0, 0x17, 0x4b, 0x01, 0x22, 0x1a, 0x60, 0xff, 0xf7, 0x6e, 0xfc, 0x38, 0x61, 0x08, 0xe0, 0xff, 0xf7, 0x6a, 0xfc, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a, 0x02, 0x2b, 0x01, 0xd9, 0x03, 0x23,
-    0x5a, 0xe1, 0x0d, 0x4b, 0x5b, 0x6a, 0x03, 0xf0, 0x02, 0x03, 0x00, 0x2b, 0xf0, 0xd0, 0x01, 0x20, 0x00, 0xf0, 0xa8, 0xfa, 0x1c, 0xe0, 0x0a, 0x4b, 0x00, 0x22, 0x1a, 0x60, 0xff, 0xf7, 0x54, 0xfc,
-    0x38, 0x61, 0x0f, 0xe0, 0xff, 0xf7, 0x50, 0xfc, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a, 0x02, 0x2b, 0x08, 0xd9, 0x03, 0x23, 0x40, 0xe1, 0x00, 0xbf, 0x00, 0x10, 0x02, 0x40, 0x00, 0x00, 0x42, 0x42,
-    0x80, 0x04, 0x42, 0x42, 0x9e, 0x4b, 0x5b, 0x6a, 0x03, 0xf0, 0x02, 0x03, 0x00, 0x2b, 0xe9, 0xd1, 0x7b, 0x68, 0x1b, 0x68, 0x03, 0xf0, 0x04, 0x03, 0x00, 0x2b, 0x00, 0xf0, 0xa6, 0x80, 0x00, 0x23,
-    0xfb, 0x75, 0x97, 0x4b, 0xdb, 0x69, 0x03, 0xf0, 0x80, 0x53, 0x00, 0x2b, 0x0d, 0xd1, 0x94, 0x4b, 0xdb, 0x69, 0x93, 0x4a, 0x43, 0xf0, 0x80, 0x53, 0xd3, 0x61, 0x91, 0x4b, 0xdb, 0x69, 0x03, 0xf0,
-    0x80, 0x53, 0xbb, 0x60, 0xbb, 0x68, 0x01, 0x23, 0xfb, 0x75, 0x8e, 0x4b, 0x1b, 0x68, 0x03, 0xf4, 0x80, 0x73, 0x00, 0x2b, 0x18, 0xd1, 0x8b, 0x4b, 0x1b, 0x68, 0x8a, 0x4a, 0x43, 0xf4, 0x80, 0x73,
-    0x13, 0x60, 0xff, 0xf7, 0x11, 0xfc, 0x38, 0x61, 0x08, 0xe0, 0xff, 0xf7, 0x0d, 0xfc, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a, 0x64, 0x2b, 0x01, 0xd9, 0x03, 0x23, 0xfd, 0xe0, 0x81, 0x4b, 0x1b, 0x68,
-    0x03, 0xf4, 0x80, 0x73, 0x00, 0x2b, 0xf0, 0xd0, 0x7b, 0x68, 0xdb, 0x68, 0x01, 0x2b, 0x06, 0xd1, 0x7b, 0x4b, 0x1b, 0x6a, 0x7a, 0x4a, 0x43, 0xf0, 0x01, 0x03, 0x13, 0x62, 0x2d, 0xe0, 0x7b, 0x68,
-    0xdb, 0x68, 0x00, 0x2b, 0x0c, 0xd1, 0x76, 0x4b, 0x1b, 0x6a, 0x75, 0x4a, 0x23, 0xf0, 0x01, 0x03, 0x13, 0x62, 0x73, 0x4b, 0x1b, 0x6a, 0x72, 0x4a, 0x23, 0xf0, 0x04, 0x03, 0x13, 0x62, 0x1c, 0xe0,
-    0x7b, 0x68, 0xdb, 0x68, 0x05, 0x2b, 0x0c, 0xd1, 0x6d, 0x4b, 0x1b, 0x6a, 0x6c, 0x4a, 0x43, 0xf0, 0x04, 0x03, 0x13, 0x62, 0x6a, 0x4b, 0x1b, 0x6a, 0x69, 0x4a, 0x43, 0xf0, 0x01, 0x03, 0x13, 0x62,
-    0x0b, 0xe0, 0x67, 0x4b, 0x1b, 0x6a, 0x66, 0x4a, 0x23, 0xf0, 0x01, 0x03, 0x13, 0x62, 0x64, 0x4b, 0x1b, 0x6a, 0x63, 0x4a, 0x23, 0xf0, 0x04, 0x03, 0x13, 0x62, 0x7b, 0x68, 0xdb, 0x68, 0x00, 0x2b,
-    0x15, 0xd0, 0xff, 0xf7, 0xc1, 0xfb, 0x38, 0x61, 0x0a, 0xe0, 0xff, 0xf7, 0xbd, 0xfb, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a, 0x41, 0xf2, 0x88, 0x32, 0x93, 0x42, 0x01, 0xd9, 0x03, 0x23, 0xab, 0xe0,
-    0x57, 0x4b, 0x1b, 0x6a, 0x03, 0xf0, 0x02, 0x03, 0x00, 0x2b, 0xee, 0xd0, 0x14, 0xe0, 0xff, 0xf7, 0xab, 0xfb, 0x38, 0x61, 0x0a, 0xe0, 0xff, 0xf7, 0xa7, 0xfb, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a,
-    0x41, 0xf2, 0x88, 0x32, 0x93, 0x42, 0x01, 0xd9, 0x03, 0x23, 0x95, 0xe0, 0x4c, 0x4b, 0x1b, 0x6a, 0x03, 0xf0, 0x02, 0x03, 0x00, 0x2b, 0xee, 0xd1, 0xfb, 0x7d, 0x01, 0x2b, 0x05, 0xd1, 0x48, 0x4b,
-    0xdb, 0x69, 0x47, 0x4a, 0x23, 0xf0, 0x80, 0x53, 0xd3, 0x61, 0x7b, 0x68, 0xdb, 0x69, 0x00, 0x2b, 0x00, 0xf0, 0x81, 0x80, 0x42, 0x4b, 0x5b, 0x68, 0x03, 0xf0, 0x0c, 0x03, 0x08, 0x2b, 0x61, 0xd0,
-    0x7b, 0x68, 0xdb, 0x69, 0x02, 0x2b, 0x46, 0xd1, 0x3f, 0x4b, 0x00, 0x22, 0x1a, 0x60, 0xff, 0xf7, 0x7b, 0xfb, 0x38, 0x61, 0x08, 0xe0, 0xff, 0xf7, 0x77, 0xfb, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a,
-    0x02, 0x2b, 0x01, 0xd9, 0x03, 0x23, 0x67, 0xe0, 0x35, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x00, 0x73, 0x00, 0x2b, 0xf0, 0xd1, 0x7b, 0x68, 0x1b, 0x6a, 0xb3, 0xf5, 0x80, 0x3f, 0x08, 0xd1, 0x30, 0x4b,
-    0x5b, 0x68, 0x23, 0xf4, 0x00, 0x32, 0x7b, 0x68, 0x9b, 0x68, 0x2d, 0x49, 0x13, 0x43, 0x4b, 0x60, 0x2b, 0x4b, 0x5b, 0x68, 0x23, 0xf4, 0x74, 0x12, 0x7b, 0x68, 0x19, 0x6a, 0x7b, 0x68, 0x5b, 0x6a,
-    0x0b, 0x43, 0x27, 0x49, 0x13, 0x43, 0x4b, 0x60, 0x27, 0x4b, 0x01, 0x22, 0x1a, 0x60, 0xff, 0xf7, 0x4b, 0xfb, 0x38, 0x61, 0x08, 0xe0, 0xff, 0xf7, 0x47, 0xfb, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a,
-    0x02, 0x2b, 0x01, 0xd9, 0x03, 0x23, 0x37, 0xe0, 0x1d, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x00, 0x73, 0x00, 0x2b, 0xf0, 0xd0, 0x2f, 0xe0, 0x1c, 0x4b, 0x00, 0x22, 0x1a, 0x60, 0xff, 0xf7, 0x34, 0xfb,
-    0x38, 0x61, 0x08, 0xe0, 0xff, 0xf7, 0x30, 0xfb, 0x02, 0x46, 0x3b, 0x69, 0xd3, 0x1a, 0x02, 0x2b, 0x01, 0xd9, 0x03, 0x23, 0x20, 0xe0, 0x12, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x00, 0x73, 0x00, 0x2b,
-    0xf0, 0xd1, 0x18, 0xe0, 0x7b, 0x68, 0xdb, 0x69, 0x01, 0x2b, 0x01, 0xd1, 0x01, 0x23, 0x13, 0xe0, 0x0b, 0x4b, 0x5b, 0x68, 0xfb, 0x60, 0xfb, 0x68, 0x03, 0xf4, 0x80, 0x32, 0x7b, 0x68, 0x1b, 0x6a,
-    0x9a, 0x42, 0x06, 0xd1, 0xfb, 0x68, 0x03, 0xf4, 0x70, 0x12, 0x7b, 0x68, 0x5b, 0x6a, 0x9a, 0x42, 0x01, 0xd0, 0x01, 0x23, 0x00, 0xe0, 0x00, 0x23, 0x18, 0x46, 0x18, 0x37, 0xbd, 0x46, 0x80, 0xbd,
-    0x00, 0x10, 0x02, 0x40, 0x00, 0x70, 0x00, 0x40, 0x60, 0x00, 0x42, 0x42, 0x80, 0xb5, 0x84, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x39, 0x60, 0x7b, 0x68, 0x00, 0x2b, 0x01, 0xd1, 0x01, 0x23, 0xd0, 0xe0,
-    0x6a, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x07, 0x03, 0x3a, 0x68, 0x9a, 0x42, 0x10, 0xd9, 0x67, 0x4b, 0x1b, 0x68, 0x23, 0xf0, 0x07, 0x02, 0x65, 0x49, 0x3b, 0x68, 0x13, 0x43, 0x0b, 0x60, 0x63, 0x4b,
-    0x1b, 0x68, 0x03, 0xf0, 0x07, 0x03, 0x3a, 0x68, 0x9a, 0x42, 0x01, 0xd0, 0x01, 0x23, 0xb8, 0xe0, 0x7b, 0x68, 0x1b, 0x68, 0x03, 0xf0, 0x02, 0x03, 0x00, 0x2b, 0x20, 0xd0, 0x7b, 0x68, 0x1b, 0x68,
-    0x03, 0xf0, 0x04, 0x03, 0x00, 0x2b, 0x05, 0xd0, 0x59, 0x4b, 0x5b, 0x68, 0x58, 0x4a, 0x43, 0xf4, 0xe0, 0x63, 0x53, 0x60, 0x7b, 0x68, 0x1b, 0x68, 0x03, 0xf0, 0x08, 0x03, 0x00, 0x2b, 0x05, 0xd0,
-    0x53, 0x4b, 0x5b, 0x68, 0x52, 0x4a, 0x43, 0xf4, 0x60, 0x53, 0x53, 0x60, 0x50, 0x4b, 0x5b, 0x68, 0x23, 0xf0, 0xf0, 0x02, 0x7b, 0x68, 0x9b, 0x68, 0x4d, 0x49, 0x13, 0x43, 0x4b, 0x60, 0x7b, 0x68,
-    0x1b, 0x68, 0x03, 0xf0, 0x01, 0x03, 0x00, 0x2b, 0x40, 0xd0, 0x7b, 0x68, 0x5b, 0x68, 0x01, 0x2b, 0x07, 0xd1, 0x47, 0x4b, 0x1b, 0x68, 0x03, 0xf4, 0x00, 0x33, 0x00, 0x2b, 0x15, 0xd1, 0x01, 0x23,
-    0x7f, 0xe0, 0x7b, 0x68, 0x5b, 0x68, 0x02, 0x2b, 0x07, 0xd1, 0x41, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x00, 0x73, 0x00, 0x2b, 0x09, 0xd1, 0x01, 0x23, 0x73, 0xe0, 0x3d, 0x4b, 0x1b, 0x68, 0x03, 0xf0,
-    0x02, 0x03, 0x00, 0x2b, 0x01, 0xd1, 0x01, 0x23, 0x6b, 0xe0, 0x39, 0x4b, 0x5b, 0x68, 0x23, 0xf0, 0x03, 0x02, 0x7b, 0x68, 0x5b, 0x68, 0x36, 0x49, 0x13, 0x43, 0x4b, 0x60, 0xff, 0xf7, 0x84, 0xfa,
-    0xf8, 0x60, 0x0a, 0xe0, 0xff, 0xf7, 0x80, 0xfa, 0x02, 0x46, 0xfb, 0x68, 0xd3, 0x1a, 0x41, 0xf2, 0x88, 0x32, 0x93, 0x42, 0x01, 0xd9, 0x03, 0x23, 0x53, 0xe0, 0x2d, 0x4b, 0x5b, 0x68, 0x03, 0xf0,
-    0x0c, 0x02, 0x7b, 0x68, 0x5b, 0x68, 0x9b, 0x00, 0x9a, 0x42, 0xeb, 0xd1, 0x27, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x07, 0x03, 0x3a, 0x68, 0x9a, 0x42, 0x10, 0xd2, 0x24, 0x4b, 0x1b, 0x68, 0x23, 0xf0,
-    0x07, 0x02, 0x22, 0x49, 0x3b, 0x68, 0x13, 0x43, 0x0b, 0x60, 0x20, 0x4b, 0x1b, 0x68, 0x03, 0xf0, 0x07, 0x03, 0x3a, 0x68, 0x9a, 0x42, 0x01, 0xd0, 0x01, 0x23, 0x32, 0xe0, 0x7b, 0x68, 0x1b, 0x68,
-    0x03, 0xf0, 0x04, 0x03, 0x00, 0x2b, 0x08, 0xd0, 0x19, 0x4b, 0x5b, 0x68, 0x23, 0xf4, 0xe0, 0x62, 0x7b, 0x68, 0xdb, 0x68, 0x16, 0x49, 0x13, 0x43, 0x4b, 0x60, 0x7b, 0x68, 0x1b, 0x68, 0x03, 0xf0,
-    0x08, 0x03, 0x00, 0x2b, 0x09, 0xd0, 0x12, 0x4b, 0x5b, 0x68, 0x23, 0xf4, 0x60, 0x52, 0x7b, 0x68, 0x1b, 0x69, 0xdb, 0x00, 0x0e, 0x49, 0x13, 0x43, 0x4b, 0x60, 0x00, 0xf0, 0x21, 0xf8, 0x01, 0x46,
-    0x0b, 0x4b, 0x5b, 0x68, 0x1b, 0x09, 0x03, 0xf0, 0x0f, 0x03, 0x0a, 0x4a, 0xd3, 0x5c, 0x21, 0xfa, 0x03, 0xf3, 0x09, 0x4a, 0x13, 0x60, 0x09, 0x4b, 0x1b, 0x68, 0x18, 0x46, 0xff, 0xf7, 0xe2, 0xf9,
-    0x00, 0x23, 0x18, 0x46, 0x10, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x00, 0xbf, 0x00, 0x20, 0x02, 0x40, 0x00, 0x10, 0x02, 0x40, 0xa4, 0x42, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x20,
-    0x90, 0xb4, 0x8a, 0xb0, 0x00, 0xaf, 0x2a, 0x4b, 0x3c, 0x1d, 0x0f, 0xcb, 0x84, 0xe8, 0x0f, 0x00, 0x28, 0x4b, 0x1b, 0x88, 0x3b, 0x80, 0x00, 0x23, 0xfb, 0x61, 0x00, 0x23, 0xbb, 0x61, 0x00, 0x23,
-    0x7b, 0x62, 0x00, 0x23, 0x7b, 0x61, 0x00, 0x23, 0x3b, 0x62, 0x23, 0x4b, 0x5b, 0x68, 0xfb, 0x61, 0xfb, 0x69, 0x03, 0xf0, 0x0c, 0x03, 0x04, 0x2b, 0x02, 0xd0, 0x08, 0x2b, 0x03, 0xd0, 0x2d, 0xe0,
-    0x1e, 0x4b, 0x3b, 0x62, 0x2d, 0xe0, 0xfb, 0x69, 0x9b, 0x0c, 0x03, 0xf0, 0x0f, 0x03, 0x07, 0xf1, 0x28, 0x02, 0x13, 0x44, 0x13, 0xf8, 0x24, 0x3c, 0x7b, 0x61, 0xfb, 0x69, 0x03, 0xf4, 0x80, 0x33,
-    0x00, 0x2b, 0x13, 0xd0, 0x14, 0x4b, 0x5b, 0x68, 0x5b, 0x0c, 0x03, 0xf0, 0x01, 0x03, 0x07, 0xf1, 0x28, 0x02, 0x13, 0x44, 0x13, 0xf8, 0x28, 0x3c, 0xbb, 0x61, 0x7b, 0x69, 0x0f, 0x4a, 0x02, 0xfb,
-    0x03, 0xf2, 0xbb, 0x69, 0xb2, 0xfb, 0xf3, 0xf3, 0x7b, 0x62, 0x04, 0xe0, 0x7b, 0x69, 0x0c, 0x4a, 0x02, 0xfb, 0x03, 0xf3, 0x7b, 0x62, 0x7b, 0x6a, 0x3b, 0x62, 0x02, 0xe0, 0x07, 0x4b, 0x3b, 0x62,
-    0x00, 0xbf, 0x3b, 0x6a, 0x18, 0x46, 0x28, 0x37, 0xbd, 0x46, 0x90, 0xbc, 0x70, 0x47, 0x00, 0xbf, 0x90, 0x42, 0x00, 0x08, 0xa0, 0x42, 0x00, 0x08, 0x00, 0x10, 0x02, 0x40, 0x00, 0x12, 0x7a, 0x00,
-    0x00, 0x09, 0x3d, 0x00, 0x80, 0xb4, 0x85, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x0a, 0x4b, 0x1b, 0x68, 0x0a, 0x4a, 0xa2, 0xfb, 0x03, 0x23, 0x5b, 0x0a, 0x7a, 0x68, 0x02, 0xfb, 0x03, 0xf3, 0xfb, 0x60,
-    0x00, 0xbf, 0xfb, 0x68, 0x5a, 0x1e, 0xfa, 0x60, 0x00, 0x2b, 0xf9, 0xd1, 0x00, 0xbf, 0x14, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x20, 0xd3, 0x4d, 0x62, 0x10,
-    0x80, 0xb5, 0x82, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x7b, 0x68, 0x00, 0x2b, 0x01, 0xd1, 0x01, 0x23, 0x1d, 0xe0, 0x7b, 0x68, 0x93, 0xf8, 0x3d, 0x30, 0xdb, 0xb2, 0x00, 0x2b, 0x06, 0xd1, 0x7b, 0x68,
-    0x00, 0x22, 0x83, 0xf8, 0x3c, 0x20, 0x78, 0x68, 0xff, 0xf7, 0x84, 0xf8, 0x7b, 0x68, 0x02, 0x22, 0x83, 0xf8, 0x3d, 0x20, 0x7b, 0x68, 0x1a, 0x68, 0x7b, 0x68, 0x04, 0x33, 0x19, 0x46, 0x10, 0x46,
-    0x00, 0xf0, 0xe4, 0xf8, 0x7b, 0x68, 0x01, 0x22, 0x83, 0xf8, 0x3d, 0x20, 0x00, 0x23, 0x18, 0x46, 0x08, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x80, 0xb4, 0x85, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x7b, 0x68,
-    0x02, 0x22, 0x83, 0xf8, 0x3d, 0x20, 0x7b, 0x68, 0x1b, 0x68, 0x9b, 0x68, 0x03, 0xf0, 0x07, 0x03, 0xfb, 0x60, 0xfb, 0x68, 0x06, 0x2b, 0x07, 0xd0, 0x7b, 0x68, 0x1b, 0x68, 0x1a, 0x68, 0x7b, 0x68,
-    0x1b, 0x68, 0x42, 0xf0, 0x01, 0x02, 0x1a, 0x60, 0x7b, 0x68, 0x01, 0x22, 0x83, 0xf8, 0x3d, 0x20, 0x00, 0x23, 0x18, 0x46, 0x14, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb5, 0x84, 0xb0,
-    0x00, 0xaf, 0x78, 0x60, 0x39, 0x60, 0x7b, 0x68, 0x93, 0xf8, 0x3c, 0x30, 0x01, 0x2b, 0x01, 0xd1, 0x02, 0x23, 0xa6, 0xe0, 0x7b, 0x68, 0x01, 0x22, 0x83, 0xf8, 0x3c, 0x20, 0x7b, 0x68, 0x02, 0x22,
-    0x83, 0xf8, 0x3d, 0x20, 0x7b, 0x68, 0x1b, 0x68, 0x9b, 0x68, 0xfb, 0x60, 0xfb, 0x68, 0x23, 0xf0, 0x77, 0x03, 0xfb, 0x60, 0xfb, 0x68, 0x23, 0xf4, 0x7f, 0x43, 0xfb, 0x60, 0x7b, 0x68, 0x1b, 0x68,
-    0xfa, 0x68, 0x9a, 0x60, 0x3b, 0x68, 0x1b, 0x68, 0x40, 0x2b, 0x67, 0xd0, 0x40, 0x2b, 0x0b, 0xd8, 0x10, 0x2b, 0x73, 0xd0, 0x10, 0x2b, 0x02, 0xd8, 0x00, 0x2b, 0x6f, 0xd0, 0x78, 0xe0, 0x20, 0x2b,
-    0x6c, 0xd0, 0x30, 0x2b, 0x6a, 0xd0, 0x73, 0xe0, 0x70, 0x2b, 0x0d, 0xd0, 0x70, 0x2b, 0x04, 0xd8, 0x50, 0x2b, 0x33, 0xd0, 0x60, 0x2b, 0x41, 0xd0, 0x6a, 0xe0, 0xb3, 0xf5, 0x80, 0x5f, 0x66, 0xd0,
-    0xb3, 0xf5, 0x00, 0x5f, 0x17, 0xd0, 0x63, 0xe0, 0x7b, 0x68, 0x18, 0x68, 0x3b, 0x68, 0x99, 0x68, 0x3b, 0x68, 0x5a, 0x68, 0x3b, 0x68, 0xdb, 0x68, 0x00, 0xf0, 0x41, 0xf9, 0x7b, 0x68, 0x1b, 0x68,
-    0x9b, 0x68, 0xfb, 0x60, 0xfb, 0x68, 0x43, 0xf0, 0x77, 0x03, 0xfb, 0x60, 0x7b, 0x68, 0x1b, 0x68, 0xfa, 0x68, 0x9a, 0x60, 0x4c, 0xe0, 0x7b, 0x68, 0x18, 0x68, 0x3b, 0x68, 0x99, 0x68, 0x3b, 0x68,
-    0x5a, 0x68, 0x3b, 0x68, 0xdb, 0x68, 0x00, 0xf0, 0x2a, 0xf9, 0x7b, 0x68, 0x1b, 0x68, 0x9a, 0x68, 0x7b, 0x68, 0x1b, 0x68, 0x42, 0xf4, 0x80, 0x42, 0x9a, 0x60, 0x39, 0xe0, 0x7b, 0x68, 0x18, 0x68,
-    0x3b, 0x68, 0x59, 0x68, 0x3b, 0x68, 0xdb, 0x68, 0x1a, 0x46, 0x00, 0xf0, 0xa1, 0xf8, 0x7b, 0x68, 0x1b, 0x68, 0x50, 0x21, 0x18, 0x46, 0x00, 0xf0, 0xf8, 0xf8, 0x29, 0xe0, 0x7b, 0x68, 0x18, 0x68,
-    0x3b, 0x68, 0x59, 0x68, 0x3b, 0x68, 0xdb, 0x68, 0x1a, 0x46, 0x00, 0xf0, 0xbf, 0xf8, 0x7b, 0x68, 0x1b, 0x68, 0x60, 0x21, 0x18, 0x46, 0x00, 0xf0, 0xe8, 0xf8, 0x19, 0xe0, 0x7b, 0x68, 0x18, 0x68,
-    0x3b, 0x68, 0x59, 0x68, 0x3b, 0x68, 0xdb, 0x68, 0x1a, 0x46, 0x00, 0xf0, 0x81, 0xf8, 0x7b, 0x68, 0x1b, 0x68, 0x40, 0x21, 0x18, 0x46, 0x00, 0xf0, 0xd8, 0xf8, 0x09, 0xe0, 0x7b, 0x68, 0x1a, 0x68,
-    0x3b, 0x68, 0x1b, 0x68, 0x19, 0x46, 0x10, 0x46, 0x00, 0xf0, 0xcf, 0xf8, 0x00, 0xe0, 0x00, 0xbf, 0x7b, 0x68, 0x01, 0x22, 0x83, 0xf8, 0x3d, 0x20, 0x7b, 0x68, 0x00, 0x22, 0x83, 0xf8, 0x3c, 0x20,
-    0x00, 0x23, 0x18, 0x46, 0x10, 0x37, 0xbd, 0x46, 0x80, 0xbd, 0x00, 0x00, 0x80, 0xb4, 0x85, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x39, 0x60, 0x7b, 0x68, 0x1b, 0x68, 0xfb, 0x60, 0x7b, 0x68, 0x29, 0x4a,
-    0x93, 0x42, 0x0b, 0xd0, 0x7b, 0x68, 0xb3, 0xf1, 0x80, 0x4f, 0x07, 0xd0, 0x7b, 0x68, 0x26, 0x4a, 0x93, 0x42, 0x03, 0xd0, 0x7b, 0x68, 0x25, 0x4a, 0x93, 0x42, 0x08, 0xd1, 0xfb, 0x68, 0x23, 0xf0,
-    0x70, 0x03, 0xfb, 0x60, 0x3b, 0x68, 0x5b, 0x68, 0xfa, 0x68, 0x13, 0x43, 0xfb, 0x60, 0x7b, 0x68, 0x1c, 0x4a, 0x93, 0x42, 0x0b, 0xd0, 0x7b, 0x68, 0xb3, 0xf1, 0x80, 0x4f, 0x07, 0xd0, 0x7b, 0x68,
-    0x19, 0x4a, 0x93, 0x42, 0x03, 0xd0, 0x7b, 0x68, 0x18, 0x4a, 0x93, 0x42, 0x08, 0xd1, 0xfb, 0x68, 0x23, 0xf4, 0x40, 0x73, 0xfb, 0x60, 0x3b, 0x68, 0xdb, 0x68, 0xfa, 0x68, 0x13, 0x43, 0xfb, 0x60,
-    0xfb, 0x68, 0x23, 0xf0, 0x80, 0x02, 0x3b, 0x68, 0x5b, 0x69, 0x13, 0x43, 0xfb, 0x60, 0x7b, 0x68, 0xfa, 0x68, 0x1a, 0x60, 0x3b, 0x68, 0x9a, 0x68, 0x7b, 0x68, 0xda, 0x62, 0x3b, 0x68, 0x1a, 0x68,
-    0x7b, 0x68, 0x9a, 0x62, 0x7b, 0x68, 0x07, 0x4a, 0x93, 0x42, 0x03, 0xd1, 0x3b, 0x68, 0x1a, 0x69, 0x7b, 0x68, 0x1a, 0x63, 0x7b, 0x68, 0x01, 0x22, 0x5a, 0x61, 0x00, 0xbf, 0x14, 0x37, 0xbd, 0x46,
-    0x80, 0xbc, 0x70, 0x47, 0x00, 0x2c, 0x01, 0x40, 0x00, 0x04, 0x00, 0x40, 0x00, 0x08, 0x00, 0x40, 0x80, 0xb4, 0x87, 0xb0, 0x00, 0xaf, 0xf8, 0x60, 0xb9, 0x60, 0x7a, 0x60, 0xfb, 0x68, 0x1b, 0x6a,
-    0x7b, 0x61, 0xfb, 0x68, 0x1b, 0x6a, 0x23, 0xf0, 0x01, 0x02, 0xfb, 0x68, 0x1a, 0x62, 0xfb, 0x68, 0x9b, 0x69, 0x3b, 0x61, 0x3b, 0x69, 0x23, 0xf0, 0xf0, 0x03, 0x3b, 0x61, 0x7b, 0x68, 0x1b, 0x01,
-    0x3a, 0x69, 0x13, 0x43, 0x3b, 0x61, 0x7b, 0x69, 0x23, 0xf0, 0x0a, 0x03, 0x7b, 0x61, 0x7a, 0x69, 0xbb, 0x68, 0x13, 0x43, 0x7b, 0x61, 0xfb, 0x68, 0x3a, 0x69, 0x9a, 0x61, 0xfb, 0x68, 0x7a, 0x69,
-    0x1a, 0x62, 0x00, 0xbf, 0x1c, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb4, 0x87, 0xb0, 0x00, 0xaf, 0xf8, 0x60, 0xb9, 0x60, 0x7a, 0x60, 0xfb, 0x68, 0x1b, 0x6a, 0x23, 0xf0, 0x10, 0x02,
-    0xfb, 0x68, 0x1a, 0x62, 0xfb, 0x68, 0x9b, 0x69, 0x7b, 0x61, 0xfb, 0x68, 0x1b, 0x6a, 0x3b, 0x61, 0x7b, 0x69, 0x23, 0xf4, 0x70, 0x43, 0x7b, 0x61, 0x7b, 0x68, 0x1b, 0x03, 0x7a, 0x69, 0x13, 0x43,
-    0x7b, 0x61, 0x3b, 0x69, 0x23, 0xf0, 0xa0, 0x03, 0x3b, 0x61, 0xbb, 0x68, 0x1b, 0x01, 0x3a, 0x69, 0x13, 0x43, 0x3b, 0x61, 0xfb, 0x68, 0x7a, 0x69, 0x9a, 0x61, 0xfb, 0x68, 0x3a, 0x69, 0x1a, 0x62,
-    0x00, 0xbf, 0x1c, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb4, 0x85, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x39, 0x60, 0x7b, 0x68, 0x9b, 0x68, 0xfb, 0x60, 0xfb, 0x68, 0x23, 0xf0, 0x70, 0x03,
-    0xfb, 0x60, 0x3a, 0x68, 0xfb, 0x68, 0x13, 0x43, 0x43, 0xf0, 0x07, 0x03, 0xfb, 0x60, 0x7b, 0x68, 0xfa, 0x68, 0x9a, 0x60, 0x00, 0xbf, 0x14, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb4,
-    0x87, 0xb0, 0x00, 0xaf, 0xf8, 0x60, 0xb9, 0x60, 0x7a, 0x60, 0x3b, 0x60, 0xfb, 0x68, 0x9b, 0x68, 0x7b, 0x61, 0x7b, 0x69, 0x23, 0xf4, 0x7f, 0x43, 0x7b, 0x61, 0x3b, 0x68, 0x1a, 0x02, 0x7b, 0x68,
-    0x1a, 0x43, 0xbb, 0x68, 0x13, 0x43, 0x7a, 0x69, 0x13, 0x43, 0x7b, 0x61, 0xfb, 0x68, 0x7a, 0x69, 0x9a, 0x60, 0x00, 0xbf, 0x1c, 0x37, 0xbd, 0x46, 0x80, 0xbc, 0x70, 0x47, 0x80, 0xb4, 0x85, 0xb0,
-    0x00, 0xaf, 0x78, 0x60, 0x39, 0x60, 0x7b, 0x68, 0x93, 0xf8, 0x3c, 0x30, 0x01, 0x2b, 0x01, 0xd1, 0x02, 0x23, 0x32, 0xe0, 0x7b, 0x68, 0x01, 0x22, 0x83, 0xf8, 0x3c, 0x20, 0x7b, 0x68, 0x02, 0x22,
-    0x83, 0xf8, 0x3d, 0x20, 0x7b, 0x68, 0x1b, 0x68, 0x5b, 0x68, 0xfb, 0x60, 0x7b, 0x68, 0x1b, 0x68, 0x9b, 0x68, 0xbb, 0x60, 0xfb, 0x68, 0x23, 0xf0, 0x70, 0x03, 0xfb, 0x60, 0x3b, 0x68, 0x1b, 0x68,
-    0xfa, 0x68, 0x13, 0x43, 0xfb, 0x60, 0xbb, 0x68, 0x23, 0xf0, 0x80, 0x03, 0xbb, 0x60, 0x3b, 0x68, 0x5b, 0x68, 0xba, 0x68, 0x13, 0x43, 0xbb, 0x60, 0x7b, 0x68, 0x1b, 0x68, 0xfa, 0x68, 0x5a, 0x60,
-    0x7b, 0x68, 0x1b, 0x68, 0xba, 0x68, 0x9a, 0x60, 0x7b, 0x68, 0x01, 0x22, 0x83, 0xf8, 0x3d, 0x20, 0x7b, 0x68, 0x00, 0x22, 0x83, 0xf8, 0x3c, 0x20, 0x00, 0x23, 0x18, 0x46, 0x14, 0x37, 0xbd, 0x46,
-    0x80, 0xbc, 0x70, 0x47, 0x70, 0xb5, 0x00, 0x25, 0x0c, 0x4e, 0x0d, 0x4c, 0xa4, 0x1b, 0xa4, 0x10, 0xa5, 0x42, 0x09, 0xd1, 0x00, 0xf0, 0x22, 0xf8, 0x00, 0x25, 0x0a, 0x4e, 0x0a, 0x4c, 0xa4, 0x1b,
-    0xa4, 0x10, 0xa5, 0x42, 0x05, 0xd1, 0x70, 0xbd, 0x56, 0xf8, 0x25, 0x30, 0x98, 0x47, 0x01, 0x35, 0xee, 0xe7, 0x56, 0xf8, 0x25, 0x30, 0x98, 0x47, 0x01, 0x35, 0xf2, 0xe7, 0xb4, 0x42, 0x00, 0x08,
-    0xb4, 0x42, 0x00, 0x08, 0xb4, 0x42, 0x00, 0x08, 0xb8, 0x42, 0x00, 0x08, 0x03, 0x46, 0x02, 0x44, 0x93, 0x42, 0x00, 0xd1, 0x70, 0x47, 0x03, 0xf8, 0x01, 0x1b, 0xf9, 0xe7, 0xf8, 0xb5, 0x00, 0xbf,
-    0xf8, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0x70, 0x47, 0xf8, 0xb5, 0x00, 0xbf, 0xf8, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0x70, 0x47, 0x4e, 0x45, 0x57, 0x20, 0x41, 0x50, 0x50, 0x20, 0x48, 0x45, 0x52, 0x45,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45, 0x44, 0x2e, 0x2e, 0x2e, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x10,
-    0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x31, 0x29, 0x00, 0x08, 0x0d, 0x29, 0x00, 0x08, 0x00, 0x24, 0xf4, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00};
+const TxFrame_t dataToWrite[] = {
+    /* Image header: plain image of 7168 bytes for the new firmware slot, version 1 */
+    {0x24600001, 0x00000008, 0x31474d49, 0x00000000},
+    {0x24400001, 0x00000008, 0x00001c00, 0x0800dc00},
+    {0x24600001, 0x00000008, 0x00000001, 0x8aa6a348},
+    {0x24400001, 0x00000008, 0x00001c00, 0x00000000},
+    {0x24600001, 0x00000008, 0x00000000, 0x8b648caf},
 
+    /* Image */
+    {0x24400001, 0x00000008, 0x20005000, 0x08002fad},
+    {0x24600001, 0x00000008, 0x08002ef1, 0x08002efd},
+    {0x24400001, 0x00000008, 0x08002f03, 0x08002f09},
+    {0x24600001, 0x00000008, 0x08002f0f, 0x00000000},
+    {0x24400001, 0x00000008, 0x00000000, 0x00000000},
+    {0x24600001, 0x00000008, 0x00000000, 0x08002f15},
+    {0x24400001, 0x00000008, 0x08002f21, 0x00000000},
+    {0x24600001, 0x00000008, 0x08002f2d, 0x08002f39},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24400001, 0x00000008, 0x08002ff5, 0x08002ff5},
+    {0x24600001, 0x00000008, 0x08002ff5, 0x00000000},
+    {0x24400001, 0x00000008, 0x00000000, 0x00000000},
+    {0x24600001, 0x00000008, 0x00000000, 0x00000000},
+    {0x24400001, 0x00000008, 0x00000000, 0x00000000},
+    {0x24600001, 0x00000008, 0xf108f85f, 0x4c05b510},
+    {0x24400001, 0x00000008, 0xb9337823, 0xb1134b04},
+    {0x24600001, 0x00000008, 0xf3af4804, 0x23018000},
+    {0x24400001, 0x00000008, 0xbd107023, 0x2000000c},
+    {0x24600001, 0x00000008, 0x00000000, 0x0800425c},
+    {0x24400001, 0x00000008, 0x4b03b508, 0x4903b11b},
+    {0x24600001, 0x00000008, 0xf3af4803, 0xbd088000},
+    {0x24400001, 0x00000008, 0x00000000, 0x20000010},
+    {0x24600001, 0x00000008, 0x0800425c, 0xb083b480},
+    {0x24400001, 0x00000008, 0x4603af00, 0x4b0880fb},
+    {0x24600001, 0x00000008, 0x2200681b, 0xbf00625a},
+    {0x24400001, 0x00000008, 0x681b4b05, 0x88fb6a5a},
+    {0x24600001, 0x00000008, 0xd3f9429a, 0x370cbf00},
+    {0x24400001, 0x00000008, 0xbc8046bd, 0xbf004770},
+    {0x24600001, 0x00000008, 0x20000028, 0xb082b580},
+    {0x24400001, 0x00000008, 0x4603af00, 0x71fb6039},
+    {0x24600001, 0x00000008, 0xb2db683b, 0xf44f461a},
+    {0x24400001, 0x00000008, 0x48236100, 0xfdf2f000},
+    {0x24600001, 0x00000008, 0x08db79fb, 0xf003b2db},
+    {0x24400001, 0x00000008, 0xb2db0301, 0xf44f461a},
+    {0x24600001, 0x00000008, 0x481e5180, 0xfde6f000},
+    {0x24400001, 0x00000008, 0x089b79fb, 0xf003b2db},
+    {0x24600001, 0x00000008, 0xb2db0301, 0xf44f461a},
+    {0x24400001, 0x00000008, 0x48185100, 0xfddaf000},
+    {0x24600001, 0x00000008, 0x085b79fb, 0xf003b2db},
+    {0x24400001, 0x00000008, 0xb2db0301, 0xf44f461a},
+    {0x24600001, 0x00000008, 0x48124180, 0xfdcef000},
+    {0x24400001, 0x00000008, 0xf00379fb, 0xb2db0301},
+    {0x24600001, 0x00000008, 0xf44f461a, 0x480d4100},
+    {0x24400001, 0x00000008, 0xfdc4f000, 0xf44f2201},
+    {0x24600001, 0x00000008, 0x48097180, 0xfdbef000},
+    {0x24400001, 0x00000008, 0xf7ff2014, 0x2200ffa3},
+    {0x24600001, 0x00000008, 0x7180f44f, 0xf0004804},
+    {0x24400001, 0x00000008, 0x2014fdb5, 0xff9af7ff},
+    {0x24600001, 0x00000008, 0x3708bf00, 0xbd8046bd},
+    {0x24400001, 0x00000008, 0x40010800, 0x40010c00},
+    {0x24600001, 0x00000008, 0xb084b580, 0x4603af00},
+    {0x24400001, 0x00000008, 0x79fb71fb, 0x73fb091b},
+    {0x24600001, 0x00000008, 0x21007bfb, 0xf7ff4618},
+    {0x24400001, 0x00000008, 0x79fbff9d, 0x030ff003},
+    {0x24600001, 0x00000008, 0x7bfb73fb, 0x46182100},
+    {0x24400001, 0x00000008, 0xff94f7ff, 0x3710bf00},
+    {0x24600001, 0x00000008, 0xbd8046bd, 0xb084b580},
+    {0x24400001, 0x00000008, 0x4603af00, 0x79fb71fb},
+    {0x24600001, 0x00000008, 0x73fb091b, 0x21017bfb},
+    {0x24400001, 0x00000008, 0xf7ff4618, 0x79fbff83},
+    {0x24600001, 0x00000008, 0x030ff003, 0x7bfb73fb},
+    {0x24400001, 0x00000008, 0x46182101, 0xff7af7ff},
+    {0x24600001, 0x00000008, 0x3710bf00, 0xbd8046bd},
+    {0x24400001, 0x00000008, 0xaf00b580, 0xf7ff2001},
+    {0x24600001, 0x00000008, 0x2002ffc7, 0xfb0ef000},
+    {0x24400001, 0x00000008, 0xbd80bf00, 0xb082b580},
+    {0x24600001, 0x00000008, 0x6078af00, 0x687b6039},
+    {0x24400001, 0x00000008, 0xd0022b00, 0xd0052b01},
+    {0x24600001, 0x00000008, 0x683be009, 0x0380f043},
+    {0x24400001, 0x00000008, 0xe004603b, 0xf043683b},
+    {0x24600001, 0x00000008, 0x603b03c0, 0x683bbf00},
+    {0x24400001, 0x00000008, 0x4618b2db, 0xffa8f7ff},
+    {0x24600001, 0x00000008, 0x3708bf00, 0xbd8046bd},
+    {0x24400001, 0x00000008, 0xaf00b580, 0xf0002032},
+    {0x24600001, 0x00000008, 0x2030fae9, 0xff9cf7ff},
+    {0x24400001, 0x00000008, 0xf0002005, 0x2030fae3},
+    {0x24600001, 0x00000008, 0xff96f7ff, 0xf0002001},
+    {0x24400001, 0x00000008, 0x2030fadd, 0xff90f7ff},
+    {0x24600001, 0x00000008, 0xf000200a, 0x2020fad7},
+    {0x24400001, 0x00000008, 0xff8af7ff, 0xf000200a},
+    {0x24600001, 0x00000008, 0x2028fad1, 0xff84f7ff},
+    {0x24400001, 0x00000008, 0xf0002001, 0x2008facb},
+    {0x24600001, 0x00000008, 0xff7ef7ff, 0xf0002001},
+    {0x24400001, 0x00000008, 0x2001fac5, 0xff78f7ff},
+    {0x24600001, 0x00000008, 0xf0002001, 0x2001fabf},
+    {0x24400001, 0x00000008, 0xfabcf000, 0xf7ff2006},
+    {0x24600001, 0x00000008, 0x2001ff6f, 0xfab6f000},
+    {0x24400001, 0x00000008, 0xf7ff200c, 0xbf00ff69},
+    {0x24600001, 0x00000008, 0xb580bd80, 0xaf00b082},
+    {0x24400001, 0x00000008, 0xe0066078, 0x1c5a687b},
+    {0x24600001, 0x00000008, 0x781b607a, 0xf7ff4618},
+    {0x24400001, 0x00000008, 0x687bff75, 0x2b00781b},
+    {0x24600001, 0x00000008, 0xbf00d1f4, 0x46bd3708},
+    {0x24400001, 0x00000008, 0xb580bd80, 0x2000af00},
+    {0x24600001, 0x00000008, 0xf80ef000, 0xf0002000},
+    {0x24400001, 0x00000008, 0x2000f80b, 0xf808f000},
+    {0x24600001, 0x00000008, 0xf0002004, 0x2002f805},
+    {0x24400001, 0x00000008, 0xf802f000, 0xbd80bf00},
+    {0x24600001, 0x00000008, 0xb082b580, 0x4603af00},
+    {0x24400001, 0x00000008, 0x79fb71fb, 0xd0022b02},
+    {0x24600001, 0x00000008, 0xd0002b04, 0x79fbe007},
+    {0x24400001, 0x00000008, 0x2200b29b, 0x48044619},
+    {0x24600001, 0x00000008, 0xfcd8f000, 0xbf00bf00},
+    {0x24400001, 0x00000008, 0x46bd3708, 0xbf00bd80},
+    {0x24600001, 0x00000008, 0x40010800, 0xaf00b580},
+    {0x24400001, 0x00000008, 0xfa0af000, 0xf82af000},
+    {0x24600001, 0x00000008, 0xf8a6f000, 0xffc9f7ff},
+    {0x24400001, 0x00000008, 0xf860f000, 0xf001480d},
+    {0x24600001, 0x00000008, 0xf7fff8ee, 0xf7ffff71},
+    {0x24400001, 0x00000008, 0x2100ff47, 0xf7ff2000},
+    {0x24600001, 0x00000008, 0x4809ff4d, 0xffa5f7ff},
+    {0x24400001, 0x00000008, 0x20012104, 0xff46f7ff},
+    {0x24600001, 0x00000008, 0xf7ff4806, 0x2201ff9e},
+    {0x24400001, 0x00000008, 0x4180f44f, 0xf0004804},
+    {0x24600001, 0x00000008, 0xe7fefca9, 0x20000028},
+    {0x24400001, 0x00000008, 0x08004274, 0x08004284},
+    {0x24600001, 0x00000008, 0x40011000, 0xb090b580},
+    {0x24400001, 0x00000008, 0xf107af00, 0x22280318},
+    {0x24600001, 0x00000008, 0x46182100, 0xfafef001},
+    {0x24400001, 0x00000008, 0x22001d3b, 0x605a601a},
+    {0x24600001, 0x00000008, 0x60da609a, 0x2302611a},
+    {0x24400001, 0x00000008, 0x230161bb, 0x231062bb},
+    {0x24600001, 0x00000008, 0x230062fb, 0xf107637b},
+    {0x24400001, 0x00000008, 0x46180318, 0xfc9af000},
+    {0x24600001, 0x00000008, 0x2b004603, 0xf000d001},
+    {0x24400001, 0x00000008, 0x230ff8e1, 0x2300607b},
+    {0x24600001, 0x00000008, 0x230060bb, 0x230060fb},
+    {0x24400001, 0x00000008, 0x2300613b, 0x1d3b617b},
+    {0x24600001, 0x00000008, 0x46182100, 0xff06f000},
+    {0x24400001, 0x00000008, 0x2b004603, 0xf000d001},
+    {0x24600001, 0x00000008, 0xbf00f8cd, 0x46bd3740},
+    {0x24400001, 0x00000008, 0x0000bd80, 0xb086b580},
+    {0x24600001, 0x00000008, 0xf107af00, 0x22000308},
+    {0x24400001, 0x00000008, 0x605a601a, 0x60da609a},
+    {0x24600001, 0x00000008, 0x2200463b, 0x605a601a},
+    {0x24400001, 0x00000008, 0x4a184b17, 0x4b16601a},
+    {0x24600001, 0x00000008, 0x605a2247, 0x22004b14},
+    {0x24400001, 0x00000008, 0x4b13609a, 0x72fef64f},
+    {0x24600001, 0x00000008, 0x4b1160da, 0x611a2200},
+    {0x24400001, 0x00000008, 0x22004b0f, 0x4b0e615a},
+    {0x24600001, 0x00000008, 0x619a2200, 0xf001480c},
+    {0x24400001, 0x00000008, 0xf44ff83f, 0x60bb5380},
+    {0x24600001, 0x00000008, 0x0308f107, 0x48084619},
+    {0x24400001, 0x00000008, 0xf884f001, 0x603b2300},
+    {0x24600001, 0x00000008, 0x607b2300, 0x4619463b},
+    {0x24400001, 0x00000008, 0xf0014803, 0xbf00fa2b},
+    {0x24600001, 0x00000008, 0x46bd3718, 0xbf00bd80},
+    {0x24400001, 0x00000008, 0x20000028, 0x40012c00},
+    {0x24600001, 0x00000008, 0xb088b580, 0xf107af00},
+    {0x24400001, 0x00000008, 0x22000310, 0x605a601a},
+    {0x24600001, 0x00000008, 0x60da609a, 0x699b4b39},
+    {0x24400001, 0x00000008, 0xf0434a38, 0x61930310},
+    {0x24600001, 0x00000008, 0x699b4b36, 0x0310f003},
+    {0x24400001, 0x00000008, 0x68fb60fb, 0x699b4b33},
+    {0x24600001, 0x00000008, 0xf0434a32, 0x61930320},
+    {0x24400001, 0x00000008, 0x699b4b30, 0x0320f003},
+    {0x24600001, 0x00000008, 0x68bb60bb, 0x699b4b2d},
+    {0x24400001, 0x00000008, 0xf0434a2c, 0x61930304},
+    {0x24600001, 0x00000008, 0x699b4b2a, 0x0304f003},
+    {0x24400001, 0x00000008, 0x687b607b, 0x699b4b27},
+    {0x24600001, 0x00000008, 0xf0434a26, 0x61930308},
+    {0x24400001, 0x00000008, 0x699b4b24, 0x0308f003},
+    {0x24600001, 0x00000008, 0x683b603b, 0xf44f2200},
+    {0x24400001, 0x00000008, 0x48214160, 0xfbe2f000},
+    {0x24600001, 0x00000008, 0xf6402200, 0x481f1106},
+    {0x24400001, 0x00000008, 0xfbdcf000, 0xf44f2200},
+    {0x24600001, 0x00000008, 0x481d4170, 0xfbd6f000},
+    {0x24400001, 0x00000008, 0x4360f44f, 0x2301613b},
+    {0x24600001, 0x00000008, 0x2300617b, 0x230261bb},
+    {0x24400001, 0x00000008, 0xf10761fb, 0x46190310},
+    {0x24600001, 0x00000008, 0xf0004813, 0xf640fa6d},
+    {0x24400001, 0x00000008, 0x613b1306, 0x617b2301},
+    {0x24600001, 0x00000008, 0x61bb2300, 0x61fb2302},
+    {0x24400001, 0x00000008, 0x0310f107, 0x480d4619},
+    {0x24600001, 0x00000008, 0xfa5ef000, 0x4370f44f},
+    {0x24400001, 0x00000008, 0x2301613b, 0x2300617b},
+    {0x24600001, 0x00000008, 0x230261bb, 0xf10761fb},
+    {0x24400001, 0x00000008, 0x46190310, 0xf0004806},
+    {0x24600001, 0x00000008, 0xbf00fa4f, 0x46bd3720},
+    {0x24400001, 0x00000008, 0xbf00bd80, 0x40021000},
+    {0x24600001, 0x00000008, 0x40011000, 0x40010800},
+    {0x24400001, 0x00000008, 0x40010c00, 0xaf00b480},
+    {0x24600001, 0x00000008, 0x46bdbf00, 0x4770bc80},
+    {0x24400001, 0x00000008, 0xb085b480, 0x4b15af00},
+    {0x24600001, 0x00000008, 0x4a14699b, 0x0301f043},
+    {0x24400001, 0x00000008, 0x4b126193, 0xf003699b},
+    {0x24600001, 0x00000008, 0x60bb0301, 0x4b0f68bb},
+    {0x24400001, 0x00000008, 0x4a0e69db, 0x5380f043},
+    {0x24600001, 0x00000008, 0x4b0c61d3, 0xf00369db},
+    {0x24400001, 0x00000008, 0x607b5380, 0x4b0a687b},
+    {0x24600001, 0x00000008, 0x60fb685b, 0xf02368fb},
+    {0x24400001, 0x00000008, 0x60fb63e0, 0xf04368fb},
+    {0x24600001, 0x00000008, 0x60fb7300, 0x68fb4a04},
+    {0x24400001, 0x00000008, 0xbf006053, 0x46bd3714},
+    {0x24600001, 0x00000008, 0x4770bc80, 0x40021000},
+    {0x24400001, 0x00000008, 0x40010000, 0xb085b480},
+    {0x24600001, 0x00000008, 0x6078af00, 0x681b687b},
+    {0x24400001, 0x00000008, 0x42934a09, 0x4b09d10b},
+    {0x24600001, 0x00000008, 0x4a08699b, 0x6300f443},
+    {0x24400001, 0x00000008, 0x4b066193, 0xf403699b},
+    {0x24600001, 0x00000008, 0x60fb6300, 0xbf0068fb},
+    {0x24400001, 0x00000008, 0x46bd3714, 0x4770bc80},
+    {0x24600001, 0x00000008, 0x40012c00, 0x40021000},
+    {0x24400001, 0x00000008, 0xaf00b480, 0x46bdbf00},
+    {0x24600001, 0x00000008, 0x4770bc80, 0xaf00b480},
+    {0x24400001, 0x00000008, 0xb480e7fe, 0xe7feaf00},
+    {0x24600001, 0x00000008, 0xaf00b480, 0xb480e7fe},
+    {0x24400001, 0x00000008, 0xe7feaf00, 0xaf00b480},
+    {0x24600001, 0x00000008, 0x46bdbf00, 0x4770bc80},
+    {0x24400001, 0x00000008, 0xaf00b480, 0x46bdbf00},
+    {0x24600001, 0x00000008, 0x4770bc80, 0xaf00b480},
+    {0x24400001, 0x00000008, 0x46bdbf00, 0x4770bc80},
+    {0x24600001, 0x00000008, 0xaf00b580, 0xf8a2f000},
+    {0x24400001, 0x00000008, 0xbd80bf00, 0xaf00b480},
+    {0x24600001, 0x00000008, 0x681b4b15, 0xf0434a14},
+    {0x24400001, 0x00000008, 0x60130301, 0x685a4b12},
+    {0x24600001, 0x00000008, 0x4b124911, 0x604b4013},
+    {0x24400001, 0x00000008, 0x681b4b0f, 0xf0234a0e},
+    {0x24600001, 0x00000008, 0xf4237384, 0x60133380},
+    {0x24400001, 0x00000008, 0x681b4b0b, 0xf4234a0a},
+    {0x24600001, 0x00000008, 0x60132380, 0x685b4b08},
+    {0x24400001, 0x00000008, 0xf4234a07, 0x605303fe},
+    {0x24600001, 0x00000008, 0xf44f4b05, 0x609a021f},
+    {0x24400001, 0x00000008, 0xf04f4b05, 0x609a6200},
+    {0x24600001, 0x00000008, 0x46bdbf00, 0x4770bc80},
+    {0x24400001, 0x00000008, 0x40021000, 0xf8ff0000},
+    {0x24600001, 0x00000008, 0xe000ed00, 0xe0032100},
+    {0x24400001, 0x00000008, 0x585b4b0b, 0x31045043},
+    {0x24600001, 0x00000008, 0x4b0b480a, 0x429a1842},
+    {0x24400001, 0x00000008, 0x4a0ad3f6, 0x2300e002},
+    {0x24600001, 0x00000008, 0x3b04f842, 0x429a4b08},
+    {0x24400001, 0x00000008, 0xf7ffd3f9, 0xf001ffb7},
+    {0x24600001, 0x00000008, 0xf7fff915, 0x4770fdff},
+    {0x24400001, 0x00000008, 0x080042bc, 0x20000000},
+    {0x24600001, 0x00000008, 0x2000000c, 0x2000000c},
+    {0x24400001, 0x00000008, 0x2000006c, 0x0000e7fe},
+    {0x24600001, 0x00000008, 0xaf00b580, 0x681b4b08},
+    {0x24400001, 0x00000008, 0xf0434a07, 0x60130310},
+    {0x24600001, 0x00000008, 0xf0002003, 0x2000f929},
+    {0x24400001, 0x00000008, 0xf808f000, 0xff1cf7ff},
+    {0x24600001, 0x00000008, 0x46182300, 0xbf00bd80},
+    {0x24400001, 0x00000008, 0x40022000, 0xb082b580},
+    {0x24600001, 0x00000008, 0x6078af00, 0x681a4b12},
+    {0x24400001, 0x00000008, 0x781b4b12, 0xf44f4619},
+    {0x24600001, 0x00000008, 0xfbb3737a, 0xfbb2f3f1},
+    {0x24400001, 0x00000008, 0x4618f3f3, 0xf933f000},
+    {0x24600001, 0x00000008, 0x2b004603, 0x2301d001},
+    {0x24400001, 0x00000008, 0x687be00e, 0xd80a2b0f},
+    {0x24600001, 0x00000008, 0x68792200, 0x30fff04f},
+    {0x24400001, 0x00000008, 0xf909f000, 0x687b4a06},
+    {0x24600001, 0x00000008, 0x23006013, 0x2301e000},
+    {0x24400001, 0x00000008, 0x37084618, 0xbd8046bd},
+    {0x24600001, 0x00000008, 0x20000000, 0x20000008},
+    {0x24400001, 0x00000008, 0x20000004, 0xaf00b480},
+    {0x24600001, 0x00000008, 0x781b4b05, 0x4b05461a},
+    {0x24400001, 0x00000008, 0x4413681b, 0x60134a03},
+    {0x24600001, 0x00000008, 0x46bdbf00, 0x4770bc80},
+    {0x24400001, 0x00000008, 0x20000008, 0x20000068},
+    {0x24600001, 0x00000008, 0xaf00b480, 0x681b4b02},
+    {0x24400001, 0x00000008, 0x46bd4618, 0x4770bc80},
+    {0x24600001, 0x00000008, 0x20000068, 0xb084b580},
+    {0x24400001, 0x00000008, 0x6078af00, 0xfff0f7ff},
+    {0x24600001, 0x00000008, 0x687b60b8, 0x68fb60fb},
+    {0x24400001, 0x00000008, 0x3ffff1b3, 0x4b09d005},
+    {0x24600001, 0x00000008, 0x461a781b, 0x441368fb},
+    {0x24400001, 0x00000008, 0xbf0060fb, 0xffe0f7ff},
+    {0x24600001, 0x00000008, 0x68bb4602, 0x68fa1ad3},
+    {0x24400001, 0x00000008, 0xd8f7429a, 0x3710bf00},
+    {0x24600001, 0x00000008, 0xbd8046bd, 0x20000008},
+    {0x24400001, 0x00000008, 0xb085b480, 0x6078af00},
+    {0x24600001, 0x00000008, 0xf003687b, 0x60fb0307},
+    {0x24400001, 0x00000008, 0x68db4b0c, 0x68ba60bb},
+    {0x24600001, 0x00000008, 0x03fff64f, 0x60bb4013},
+    {0x24400001, 0x00000008, 0x021a68fb, 0x431368bb},
+    {0x24600001, 0x00000008, 0x63bff043, 0x3300f443},
+    {0x24400001, 0x00000008, 0x4a0460bb, 0x60d368bb},
+    {0x24600001, 0x00000008, 0x3714bf00, 0xbc8046bd},
+    {0x24400001, 0x00000008, 0xbf004770, 0xe000ed00},
+    {0x24600001, 0x00000008, 0xaf00b480, 0x68db4b04},
+    {0x24400001, 0x00000008, 0xf0030a1b, 0x46180307},
+    {0x24600001, 0x00000008, 0xbc8046bd, 0xbf004770},
+    {0x24400001, 0x00000008, 0xe000ed00, 0xb083b480},
+    {0x24600001, 0x00000008, 0x4603af00, 0x71fb6039},
+    {0x24400001, 0x00000008, 0x3007f997, 0xdb0a2b00},
+    {0x24600001, 0x00000008, 0xb2da683b, 0xf997490c},
+    {0x24400001, 0x00000008, 0x01123007, 0x440bb2d2},
+    {0x24600001, 0x00000008, 0x2300f883, 0x683be00a},
+    {0x24400001, 0x00000008, 0x4908b2da, 0xf00379fb},
+    {0x24600001, 0x00000008, 0x3b04030f, 0xb2d20112},
+    {0x24400001, 0x00000008, 0x761a440b, 0x370cbf00},
+    {0x24600001, 0x00000008, 0xbc8046bd, 0xbf004770},
+    {0x24400001, 0x00000008, 0xe000e100, 0xe000ed00},
+    {0x24600001, 0x00000008, 0xb089b480, 0x60f8af00},
+    {0x24400001, 0x00000008, 0x607a60b9, 0xf00368fb},
+    {0x24600001, 0x00000008, 0x61fb0307, 0xf1c369fb},
+    {0x24400001, 0x00000008, 0x2b040307, 0x2304bf28},
+    {0x24600001, 0x00000008, 0x69fb61bb, 0x2b063304},
+    {0x24400001, 0x00000008, 0x69fbd902, 0xe0003b03},
+    {0x24600001, 0x00000008, 0x617b2300, 0x32fff04f},
+    {0x24400001, 0x00000008, 0xfa0269bb, 0x43daf303},
+    {0x24600001, 0x00000008, 0x401a68bb, 0x409a697b},
+    {0x24400001, 0x00000008, 0x31fff04f, 0xfa01697b},
+    {0x24600001, 0x00000008, 0x43d9f303, 0x400b687b},
+    {0x24400001, 0x00000008, 0x46184313, 0x46bd3724},
+    {0x24600001, 0x00000008, 0x4770bc80, 0xb082b580},
+    {0x24400001, 0x00000008, 0x6078af00, 0x3b01687b},
+    {0x24600001, 0x00000008, 0x7f80f1b3, 0x2301d301},
+    {0x24400001, 0x00000008, 0x4a0ae00f, 0x3b01687b},
+    {0x24600001, 0x00000008, 0x210f6053, 0x30fff04f},
+    {0x24400001, 0x00000008, 0xff90f7ff, 0x22004b05},
+    {0x24600001, 0x00000008, 0x4b04609a, 0x601a2207},
+    {0x24400001, 0x00000008, 0x46182300, 0x46bd3708},
+    {0x24600001, 0x00000008, 0xbf00bd80, 0xe000e010},
+    {0x24400001, 0x00000008, 0xb082b580, 0x6078af00},
+    {0x24600001, 0x00000008, 0xf7ff6878, 0xbf00ff49},
+    {0x24400001, 0x00000008, 0x46bd3708, 0xb580bd80},
+    {0x24600001, 0x00000008, 0xaf00b086, 0x60b94603},
+    {0x24400001, 0x00000008, 0x73fb607a, 0x617b2300},
+    {0x24600001, 0x00000008, 0xff5ef7ff, 0x687a6178},
+    {0x24400001, 0x00000008, 0x697868b9, 0xff90f7ff},
+    {0x24600001, 0x00000008, 0xf9974602, 0x4611300f},
+    {0x24400001, 0x00000008, 0xf7ff4618, 0xbf00ff5f},
+    {0x24600001, 0x00000008, 0x46bd3718, 0xb580bd80},
+    {0x24400001, 0x00000008, 0xaf00b082, 0x68786078},
+    {0x24600001, 0x00000008, 0xffb0f7ff, 0x46184603},
+    {0x24400001, 0x00000008, 0x46bd3708, 0x0000bd80},
+    {0x24600001, 0x00000008, 0xb08bb480, 0x6078af00},
+    {0x24400001, 0x00000008, 0x23006039, 0x2300627b},
+    {0x24600001, 0x00000008, 0xe127623b, 0x6a7b2201},
+    {0x24400001, 0x00000008, 0xf303fa02, 0x683b61fb},
+    {0x24600001, 0x00000008, 0x69fa681b, 0x61bb4013},
+    {0x24400001, 0x00000008, 0x69fb69ba, 0xf040429a},
+    {0x24600001, 0x00000008, 0x683b8116, 0x2b12685b},
+    {0x24400001, 0x00000008, 0x2b12d034, 0x2b02d80d},
+    {0x24600001, 0x00000008, 0x2b02d02b, 0x2b00d804},
+    {0x24400001, 0x00000008, 0x2b01d031, 0xe048d01c},
+    {0x24600001, 0x00000008, 0xd0432b03, 0xd01b2b11},
+    {0x24400001, 0x00000008, 0x4a89e043, 0xd0264293},
+    {0x24600001, 0x00000008, 0x42934a87, 0x4a87d806},
+    {0x24400001, 0x00000008, 0xd0204293, 0x42934a86},
+    {0x24600001, 0x00000008, 0xe036d01d, 0x42934a85},
+    {0x24400001, 0x00000008, 0x4a85d019, 0xd0164293},
+    {0x24600001, 0x00000008, 0x42934a84, 0xe02cd013},
+    {0x24400001, 0x00000008, 0x68db683b, 0xe028623b},
+    {0x24600001, 0x00000008, 0x68db683b, 0x623b3304},
+    {0x24400001, 0x00000008, 0x683be023, 0x330868db},
+    {0x24600001, 0x00000008, 0xe01e623b, 0x68db683b},
+    {0x24400001, 0x00000008, 0x623b330c, 0x683be019},
+    {0x24600001, 0x00000008, 0x2b00689b, 0x2304d102},
+    {0x24400001, 0x00000008, 0xe012623b, 0x689b683b},
+    {0x24600001, 0x00000008, 0xd1052b01, 0x623b2308},
+    {0x24400001, 0x00000008, 0x69fa687b, 0xe008611a},
+    {0x24600001, 0x00000008, 0x623b2308, 0x69fa687b},
+    {0x24400001, 0x00000008, 0xe002615a, 0x623b2300},
+    {0x24600001, 0x00000008, 0x69bbbf00, 0xd8012bff},
+    {0x24400001, 0x00000008, 0xe001687b, 0x3304687b},
+    {0x24600001, 0x00000008, 0x69bb617b, 0xd8022bff},
+    {0x24400001, 0x00000008, 0x009b6a7b, 0x6a7be002},
+    {0x24600001, 0x00000008, 0x009b3b08, 0x697b613b},
+    {0x24400001, 0x00000008, 0x210f681a, 0xfa01693b},
+    {0x24600001, 0x00000008, 0x43dbf303, 0x6a39401a},
+    {0x24400001, 0x00000008, 0xfa01693b, 0x431af303},
+    {0x24600001, 0x00000008, 0x601a697b, 0x685b683b},
+    {0x24400001, 0x00000008, 0x5380f003, 0xf0002b00},
+    {0x24600001, 0x00000008, 0x4b598096, 0x4a58699b},
+    {0x24400001, 0x00000008, 0x0301f043, 0x4b566193},
+    {0x24600001, 0x00000008, 0xf003699b, 0x60bb0301},
+    {0x24400001, 0x00000008, 0x4a5468bb, 0x089b6a7b},
+    {0x24600001, 0x00000008, 0xf8523302, 0x60fb3023},
+    {0x24400001, 0x00000008, 0xf0036a7b, 0x009b0303},
+    {0x24600001, 0x00000008, 0xfa02220f, 0x43dbf303},
+    {0x24400001, 0x00000008, 0x401368fa, 0x687b60fb},
+    {0x24600001, 0x00000008, 0x42934a4b, 0x687bd013},
+    {0x24400001, 0x00000008, 0x42934a4a, 0x687bd00d},
+    {0x24600001, 0x00000008, 0x42934a49, 0x687bd007},
+    {0x24400001, 0x00000008, 0x42934a48, 0x2303d101},
+    {0x24600001, 0x00000008, 0x2304e006, 0x2302e004},
+    {0x24400001, 0x00000008, 0x2301e002, 0x2300e000},
+    {0x24600001, 0x00000008, 0xf0026a7a, 0x00920203},
+    {0x24400001, 0x00000008, 0x68fa4093, 0x60fb4313},
+    {0x24600001, 0x00000008, 0x6a7b493a, 0x3302089b},
+    {0x24400001, 0x00000008, 0xf84168fa, 0x683b2023},
+    {0x24600001, 0x00000008, 0xf403685b, 0x2b003380},
+    {0x24400001, 0x00000008, 0x4b39d006, 0x4938681a},
+    {0x24600001, 0x00000008, 0x431369bb, 0xe006600b},
+    {0x24400001, 0x00000008, 0x681a4b35, 0x43db69bb},
+    {0x24600001, 0x00000008, 0x40134933, 0x683b600b},
+    {0x24400001, 0x00000008, 0xf403685b, 0x2b003300},
+    {0x24600001, 0x00000008, 0x4b2fd006, 0x492e685a},
+    {0x24400001, 0x00000008, 0x431369bb, 0xe006604b},
+    {0x24600001, 0x00000008, 0x685a4b2b, 0x43db69bb},
+    {0x24400001, 0x00000008, 0x40134929, 0x683b604b},
+    {0x24600001, 0x00000008, 0xf403685b, 0x2b001380},
+    {0x24400001, 0x00000008, 0x4b25d006, 0x4924689a},
+    {0x24600001, 0x00000008, 0x431369bb, 0xe006608b},
+    {0x24400001, 0x00000008, 0x689a4b21, 0x43db69bb},
+    {0x24600001, 0x00000008, 0x4013491f, 0x683b608b},
+    {0x24400001, 0x00000008, 0xf403685b, 0x2b001300},
+    {0x24600001, 0x00000008, 0x4b1bd006, 0x491a68da},
+    {0x24400001, 0x00000008, 0x431369bb, 0xe00660cb},
+    {0x24600001, 0x00000008, 0x68da4b17, 0x43db69bb},
+    {0x24400001, 0x00000008, 0x40134915, 0x6a7b60cb},
+    {0x24600001, 0x00000008, 0x627b3301, 0x681a683b},
+    {0x24400001, 0x00000008, 0xfa226a7b, 0x2b00f303},
+    {0x24600001, 0x00000008, 0xaed0f47f, 0x372cbf00},
+    {0x24400001, 0x00000008, 0xbc8046bd, 0xbf004770},
+    {0x24600001, 0x00000008, 0x10210000, 0x10110000},
+    {0x24400001, 0x00000008, 0x10120000, 0x10310000},
+    {0x24600001, 0x00000008, 0x10320000, 0x10220000},
+    {0x24400001, 0x00000008, 0x40021000, 0x40010000},
+    {0x24600001, 0x00000008, 0x40010800, 0x40010c00},
+    {0x24400001, 0x00000008, 0x40011000, 0x40011400},
+    {0x24600001, 0x00000008, 0x40010400, 0xb083b480},
+    {0x24400001, 0x00000008, 0x6078af00, 0x807b460b},
+    {0x24600001, 0x00000008, 0x707b4613, 0x2b00787b},
+    {0x24400001, 0x00000008, 0x887ad003, 0x611a687b},
+    {0x24600001, 0x00000008, 0x887be003, 0x687b041a},
+    {0x24400001, 0x00000008, 0xbf00611a, 0x46bd370c},
+    {0x24600001, 0x00000008, 0x4770bc80, 0xb086b580},
+    {0x24400001, 0x00000008, 0x6078af00, 0x2b00687b},
+    {0x24600001, 0x00000008, 0x2301d101, 0x687be26c},
+    {0x24400001, 0x00000008, 0xf003681b, 0x2b000301},
+    {0x24600001, 0x00000008, 0x8087f000, 0x685b4b92},
+    {0x24400001, 0x00000008, 0x030cf003, 0xd00c2b04},
+    {0x24600001, 0x00000008, 0x685b4b8f, 0x030cf003},
+    {0x24400001, 0x00000008, 0xd1122b08, 0x685b4b8c},
+    {0x24600001, 0x00000008, 0x3380f403, 0x3f80f5b3},
+    {0x24400001, 0x00000008, 0x4b89d10b, 0xf403681b},
+    {0x24600001, 0x00000008, 0x2b003300, 0x687bd06c},
+    {0x24400001, 0x00000008, 0x2b00685b, 0x2301d168},
+    {0x24600001, 0x00000008, 0x687be246, 0xf5b3685b},
+    {0x24400001, 0x00000008, 0xd1063f80, 0x681b4b80},
+    {0x24600001, 0x00000008, 0xf4434a7f, 0x60133380},
+    {0x24400001, 0x00000008, 0x687be02e, 0x2b00685b},
+    {0x24600001, 0x00000008, 0x4b7bd10c, 0x4a7a681b},
+    {0x24400001, 0x00000008, 0x3380f423, 0x4b786013},
+    {0x24600001, 0x00000008, 0x4a77681b, 0x2380f423},
+    {0x24400001, 0x00000008, 0xe01d6013, 0x685b687b},
+    {0x24600001, 0x00000008, 0x2fa0f5b3, 0x4b72d10c},
+    {0x24400001, 0x00000008, 0x4a71681b, 0x2380f443},
+    {0x24600001, 0x00000008, 0x4b6f6013, 0x4a6e681b},
+    {0x24400001, 0x00000008, 0x3380f443, 0xe00b6013},
+    {0x24600001, 0x00000008, 0x681b4b6b, 0xf4234a6a},
+    {0x24400001, 0x00000008, 0x60133380, 0x681b4b68},
+    {0x24600001, 0x00000008, 0xf4234a67, 0x60132380},
+    {0x24400001, 0x00000008, 0x685b687b, 0xd0132b00},
+    {0x24600001, 0x00000008, 0xfd0ef7ff, 0xe0086138},
+    {0x24400001, 0x00000008, 0xfd0af7ff, 0x693b4602},
+    {0x24600001, 0x00000008, 0x2b641ad3, 0x2303d901},
+    {0x24400001, 0x00000008, 0x4b5de1fa, 0xf403681b},
+    {0x24600001, 0x00000008, 0x2b003300, 0xe014d0f0},
+    {0x24400001, 0x00000008, 0xfcfaf7ff, 0xe0086138},
+    {0x24600001, 0x00000008, 0xfcf6f7ff, 0x693b4602},
+    {0x24400001, 0x00000008, 0x2b641ad3, 0x2303d901},
+    {0x24600001, 0x00000008, 0x4b53e1e6, 0xf403681b},
+    {0x24400001, 0x00000008, 0x2b003300, 0xe000d1f0},
+    {0x24600001, 0x00000008, 0x687bbf00, 0xf003681b},
+    {0x24400001, 0x00000008, 0x2b000302, 0x4b4cd063},
+    {0x24600001, 0x00000008, 0xf003685b, 0x2b00030c},
+    {0x24400001, 0x00000008, 0x4b49d00b, 0xf003685b},
+    {0x24600001, 0x00000008, 0x2b08030c, 0x4b46d11c},
+    {0x24400001, 0x00000008, 0xf403685b, 0x2b003380},
+    {0x24600001, 0x00000008, 0x4b43d116, 0xf003681b},
+    {0x24400001, 0x00000008, 0x2b000302, 0x687bd005},
+    {0x24600001, 0x00000008, 0x2b01691b, 0x2301d001},
+    {0x24400001, 0x00000008, 0x4b3de1ba, 0xf023681b},
+    {0x24600001, 0x00000008, 0x687b02f8, 0x00db695b},
+    {0x24400001, 0x00000008, 0x43134939, 0xe03a600b},
+    {0x24600001, 0x00000008, 0x691b687b, 0xd0202b00},
+    {0x24400001, 0x00000008, 0x22014b36, 0xf7ff601a},
+    {0x24600001, 0x00000008, 0x6138fcaf, 0xf7ffe008},
+    {0x24400001, 0x00000008, 0x4602fcab, 0x1ad3693b},
+    {0x24600001, 0x00000008, 0xd9012b02, 0xe19b2303},
+    {0x24400001, 0x00000008, 0x681b4b2d, 0x0302f003},
+    {0x24600001, 0x00000008, 0xd0f02b00, 0x681b4b2a},
+    {0x24400001, 0x00000008, 0x02f8f023, 0x695b687b},
+    {0x24600001, 0x00000008, 0x492700db, 0x600b4313},
+    {0x24400001, 0x00000008, 0x4b26e015, 0x601a2200},
+    {0x24600001, 0x00000008, 0xfc8ef7ff, 0xe0086138},
+    {0x24400001, 0x00000008, 0xfc8af7ff, 0x693b4602},
+    {0x24600001, 0x00000008, 0x2b021ad3, 0x2303d901},
+    {0x24400001, 0x00000008, 0x4b1de17a, 0xf003681b},
+    {0x24600001, 0x00000008, 0x2b000302, 0x687bd1f0},
+    {0x24400001, 0x00000008, 0xf003681b, 0x2b000308},
+    {0x24600001, 0x00000008, 0x687bd03a, 0x2b00699b},
+    {0x24400001, 0x00000008, 0x4b17d019, 0x601a2201},
+    {0x24600001, 0x00000008, 0xfc6ef7ff, 0xe0086138},
+    {0x24400001, 0x00000008, 0xfc6af7ff, 0x693b4602},
+    {0x24600001, 0x00000008, 0x2b021ad3, 0x2303d901},
+    {0x24400001, 0x00000008, 0x4b0de15a, 0xf0036a5b},
+    {0x24600001, 0x00000008, 0x2b000302, 0x2001d0f0},
+    {0x24400001, 0x00000008, 0xfaa8f000, 0x4b0ae01c},
+    {0x24600001, 0x00000008, 0x601a2200, 0xfc54f7ff},
+    {0x24400001, 0x00000008, 0xe00f6138, 0xfc50f7ff},
+    {0x24600001, 0x00000008, 0x693b4602, 0x2b021ad3},
+    {0x24400001, 0x00000008, 0x2303d908, 0xbf00e140},
+    {0x24600001, 0x00000008, 0x40021000, 0x42420000},
+    {0x24400001, 0x00000008, 0x42420480, 0x6a5b4b9e},
+    {0x24600001, 0x00000008, 0x0302f003, 0xd1e92b00},
+    {0x24400001, 0x00000008, 0x681b687b, 0x0304f003},
+    {0x24600001, 0x00000008, 0xf0002b00, 0x230080a6},
+    {0x24400001, 0x00000008, 0x4b9775fb, 0xf00369db},
+    {0x24600001, 0x00000008, 0x2b005380, 0x4b94d10d},
+    {0x24400001, 0x00000008, 0x4a9369db, 0x5380f043},
+    {0x24600001, 0x00000008, 0x4b9161d3, 0xf00369db},
+    {0x24400001, 0x00000008, 0x60bb5380, 0x230168bb},
+    {0x24600001, 0x00000008, 0x4b8e75fb, 0xf403681b},
+    {0x24400001, 0x00000008, 0x2b007380, 0x4b8bd118},
+    {0x24600001, 0x00000008, 0x4a8a681b, 0x7380f443},
+    {0x24400001, 0x00000008, 0xf7ff6013, 0x6138fc11},
+    {0x24600001, 0x00000008, 0xf7ffe008, 0x4602fc0d},
+    {0x24400001, 0x00000008, 0x1ad3693b, 0xd9012b64},
+    {0x24600001, 0x00000008, 0xe0fd2303, 0x681b4b81},
+    {0x24400001, 0x00000008, 0x7380f403, 0xd0f02b00},
+    {0x24600001, 0x00000008, 0x68db687b, 0xd1062b01},
+    {0x24400001, 0x00000008, 0x6a1b4b7b, 0xf0434a7a},
+    {0x24600001, 0x00000008, 0x62130301, 0x687be02d},
+    {0x24400001, 0x00000008, 0x2b0068db, 0x4b76d10c},
+    {0x24600001, 0x00000008, 0x4a756a1b, 0x0301f023},
+    {0x24400001, 0x00000008, 0x4b736213, 0x4a726a1b},
+    {0x24600001, 0x00000008, 0x0304f023, 0xe01c6213},
+    {0x24400001, 0x00000008, 0x68db687b, 0xd10c2b05},
+    {0x24600001, 0x00000008, 0x6a1b4b6d, 0xf0434a6c},
+    {0x24400001, 0x00000008, 0x62130304, 0x6a1b4b6a},
+    {0x24600001, 0x00000008, 0xf0434a69, 0x62130301},
+    {0x24400001, 0x00000008, 0x4b67e00b, 0x4a666a1b},
+    {0x24600001, 0x00000008, 0x0301f023, 0x4b646213},
+    {0x24400001, 0x00000008, 0x4a636a1b, 0x0304f023},
+    {0x24600001, 0x00000008, 0x687b6213, 0x2b0068db},
+    {0x24400001, 0x00000008, 0xf7ffd015, 0x6138fbc1},
+    {0x24600001, 0x00000008, 0xf7ffe00a, 0x4602fbbd},
+    {0x24400001, 0x00000008, 0x1ad3693b, 0x3288f241},
+    {0x24600001, 0x00000008, 0xd9014293, 0xe0ab2303},
+    {0x24400001, 0x00000008, 0x6a1b4b57, 0x0302f003},
+    {0x24600001, 0x00000008, 0xd0ee2b00, 0xf7ffe014},
+    {0x24400001, 0x00000008, 0x6138fbab, 0xf7ffe00a},
+    {0x24600001, 0x00000008, 0x4602fba7, 0x1ad3693b},
+    {0x24400001, 0x00000008, 0x3288f241, 0xd9014293},
+    {0x24600001, 0x00000008, 0xe0952303, 0x6a1b4b4c},
+    {0x24400001, 0x00000008, 0x0302f003, 0xd1ee2b00},
+    {0x24600001, 0x00000008, 0x2b017dfb, 0x4b48d105},
+    {0x24400001, 0x00000008, 0x4a4769db, 0x5380f023},
+    {0x24600001, 0x00000008, 0x687b61d3, 0x2b0069db},
+    {0x24400001, 0x00000008, 0x8081f000, 0x685b4b42},
+    {0x24600001, 0x00000008, 0x030cf003, 0xd0612b08},
+    {0x24400001, 0x00000008, 0x69db687b, 0xd1462b02},
+    {0x24600001, 0x00000008, 0x22004b3f, 0xf7ff601a},
+    {0x24400001, 0x00000008, 0x6138fb7b, 0xf7ffe008},
+    {0x24600001, 0x00000008, 0x4602fb77, 0x1ad3693b},
+    {0x24400001, 0x00000008, 0xd9012b02, 0xe0672303},
+    {0x24600001, 0x00000008, 0x681b4b35, 0x7300f003},
+    {0x24400001, 0x00000008, 0xd1f02b00, 0x6a1b687b},
+    {0x24600001, 0x00000008, 0x3f80f5b3, 0x4b30d108},
+    {0x24400001, 0x00000008, 0xf423685b, 0x687b3200},
+    {0x24600001, 0x00000008, 0x492d689b, 0x604b4313},
+    {0x24400001, 0x00000008, 0x685b4b2b, 0x1274f423},
+    {0x24600001, 0x00000008, 0x6a19687b, 0x6a5b687b},
+    {0x24400001, 0x00000008, 0x4927430b, 0x604b4313},
+    {0x24600001, 0x00000008, 0x22014b27, 0xf7ff601a},
+    {0x24400001, 0x00000008, 0x6138fb4b, 0xf7ffe008},
+    {0x24600001, 0x00000008, 0x4602fb47, 0x1ad3693b},
+    {0x24400001, 0x00000008, 0xd9012b02, 0xe0372303},
+    {0x24600001, 0x00000008, 0x681b4b1d, 0x7300f003},
+    {0x24400001, 0x00000008, 0xd0f02b00, 0x4b1ce02f},
+    {0x24600001, 0x00000008, 0x601a2200, 0xfb34f7ff},
+    {0x24400001, 0x00000008, 0xe0086138, 0xfb30f7ff},
+    {0x24600001, 0x00000008, 0x693b4602, 0x2b021ad3},
+    {0x24400001, 0x00000008, 0x2303d901, 0x4b12e020},
+    {0x24600001, 0x00000008, 0xf003681b, 0x2b007300},
+    {0x24400001, 0x00000008, 0xe018d1f0, 0x69db687b},
+    {0x24600001, 0x00000008, 0xd1012b01, 0xe0132301},
+    {0x24400001, 0x00000008, 0x685b4b0b, 0x68fb60fb},
+    {0x24600001, 0x00000008, 0x3280f403, 0x6a1b687b},
+    {0x24400001, 0x00000008, 0xd106429a, 0xf40368fb},
+    {0x24600001, 0x00000008, 0x687b1270, 0x429a6a5b},
+    {0x24400001, 0x00000008, 0x2301d001, 0x2300e000},
+    {0x24600001, 0x00000008, 0x37184618, 0xbd8046bd},
+    {0x24400001, 0x00000008, 0x40021000, 0x40007000},
+    {0x24600001, 0x00000008, 0x42420060, 0xb084b580},
+    {0x24400001, 0x00000008, 0x6078af00, 0x687b6039},
+    {0x24600001, 0x00000008, 0xd1012b00, 0xe0d02301},
+    {0x24400001, 0x00000008, 0x681b4b6a, 0x0307f003},
+    {0x24600001, 0x00000008, 0x429a683a, 0x4b67d910},
+    {0x24400001, 0x00000008, 0xf023681b, 0x49650207},
+    {0x24600001, 0x00000008, 0x4313683b, 0x4b63600b},
+    {0x24400001, 0x00000008, 0xf003681b, 0x683a0307},
+    {0x24600001, 0x00000008, 0xd001429a, 0xe0b82301},
+    {0x24400001, 0x00000008, 0x681b687b, 0x0302f003},
+    {0x24600001, 0x00000008, 0xd0202b00, 0x681b687b},
+    {0x24400001, 0x00000008, 0x0304f003, 0xd0052b00},
+    {0x24600001, 0x00000008, 0x685b4b59, 0xf4434a58},
+    {0x24400001, 0x00000008, 0x605363e0, 0x681b687b},
+    {0x24600001, 0x00000008, 0x0308f003, 0xd0052b00},
+    {0x24400001, 0x00000008, 0x685b4b53, 0xf4434a52},
+    {0x24600001, 0x00000008, 0x60535360, 0x685b4b50},
+    {0x24400001, 0x00000008, 0x02f0f023, 0x689b687b},
+    {0x24600001, 0x00000008, 0x4313494d, 0x687b604b},
+    {0x24400001, 0x00000008, 0xf003681b, 0x2b000301},
+    {0x24600001, 0x00000008, 0x687bd040, 0x2b01685b},
+    {0x24400001, 0x00000008, 0x4b47d107, 0xf403681b},
+    {0x24600001, 0x00000008, 0x2b003300, 0x2301d115},
+    {0x24400001, 0x00000008, 0x687be07f, 0x2b02685b},
+    {0x24600001, 0x00000008, 0x4b41d107, 0xf003681b},
+    {0x24400001, 0x00000008, 0x2b007300, 0x2301d109},
+    {0x24600001, 0x00000008, 0x4b3de073, 0xf003681b},
+    {0x24400001, 0x00000008, 0x2b000302, 0x2301d101},
+    {0x24600001, 0x00000008, 0x4b39e06b, 0xf023685b},
+    {0x24400001, 0x00000008, 0x687b0203, 0x4936685b},
+    {0x24600001, 0x00000008, 0x604b4313, 0xfa84f7ff},
+    {0x24400001, 0x00000008, 0xe00a60f8, 0xfa80f7ff},
+    {0x24600001, 0x00000008, 0x68fb4602, 0xf2411ad3},
+    {0x24400001, 0x00000008, 0x42933288, 0x2303d901},
+    {0x24600001, 0x00000008, 0x4b2de053, 0xf003685b},
+    {0x24400001, 0x00000008, 0x687b020c, 0x009b685b},
+    {0x24600001, 0x00000008, 0xd1eb429a, 0x681b4b27},
+    {0x24400001, 0x00000008, 0x0307f003, 0x429a683a},
+    {0x24600001, 0x00000008, 0x4b24d210, 0xf023681b},
+    {0x24400001, 0x00000008, 0x49220207, 0x4313683b},
+    {0x24600001, 0x00000008, 0x4b20600b, 0xf003681b},
+    {0x24400001, 0x00000008, 0x683a0307, 0xd001429a},
+    {0x24600001, 0x00000008, 0xe0322301, 0x681b687b},
+    {0x24400001, 0x00000008, 0x0304f003, 0xd0082b00},
+    {0x24600001, 0x00000008, 0x685b4b19, 0x62e0f423},
+    {0x24400001, 0x00000008, 0x68db687b, 0x43134916},
+    {0x24600001, 0x00000008, 0x687b604b, 0xf003681b},
+    {0x24400001, 0x00000008, 0x2b000308, 0x4b12d009},
+    {0x24600001, 0x00000008, 0xf423685b, 0x687b5260},
+    {0x24400001, 0x00000008, 0x00db691b, 0x4313490e},
+    {0x24600001, 0x00000008, 0xf000604b, 0x4601f821},
+    {0x24400001, 0x00000008, 0x685b4b0b, 0xf003091b},
+    {0x24600001, 0x00000008, 0x4a0a030f, 0xfa215cd3},
+    {0x24400001, 0x00000008, 0x4a09f303, 0x4b096013},
+    {0x24600001, 0x00000008, 0x4618681b, 0xf9e2f7ff},
+    {0x24400001, 0x00000008, 0x46182300, 0x46bd3710},
+    {0x24600001, 0x00000008, 0xbf00bd80, 0x40022000},
+    {0x24400001, 0x00000008, 0x40021000, 0x080042a4},
+    {0x24600001, 0x00000008, 0x20000000, 0x20000004},
+    {0x24400001, 0x00000008, 0xb08ab490, 0x4b2aaf00},
+    {0x24600001, 0x00000008, 0xcb0f1d3c, 0x000fe884},
+    {0x24400001, 0x00000008, 0x881b4b28, 0x2300803b},
+    {0x24600001, 0x00000008, 0x230061fb, 0x230061bb},
+    {0x24400001, 0x00000008, 0x2300627b, 0x2300617b},
+    {0x24600001, 0x00000008, 0x4b23623b, 0x61fb685b},
+    {0x24400001, 0x00000008, 0xf00369fb, 0x2b04030c},
+    {0x24600001, 0x00000008, 0x2b08d002, 0xe02dd003},
+    {0x24400001, 0x00000008, 0x623b4b1e, 0x69fbe02d},
+    {0x24600001, 0x00000008, 0xf0030c9b, 0xf107030f},
+    {0x24400001, 0x00000008, 0x44130228, 0x3c24f813},
+    {0x24600001, 0x00000008, 0x69fb617b, 0x3380f403},
+    {0x24400001, 0x00000008, 0xd0132b00, 0x685b4b14},
+    {0x24600001, 0x00000008, 0xf0030c5b, 0xf1070301},
+    {0x24400001, 0x00000008, 0x44130228, 0x3c28f813},
+    {0x24600001, 0x00000008, 0x697b61bb, 0xfb024a0f},
+    {0x24400001, 0x00000008, 0x69bbf203, 0xf3f3fbb2},
+    {0x24600001, 0x00000008, 0xe004627b, 0x4a0c697b},
+    {0x24400001, 0x00000008, 0xf303fb02, 0x6a7b627b},
+    {0x24600001, 0x00000008, 0xe002623b, 0x623b4b07},
+    {0x24400001, 0x00000008, 0x6a3bbf00, 0x37284618},
+    {0x24600001, 0x00000008, 0xbc9046bd, 0xbf004770},
+    {0x24400001, 0x00000008, 0x08004290, 0x080042a0},
+    {0x24600001, 0x00000008, 0x40021000, 0x007a1200},
+    {0x24400001, 0x00000008, 0x003d0900, 0xb085b480},
+    {0x24600001, 0x00000008, 0x6078af00, 0x681b4b0a},
+    {0x24400001, 0x00000008, 0xfba24a0a, 0x0a5b2303},
+    {0x24600001, 0x00000008, 0xfb02687a, 0x60fbf303},
+    {0x24400001, 0x00000008, 0x68fbbf00, 0x60fa1e5a},
+    {0x24600001, 0x00000008, 0xd1f92b00, 0x3714bf00},
+    {0x24400001, 0x00000008, 0xbc8046bd, 0xbf004770},
+    {0x24600001, 0x00000008, 0x20000000, 0x10624dd3},
+    {0x24400001, 0x00000008, 0xb082b580, 0x6078af00},
+    {0x24600001, 0x00000008, 0x2b00687b, 0x2301d101},
+    {0x24400001, 0x00000008, 0x687be01d, 0x303df893},
+    {0x24600001, 0x00000008, 0x2b00b2db, 0x687bd106},
+    {0x24400001, 0x00000008, 0xf8832200, 0x6878203c},
+    {0x24600001, 0x00000008, 0xf884f7ff, 0x2202687b},
+    {0x24400001, 0x00000008, 0x203df883, 0x681a687b},
+    {0x24600001, 0x00000008, 0x3304687b, 0x46104619},
+    {0x24400001, 0x00000008, 0xf8e4f000, 0x2201687b},
+    {0x24600001, 0x00000008, 0x203df883, 0x46182300},
+    {0x24400001, 0x00000008, 0x46bd3708, 0xb480bd80},
+    {0x24600001, 0x00000008, 0xaf00b085, 0x687b6078},
+    {0x24400001, 0x00000008, 0xf8832202, 0x687b203d},
+    {0x24600001, 0x00000008, 0x689b681b, 0x0307f003},
+    {0x24400001, 0x00000008, 0x68fb60fb, 0xd0072b06},
+    {0x24600001, 0x00000008, 0x681b687b, 0x687b681a},
+    {0x24400001, 0x00000008, 0xf042681b, 0x601a0201},
+    {0x24600001, 0x00000008, 0x2201687b, 0x203df883},
+    {0x24400001, 0x00000008, 0x46182300, 0x46bd3714},
+    {0x24600001, 0x00000008, 0x4770bc80, 0xb084b580},
+    {0x24400001, 0x00000008, 0x6078af00, 0x687b6039},
+    {0x24600001, 0x00000008, 0x303cf893, 0xd1012b01},
+    {0x24400001, 0x00000008, 0xe0a62302, 0x2201687b},
+    {0x24600001, 0x00000008, 0x203cf883, 0x2202687b},
+    {0x24400001, 0x00000008, 0x203df883, 0x681b687b},
+    {0x24600001, 0x00000008, 0x60fb689b, 0xf02368fb},
+    {0x24400001, 0x00000008, 0x60fb0377, 0xf42368fb},
+    {0x24600001, 0x00000008, 0x60fb437f, 0x681b687b},
+    {0x24400001, 0x00000008, 0x609a68fa, 0x681b683b},
+    {0x24600001, 0x00000008, 0xd0672b40, 0xd80b2b40},
+    {0x24400001, 0x00000008, 0xd0732b10, 0xd8022b10},
+    {0x24600001, 0x00000008, 0xd06f2b00, 0x2b20e078},
+    {0x24400001, 0x00000008, 0x2b30d06c, 0xe073d06a},
+    {0x24600001, 0x00000008, 0xd00d2b70, 0xd8042b70},
+    {0x24400001, 0x00000008, 0xd0332b50, 0xd0412b60},
+    {0x24600001, 0x00000008, 0xf5b3e06a, 0xd0665f80},
+    {0x24400001, 0x00000008, 0x5f00f5b3, 0xe063d017},
+    {0x24600001, 0x00000008, 0x6818687b, 0x6899683b},
+    {0x24400001, 0x00000008, 0x685a683b, 0x68db683b},
+    {0x24600001, 0x00000008, 0xf941f000, 0x681b687b},
+    {0x24400001, 0x00000008, 0x60fb689b, 0xf04368fb},
+    {0x24600001, 0x00000008, 0x60fb0377, 0x681b687b},
+    {0x24400001, 0x00000008, 0x609a68fa, 0x687be04c},
+    {0x24600001, 0x00000008, 0x683b6818, 0x683b6899},
+    {0x24400001, 0x00000008, 0x683b685a, 0xf00068db},
+    {0x24600001, 0x00000008, 0x687bf92a, 0x689a681b},
+    {0x24400001, 0x00000008, 0x681b687b, 0x4280f442},
+    {0x24600001, 0x00000008, 0xe039609a, 0x6818687b},
+    {0x24400001, 0x00000008, 0x6859683b, 0x68db683b},
+    {0x24600001, 0x00000008, 0xf000461a, 0x687bf8a1},
+    {0x24400001, 0x00000008, 0x2150681b, 0xf0004618},
+    {0x24600001, 0x00000008, 0xe029f8f8, 0x6818687b},
+    {0x24400001, 0x00000008, 0x6859683b, 0x68db683b},
+    {0x24600001, 0x00000008, 0xf000461a, 0x687bf8bf},
+    {0x24400001, 0x00000008, 0x2160681b, 0xf0004618},
+    {0x24600001, 0x00000008, 0xe019f8e8, 0x6818687b},
+    {0x24400001, 0x00000008, 0x6859683b, 0x68db683b},
+    {0x24600001, 0x00000008, 0xf000461a, 0x687bf881},
+    {0x24400001, 0x00000008, 0x2140681b, 0xf0004618},
+    {0x24600001, 0x00000008, 0xe009f8d8, 0x681a687b},
+    {0x24400001, 0x00000008, 0x681b683b, 0x46104619},
+    {0x24600001, 0x00000008, 0xf8cff000, 0xbf00e000},
+    {0x24400001, 0x00000008, 0x2201687b, 0x203df883},
+    {0x24600001, 0x00000008, 0x2200687b, 0x203cf883},
+    {0x24400001, 0x00000008, 0x46182300, 0x46bd3710},
+    {0x24600001, 0x00000008, 0x0000bd80, 0xb085b480},
+    {0x24400001, 0x00000008, 0x6078af00, 0x687b6039},
+    {0x24600001, 0x00000008, 0x60fb681b, 0x4a29687b},
+    {0x24400001, 0x00000008, 0xd00b4293, 0xf1b3687b},
+    {0x24600001, 0x00000008, 0xd0074f80, 0x4a26687b},
+    {0x24400001, 0x00000008, 0xd0034293, 0x4a25687b},
+    {0x24600001, 0x00000008, 0xd1084293, 0xf02368fb},
+    {0x24400001, 0x00000008, 0x60fb0370, 0x685b683b},
+    {0x24600001, 0x00000008, 0x431368fa, 0x687b60fb},
+    {0x24400001, 0x00000008, 0x42934a1c, 0x687bd00b},
+    {0x24600001, 0x00000008, 0x4f80f1b3, 0x687bd007},
+    {0x24400001, 0x00000008, 0x42934a19, 0x687bd003},
+    {0x24600001, 0x00000008, 0x42934a18, 0x68fbd108},
+    {0x24400001, 0x00000008, 0x7340f423, 0x683b60fb},
+    {0x24600001, 0x00000008, 0x68fa68db, 0x60fb4313},
+    {0x24400001, 0x00000008, 0xf02368fb, 0x683b0280},
+    {0x24600001, 0x00000008, 0x4313695b, 0x687b60fb},
+    {0x24400001, 0x00000008, 0x601a68fa, 0x689a683b},
+    {0x24600001, 0x00000008, 0x62da687b, 0x681a683b},
+    {0x24400001, 0x00000008, 0x629a687b, 0x4a07687b},
+    {0x24600001, 0x00000008, 0xd1034293, 0x691a683b},
+    {0x24400001, 0x00000008, 0x631a687b, 0x2201687b},
+    {0x24600001, 0x00000008, 0xbf00615a, 0x46bd3714},
+    {0x24400001, 0x00000008, 0x4770bc80, 0x40012c00},
+    {0x24600001, 0x00000008, 0x40000400, 0x40000800},
+    {0x24400001, 0x00000008, 0xb087b480, 0x60f8af00},
+    {0x24600001, 0x00000008, 0x607a60b9, 0x6a1b68fb},
+    {0x24400001, 0x00000008, 0x68fb617b, 0xf0236a1b},
+    {0x24600001, 0x00000008, 0x68fb0201, 0x68fb621a},
+    {0x24400001, 0x00000008, 0x613b699b, 0xf023693b},
+    {0x24600001, 0x00000008, 0x613b03f0, 0x011b687b},
+    {0x24400001, 0x00000008, 0x4313693a, 0x697b613b},
+    {0x24600001, 0x00000008, 0x030af023, 0x697a617b},
+    {0x24400001, 0x00000008, 0x431368bb, 0x68fb617b},
+    {0x24600001, 0x00000008, 0x619a693a, 0x697a68fb},
+    {0x24400001, 0x00000008, 0xbf00621a, 0x46bd371c},
+    {0x24600001, 0x00000008, 0x4770bc80, 0xb087b480},
+    {0x24400001, 0x00000008, 0x60f8af00, 0x607a60b9},
+    {0x24600001, 0x00000008, 0x6a1b68fb, 0x0210f023},
+    {0x24400001, 0x00000008, 0x621a68fb, 0x699b68fb},
+    {0x24600001, 0x00000008, 0x68fb617b, 0x613b6a1b},
+    {0x24400001, 0x00000008, 0xf423697b, 0x617b4370},
+    {0x24600001, 0x00000008, 0x031b687b, 0x4313697a},
+    {0x24400001, 0x00000008, 0x693b617b, 0x03a0f023},
+    {0x24600001, 0x00000008, 0x68bb613b, 0x693a011b},
+    {0x24400001, 0x00000008, 0x613b4313, 0x697a68fb},
+    {0x24600001, 0x00000008, 0x68fb619a, 0x621a693a},
+    {0x24400001, 0x00000008, 0x371cbf00, 0xbc8046bd},
+    {0x24600001, 0x00000008, 0xb4804770, 0xaf00b085},
+    {0x24400001, 0x00000008, 0x60396078, 0x689b687b},
+    {0x24600001, 0x00000008, 0x68fb60fb, 0x0370f023},
+    {0x24400001, 0x00000008, 0x683a60fb, 0x431368fb},
+    {0x24600001, 0x00000008, 0x0307f043, 0x687b60fb},
+    {0x24400001, 0x00000008, 0x609a68fa, 0x3714bf00},
+    {0x24600001, 0x00000008, 0xbc8046bd, 0xb4804770},
+    {0x24400001, 0x00000008, 0xaf00b087, 0x60b960f8},
+    {0x24600001, 0x00000008, 0x603b607a, 0x689b68fb},
+    {0x24400001, 0x00000008, 0x697b617b, 0x437ff423},
+    {0x24600001, 0x00000008, 0x683b617b, 0x687b021a},
+    {0x24400001, 0x00000008, 0x68bb431a, 0x697a4313},
+    {0x24600001, 0x00000008, 0x617b4313, 0x697a68fb},
+    {0x24400001, 0x00000008, 0xbf00609a, 0x46bd371c},
+    {0x24600001, 0x00000008, 0x4770bc80, 0xb085b480},
+    {0x24400001, 0x00000008, 0x6078af00, 0x687b6039},
+    {0x24600001, 0x00000008, 0x303cf893, 0xd1012b01},
+    {0x24400001, 0x00000008, 0xe0322302, 0x2201687b},
+    {0x24600001, 0x00000008, 0x203cf883, 0x2202687b},
+    {0x24400001, 0x00000008, 0x203df883, 0x681b687b},
+    {0x24600001, 0x00000008, 0x60fb685b, 0x681b687b},
+    {0x24400001, 0x00000008, 0x60bb689b, 0xf02368fb},
+    {0x24600001, 0x00000008, 0x60fb0370, 0x681b683b},
+    {0x24400001, 0x00000008, 0x431368fa, 0x68bb60fb},
+    {0x24600001, 0x00000008, 0x0380f023, 0x683b60bb},
+    {0x24400001, 0x00000008, 0x68ba685b, 0x60bb4313},
+    {0x24600001, 0x00000008, 0x681b687b, 0x605a68fa},
+    {0x24400001, 0x00000008, 0x681b687b, 0x609a68ba},
+    {0x24600001, 0x00000008, 0x2201687b, 0x203df883},
+    {0x24400001, 0x00000008, 0x2200687b, 0x203cf883},
+    {0x24600001, 0x00000008, 0x46182300, 0x46bd3714},
+    {0x24400001, 0x00000008, 0x4770bc80, 0x2500b570},
+    {0x24600001, 0x00000008, 0x4c0d4e0c, 0x10a41ba4},
+    {0x24400001, 0x00000008, 0xd10942a5, 0xf822f000},
+    {0x24600001, 0x00000008, 0x4e0a2500, 0x1ba44c0a},
+    {0x24400001, 0x00000008, 0x42a510a4, 0xbd70d105},
+    {0x24600001, 0x00000008, 0x3025f856, 0x35014798},
+    {0x24400001, 0x00000008, 0xf856e7ee, 0x47983025},
+    {0x24600001, 0x00000008, 0xe7f23501, 0x080042b4},
+    {0x24400001, 0x00000008, 0x080042b4, 0x080042b4},
+    {0x24600001, 0x00000008, 0x080042b8, 0x44024603},
+    {0x24400001, 0x00000008, 0xd1004293, 0xf8034770},
+    {0x24600001, 0x00000008, 0xe7f91b01, 0xbf00b5f8},
+    {0x24400001, 0x00000008, 0xbc08bcf8, 0x4770469e},
+    {0x24600001, 0x00000008, 0xbf00b5f8, 0xbc08bcf8},
+    {0x24400001, 0x00000008, 0x4770469e, 0x2057454e},
+    {0x24600001, 0x00000008, 0x20505041, 0x45524548},
+    {0x24400001, 0x00000008, 0x00000000, 0x41445055},
+    {0x24600001, 0x00000008, 0x2e444554, 0x00002e2e},
+    {0x24400001, 0x00000008, 0x05040302, 0x09080706},
+    {0x24600001, 0x00000008, 0x0d0c0b0a, 0x10100f0e},
+    {0x24400001, 0x00000008, 0x00000201, 0x00000000},
+    {0x24600001, 0x00000008, 0x00000000, 0x04030201},
+    {0x24400001, 0x00000008, 0x09080706, 0x08002931},
+    {0x24600001, 0x00000008, 0x0800290d, 0x00f42400},
+    {0x24400001, 0x00000008, 0x00000010, 0x00000001},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24400001, 0x00000008, 0xffffffff, 0xffffffff},
+    {0x24600001, 0x00000008, 0xffffffff, 0xffffffff}
+};
+const uint32_t dataToWriteSize = 7208U;
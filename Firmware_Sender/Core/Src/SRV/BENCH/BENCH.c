@@ -0,0 +1,152 @@
+/*================================================================
+ * 	File Name: BENCH.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "BENCH.h"
+#include "BENCH_Cfg.h"
+#include "../RTO/RTO.h"
+#include "../../HAL/LCD/LCD.h"
+
+static uint32_t StartTick = 0;
+static uint32_t ElapsedMs = 0;
+static uint32_t StartRetransmissions = 0;
+static uint32_t Retransmissions = 0;
+static uint32_t FramesPerSecond = 0;
+static uint32_t BytesPerSecond = 0;
+static uint32_t ReceiverResult[BENCH_RESULT_PAGES + 1];
+
+/* Decimal representation of Value behind Prefix, Line must hold 17 characters */
+static void SRV_BENCH_FormatLine(char *Line, const char *Prefix, uint32_t Value, const char *Suffix)
+{
+	char Digits[10];
+	uint8_t Count = 0;
+	uint8_t Length = 0;
+
+	while (*Prefix != '\0' && Length < 16)
+	{
+		Line[Length++] = *Prefix++;
+	}
+	do
+	{
+		Digits[Count++] = (char)('0' + (Value % 10U));
+		Value /= 10U;
+	} while (Value != 0U && Count < sizeof(Digits));
+	while (Count > 0 && Length < 16)
+	{
+		Line[Length++] = Digits[--Count];
+	}
+	while (*Suffix != '\0' && Length < 16)
+	{
+		Line[Length++] = *Suffix++;
+	}
+	/* Pad to clear what the previous page left on the line */
+	while (Length < 16)
+	{
+		Line[Length++] = ' ';
+	}
+	Line[Length] = '\0';
+}
+
+uint8_t SRV_BENCH_GetPayloadByte(uint32_t Offset)
+{
+	/* Changes every byte and only depends on the offset, a retransmitted frame is identical */
+	return (uint8_t)((Offset * 7U) ^ (Offset >> 8));
+}
+
+void SRV_BENCH_Begin(void)
+{
+	StartTick = HAL_GetTick();
+	StartRetransmissions = SRV_RTO_GetRetransmissions();
+}
+
+void SRV_BENCH_End(uint32_t Frames)
+{
+	ElapsedMs = HAL_GetTick() - StartTick;
+	Retransmissions = SRV_RTO_GetRetransmissions() - StartRetransmissions;
+	if (ElapsedMs == 0U)
+	{
+		ElapsedMs = 1U;
+	}
+	FramesPerSecond = (Frames * 1000U) / ElapsedMs;
+	BytesPerSecond = (Frames * CHUNK_SIZE * 1000U) / ElapsedMs;
+}
+
+void SRV_BENCH_SetReceiverResult(uint8_t Index, uint32_t Value)
+{
+	if (Index <= BENCH_RESULT_PAGES)
+	{
+		ReceiverResult[Index] = Value;
+	}
+}
+
+void SRV_BENCH_SendSummary(CAN_HandleTypeDef *Can)
+{
+	CAN_TxHeaderTypeDef Header = {0};
+	uint8_t Data[8];
+	uint32_t Mailbox;
+	uint32_t IsrCycles = ReceiverResult[BENCH_RESULT_ISR_CYCLES];
+	uint32_t FlashCycles = ReceiverResult[BENCH_RESULT_FLASH_CYCLES];
+
+	Header.IDE = CAN_ID_STD;
+	Header.RTR = CAN_RTR_DATA;
+	Header.DLC = 8;
+
+	Header.StdId = BENCH_SUMMARY_FRAME_ID;
+	Data[0] = (uint8_t)(FramesPerSecond);
+	Data[1] = (uint8_t)(FramesPerSecond >> 8);
+	Data[2] = (uint8_t)(BytesPerSecond);
+	Data[3] = (uint8_t)(BytesPerSecond >> 8);
+	Data[4] = (uint8_t)(BytesPerSecond >> 16);
+	Data[5] = (uint8_t)(BytesPerSecond >> 24);
+	Data[6] = (uint8_t)(Retransmissions);
+	Data[7] = (uint8_t)(Retransmissions >> 8);
+	while (HAL_CAN_GetTxMailboxesFreeLevel(Can) == 0);
+	if (HAL_CAN_AddTxMessage(Can, &Header, Data, &Mailbox) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	Header.StdId = BENCH_SUMMARY_FRAME_ID + 1;
+	Data[0] = (uint8_t)(IsrCycles);
+	Data[1] = (uint8_t)(IsrCycles >> 8);
+	Data[2] = (uint8_t)(IsrCycles >> 16);
+	Data[3] = (uint8_t)(IsrCycles >> 24);
+	Data[4] = (uint8_t)(FlashCycles);
+	Data[5] = (uint8_t)(FlashCycles >> 8);
+	Data[6] = (uint8_t)(FlashCycles >> 16);
+	Data[7] = (uint8_t)(FlashCycles >> 24);
+	while (HAL_CAN_GetTxMailboxesFreeLevel(Can) == 0);
+	if (HAL_CAN_AddTxMessage(Can, &Header, Data, &Mailbox) != HAL_OK)
+	{
+		Error_Handler();
+	}
+}
+
+void SRV_BENCH_ShowPage(uint8_t Page)
+{
+	char Line[17];
+
+	if (Page == 0)
+	{
+		SRV_BENCH_FormatLine(Line, "F/s:", FramesPerSecond, "");
+		HAL_LCD_moveCursor(0, 0);
+		HAL_LCD_sendString(Line);
+		SRV_BENCH_FormatLine(Line, "B/s:", BytesPerSecond, "");
+		HAL_LCD_moveCursor(1, 0);
+		HAL_LCD_sendString(Line);
+		/* Retransmissions share the first line */
+		SRV_BENCH_FormatLine(Line, "R:", Retransmissions, "");
+		HAL_LCD_moveCursor(0, 10);
+		Line[6] = '\0';
+		HAL_LCD_sendString(Line);
+	}
+	else
+	{
+		SRV_BENCH_FormatLine(Line, "ISR:", ReceiverResult[BENCH_RESULT_ISR_CYCLES], " cyc");
+		HAL_LCD_moveCursor(0, 0);
+		HAL_LCD_sendString(Line);
+		SRV_BENCH_FormatLine(Line, "PAGE:", ReceiverResult[BENCH_RESULT_FLASH_CYCLES], " cyc");
+		HAL_LCD_moveCursor(1, 0);
+		HAL_LCD_sendString(Line);
+	}
+}
@@ -0,0 +1,81 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: BENCH.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Throughput benchmark of the sender/receiver pair.
+ *
+ * With BENCH_ENABLE set the sender opens a session with CMD_BENCH_START,
+ * streams a synthetic payload through the normal data path (sequence
+ * bits, adaptive timeout, held back page ACKs) and times it with the
+ * SysTick. The receiver measures its own cost per frame and per flash
+ * page with the DWT cycle counter, which is read back with
+ * CMD_BENCH_RESULT. Results go to the LCD and to two summary frames.
+ */
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include "main.h"
+
+/* CMD_BENCH_RESULT indexes of the receiver, see Firmware_Receiver SRV/BENCH */
+#define BENCH_RESULT_FRAMES             0U
+#define BENCH_RESULT_ISR_CYCLES         1U
+#define BENCH_RESULT_FLASH_CYCLES       2U
+#define BENCH_RESULT_PAGES              3U
+
+/**
+ * @brief Get one byte of the synthetic payload.
+ *
+ * @param Offset Offset of the byte in the payload.
+ * @return uint8_t Payload byte, never a long run of the erased flash value.
+ */
+uint8_t SRV_BENCH_GetPayloadByte(uint32_t Offset);
+
+/**
+ * @brief Start timing a session.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_BENCH_Begin(void);
+
+/**
+ * @brief Stop timing a session.
+ *
+ * @param Frames Number of data frames acknowledged during the session.
+ * @return None
+ */
+void SRV_BENCH_End(uint32_t Frames);
+
+/**
+ * @brief Store a measurement read back from the receiver.
+ *
+ * @param Index One of the BENCH_RESULT_* indexes.
+ * @param Value Measurement value.
+ * @return None
+ */
+void SRV_BENCH_SetReceiverResult(uint8_t Index, uint32_t Value);
+
+/**
+ * @brief Send the two summary frames of the session.
+ *
+ * @param Can Handle of the CAN peripheral, already started.
+ * @return None
+ */
+void SRV_BENCH_SendSummary(CAN_HandleTypeDef *Can);
+
+/**
+ * @brief Show one page of results on the LCD.
+ *
+ * Page 0 shows frames/s, retransmissions and bytes/s, page 1 the receiver
+ * cycles per frame and per flash page. The LCD driver busy waits on TIM1,
+ * so this must not run while a frame is outstanding.
+ *
+ * @param Page 0 or 1.
+ * @return None
+ */
+void SRV_BENCH_ShowPage(uint8_t Page);
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,31 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: BENCH_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef BENCH_CFG_H_
+#define BENCH_CFG_H_
+
+/*
+ * 1: stream a synthetic payload instead of the application image and
+ * report the throughput. The receiver keeps the payload in the new
+ * firmware slot but never boots it.
+ */
+#define BENCH_ENABLE                0
+
+/* Size of the synthetic payload in bytes, at most the 30KB of the new firmware slot. */
+#define BENCH_PAYLOAD_SIZE          (16UL * 1024UL)
+
+/*
+ * Identifier of the two summary frames sent when the session is over:
+ *   BENCH_SUMMARY_FRAME_ID     : frames/s (uint16_t), bytes/s (uint32_t), retransmissions (uint16_t)
+ *   BENCH_SUMMARY_FRAME_ID + 1 : receiver cycles per frame (uint32_t), cycles per page (uint32_t)
+ * All fields are little endian.
+ */
+#define BENCH_SUMMARY_FRAME_ID      0x7E0
+
+/* Time each of the two LCD pages stays on the display. */
+#define BENCH_DISPLAY_MS            3000U
+
+#endif /* BENCH_CFG_H_ */
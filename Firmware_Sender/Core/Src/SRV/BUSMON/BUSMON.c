@@ -0,0 +1,80 @@
+/*================================================================
+ * 	File Name: BUSMON.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "BUSMON.h"
+#include "BUSMON_Cfg.h"
+
+static CAN_HandleTypeDef *MonitoredCan;
+static uint32_t BusOffCount = 0;
+static uint32_t PassiveCount = 0;
+static uint8_t WasBusOff = 0;
+static uint8_t WasPassive = 0;
+
+void SRV_BUSMON_Init(CAN_HandleTypeDef *Can)
+{
+	MonitoredCan = Can;
+	BusOffCount = 0;
+	PassiveCount = 0;
+	WasBusOff = 0;
+	WasPassive = 0;
+
+	if (HAL_CAN_ActivateNotification(Can, CAN_IT_ERROR_WARNING | CAN_IT_ERROR_PASSIVE |
+	                                      CAN_IT_BUSOFF | CAN_IT_LAST_ERROR_CODE | CAN_IT_ERROR) != HAL_OK)
+	{
+		Error_Handler();
+	}
+}
+
+void SRV_BUSMON_ErrorIndication(void)
+{
+	uint32_t Esr = MonitoredCan->Instance->ESR;
+	uint8_t IsBusOff = ((Esr & CAN_ESR_BOFF) != 0U);
+	uint8_t IsPassive = ((Esr & CAN_ESR_EPVF) != 0U);
+
+	/* Count transitions, not every error frame seen while in the state */
+	if (IsBusOff && !WasBusOff)
+	{
+		BusOffCount++;
+	}
+	if (IsPassive && !WasPassive)
+	{
+		PassiveCount++;
+	}
+	WasBusOff = IsBusOff;
+	WasPassive = IsPassive;
+
+	/* The state is read back from ESR, the HAL error code is only a latch */
+	HAL_CAN_ResetError(MonitoredCan);
+}
+
+uint16_t SRV_BUSMON_GetThrottle(void)
+{
+	uint32_t Esr = MonitoredCan->Instance->ESR;
+	uint32_t Tec = (Esr & CAN_ESR_TEC) >> CAN_ESR_TEC_Pos;
+
+	if ((Esr & CAN_ESR_EPVF) != 0U)
+	{
+		return BUSMON_PASSIVE_TICKS;
+	}
+	if (Tec > BUSMON_THROTTLE_TEC)
+	{
+		return (uint16_t)((Tec - BUSMON_THROTTLE_TEC) * BUSMON_TICKS_PER_TEC);
+	}
+	return 0;
+}
+
+uint8_t SRV_BUSMON_IsBusOff(void)
+{
+	return ((MonitoredCan->Instance->ESR & CAN_ESR_BOFF) != 0U);
+}
+
+uint32_t SRV_BUSMON_GetBusOffCount(void)
+{
+	return BusOffCount;
+}
+
+uint32_t SRV_BUSMON_GetPassiveCount(void)
+{
+	return PassiveCount;
+}
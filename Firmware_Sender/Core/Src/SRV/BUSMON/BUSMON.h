@@ -0,0 +1,71 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: BUSMON.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * CAN bus error monitor.
+ *
+ * Bus-off recovery itself is left to the controller (ABOM): after 128
+ * occurrences of 11 recessive bits, about 14ms at 100kbit/s, it joins
+ * the bus again without any software action. This module counts the
+ * error events reported through HAL_CAN_ErrorCallback and derives from
+ * the live transmit error counter (CAN_ESR.TEC) a gap to insert between
+ * data frames, so a disturbed bus is not pushed into error passive and
+ * bus-off by our own traffic.
+ */
+#ifndef BUSMON_H_
+#define BUSMON_H_
+
+#include "main.h"
+
+/**
+ * @brief Initialize the monitor and enable the CAN error interrupts.
+ *
+ * @param Can Handle of the monitored CAN peripheral, already started.
+ * @return None
+ */
+void SRV_BUSMON_Init(CAN_HandleTypeDef *Can);
+
+/**
+ * @brief Record an error event, to be called from HAL_CAN_ErrorCallback.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_BUSMON_ErrorIndication(void);
+
+/**
+ * @brief Get the gap to keep between two data frames for the current error level.
+ *
+ * @param None
+ * @return uint16_t Gap in TIM1 ticks, 0 on a healthy bus.
+ */
+uint16_t SRV_BUSMON_GetThrottle(void);
+
+/**
+ * @brief Check whether the controller is bus-off and waiting for its automatic recovery.
+ *
+ * @param None
+ * @return uint8_t 1 while bus-off, 0 otherwise.
+ */
+uint8_t SRV_BUSMON_IsBusOff(void);
+
+/**
+ * @brief Get the number of bus-off events since SRV_BUSMON_Init.
+ *
+ * @param None
+ * @return uint32_t Bus-off count.
+ */
+uint32_t SRV_BUSMON_GetBusOffCount(void);
+
+/**
+ * @brief Get the number of transitions to error passive since SRV_BUSMON_Init.
+ *
+ * @param None
+ * @return uint32_t Error passive count.
+ */
+uint32_t SRV_BUSMON_GetPassiveCount(void);
+
+#endif /* BUSMON_H_ */
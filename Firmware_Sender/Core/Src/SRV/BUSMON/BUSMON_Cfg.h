@@ -0,0 +1,22 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: BUSMON_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef BUSMON_CFG_H_
+#define BUSMON_CFG_H_
+
+/*
+ * Transmit error counter level from which the send rate is lowered.
+ * The controller turns error warning at 96 and error passive at 128.
+ */
+#define BUSMON_THROTTLE_TEC         64U
+
+/* Extra TIM1 ticks (10us) between two data frames per TEC count above BUSMON_THROTTLE_TEC. */
+#define BUSMON_TICKS_PER_TEC        10U
+
+/* Gap applied while the controller is error passive (5ms). */
+#define BUSMON_PASSIVE_TICKS        500U
+
+#endif /* BUSMON_CFG_H_ */
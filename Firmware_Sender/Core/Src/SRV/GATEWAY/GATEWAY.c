@@ -0,0 +1,162 @@
+/*================================================================
+ * 	File Name: GATEWAY.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "GATEWAY.h"
+#include "GATEWAY_Cfg.h"
+
+#define GATEWAY_RING_MASK       (GATEWAY_RING_SIZE - 1UL)
+/* Bytes the host may have in flight, less than the ring so the DMA position is never ambiguous */
+#define GATEWAY_WINDOW          (GATEWAY_RING_SIZE - GATEWAY_CREDIT_BLOCK)
+
+/* Offset of the stream size in the image header, see SRV/IMAGE of Firmware_Receiver */
+#define GATEWAY_STREAM_SIZE_OFFSET  24U
+
+static uint8_t Ring[GATEWAY_RING_SIZE];
+static uint32_t DmaPosition;        /* Ring index the DMA writes next, as last read */
+static uint32_t Received;           /* Bytes received since SRV_GATEWAY_Init */
+static uint32_t Consumed;           /* Received count up to which bytes were looked at or dropped */
+static uint32_t SessionStart;       /* Received count at the first byte of the session */
+static uint32_t Released;           /* Session bytes that are not needed any more */
+static uint32_t Credited;           /* Session bytes the host may send */
+static uint32_t ReceivedAt;         /* Tick of the last byte received */
+
+/* Account for the bytes the DMA wrote since the last call */
+static void SRV_GATEWAY_Poll(void)
+{
+	uint32_t Position = (GATEWAY_RING_SIZE - DMA1_Channel5->CNDTR) & GATEWAY_RING_MASK;
+
+	if (Position != DmaPosition)
+	{
+		Received += (Position - DmaPosition) & GATEWAY_RING_MASK;
+		DmaPosition = Position;
+		ReceivedAt = HAL_GetTick();
+	}
+}
+
+static void SRV_GATEWAY_Put(uint8_t Byte)
+{
+	while ((USART1->SR & USART_SR_TXE) == 0U);
+	USART1->DR = Byte;
+}
+
+/* Give the host credit for the space of the session bytes before Offset */
+static void SRV_GATEWAY_Release(uint32_t Offset)
+{
+	if (Offset > Released)
+	{
+		Released = Offset;
+	}
+	while (Credited + GATEWAY_CREDIT_BLOCK <= Released + GATEWAY_WINDOW)
+	{
+		Credited += GATEWAY_CREDIT_BLOCK;
+		SRV_GATEWAY_Put(GATEWAY_CREDIT);
+	}
+}
+
+/* Wait for the session byte at Offset */
+static uint8_t SRV_GATEWAY_Peek(uint32_t Offset)
+{
+	SRV_GATEWAY_Poll();
+	while ((Received - SessionStart) <= Offset)
+	{
+		if ((HAL_GetTick() - ReceivedAt) > GATEWAY_TIMEOUT_MS)
+		{
+			/* The receiver keeps the pages it holds, a plain image resumes after the reset */
+			SRV_GATEWAY_Put(GATEWAY_FAILED);
+			while ((USART1->SR & USART_SR_TC) == 0U);
+			NVIC_SystemReset();
+		}
+		SRV_GATEWAY_Poll();
+	}
+	return Ring[(SessionStart + Offset) & GATEWAY_RING_MASK];
+}
+
+void SRV_GATEWAY_Init(void)
+{
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+	RCC->APB2ENR |= RCC_APB2ENR_USART1EN | RCC_APB2ENR_IOPAEN;
+	RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+
+	GPIO_InitStruct.Pin = GPIO_PIN_9;
+	GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+	HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+	GPIO_InitStruct.Pin = GPIO_PIN_10;
+	GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+	GPIO_InitStruct.Pull = GPIO_PULLUP;
+	HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+	/* Peripheral to memory, bytes, circular over the whole ring */
+	DMA1_Channel5->CCR = 0;
+	DMA1_Channel5->CPAR = (uint32_t)&USART1->DR;
+	DMA1_Channel5->CMAR = (uint32_t)Ring;
+	DMA1_Channel5->CNDTR = GATEWAY_RING_SIZE;
+	DMA1_Channel5->CCR = DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_PL_1 | DMA_CCR_EN;
+
+	/* USARTDIV in 1/16: BRR = PCLK2 / baud rate */
+	USART1->BRR = (HAL_RCC_GetPCLK2Freq() + (GATEWAY_BAUDRATE / 2U)) / GATEWAY_BAUDRATE;
+	USART1->CR3 = USART_CR3_DMAR;
+	USART1->CR1 = USART_CR1_UE | USART_CR1_TE | USART_CR1_RE;
+
+	DmaPosition = 0;
+	Received = 0;
+	Consumed = 0;
+	ReceivedAt = HAL_GetTick();
+}
+
+void SRV_GATEWAY_Open(void)
+{
+	static const uint8_t Magic[GATEWAY_START_MAGIC_SIZE] = GATEWAY_START_MAGIC;
+	uint8_t Matched = 0;
+	uint8_t Byte;
+
+	while (Matched < GATEWAY_START_MAGIC_SIZE)
+	{
+		SRV_GATEWAY_Poll();
+		/* The host sends nothing else before it has credit, the ring cannot overflow */
+		while ((Consumed != Received) && (Matched < GATEWAY_START_MAGIC_SIZE))
+		{
+			Byte = Ring[Consumed & GATEWAY_RING_MASK];
+			Consumed++;
+			Matched = (Byte == Magic[Matched]) ? (Matched + 1U) : ((Byte == Magic[0]) ? 1U : 0U);
+		}
+	}
+
+	SessionStart = Consumed;
+	Released = 0;
+	Credited = 0;
+	ReceivedAt = HAL_GetTick();
+	SRV_GATEWAY_Release(0);
+}
+
+uint32_t SRV_GATEWAY_GetSessionSize(void)
+{
+	uint32_t StreamSize = 0;
+
+	for (uint8_t i = 0; i < 4U; i++)
+	{
+		StreamSize |= (uint32_t)SRV_GATEWAY_Peek(GATEWAY_STREAM_SIZE_OFFSET + i) << (8U * i);
+	}
+	return IMAGE_HEADER_SIZE + StreamSize;
+}
+
+uint8_t SRV_GATEWAY_Byte(uint32_t Offset)
+{
+	/* Frame Offset / CHUNK_SIZE is sent once the frames before it were acknowledged */
+	SRV_GATEWAY_Release(Offset - (Offset % CHUNK_SIZE));
+	return SRV_GATEWAY_Peek(Offset);
+}
+
+void SRV_GATEWAY_Close(uint8_t Completed)
+{
+	SRV_GATEWAY_Put(Completed ? GATEWAY_DONE : GATEWAY_FAILED);
+
+	/* What the host sent past the failed frame ends with a pause, the next magic follows it */
+	do
+	{
+		SRV_GATEWAY_Poll();
+	} while ((HAL_GetTick() - ReceivedAt) < GATEWAY_IDLE_MS);
+	Consumed = Received;
+}
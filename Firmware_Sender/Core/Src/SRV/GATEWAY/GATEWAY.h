@@ -0,0 +1,90 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: GATEWAY.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * UART gateway: a host streams an image into USART1 and it is forwarded
+ * on CAN while it is still arriving, so one board serves any image.
+ *
+ * USART1 (PA9 TX, PA10 RX, 8N1) is received by DMA1 channel 5 into a
+ * ring buffer in circular mode, nothing is copied until SRV/TRANSFER
+ * reads a byte. The transfer is stop-and-wait, so the bytes in front of
+ * the frame being sent are never read again and their space is handed
+ * back to the host as credit:
+ *
+ *   host -> gateway : GATEWAY_START_MAGIC, then the session as it is
+ *                     sent on CAN, the image header and the stream
+ *   gateway -> host : GATEWAY_CREDIT for every GATEWAY_CREDIT_BLOCK bytes
+ *                     the host may send on, the first ones right after
+ *                     the magic, then GATEWAY_DONE or GATEWAY_FAILED
+ *
+ * The host never has more than the ring size less one block in flight,
+ * so the DMA cannot overwrite a byte still needed, however slow the bus,
+ * and its position is read without interrupts.
+ */
+#ifndef GATEWAY_H_
+#define GATEWAY_H_
+
+#include "main.h"
+
+/* Protocol on USART1 */
+#define GATEWAY_START_MAGIC         "GWS1"
+#define GATEWAY_START_MAGIC_SIZE    4U
+#define GATEWAY_CREDIT              0x06U
+#define GATEWAY_DONE                0x04U
+#define GATEWAY_FAILED              0x15U
+
+/**
+ * @brief Configure USART1 and start receiving into the ring buffer.
+ *
+ * @details Needs PCLK2 of at least 16 times GATEWAY_BAUDRATE.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_GATEWAY_Init(void);
+
+/**
+ * @brief Wait for a host to start a session and grant it the first credits.
+ *
+ * @details Bytes in front of GATEWAY_START_MAGIC are dropped.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_GATEWAY_Open(void);
+
+/**
+ * @brief Size of the session, from the stream size in its image header.
+ *
+ * @details Waits for the header without giving credit for any of it, to be
+ * called before SRV/TRANSFER sends the header.
+ *
+ * @param None
+ * @return uint32_t Session size in bytes, header included.
+ */
+uint32_t SRV_GATEWAY_GetSessionSize(void);
+
+/**
+ * @brief Byte source of SRV/TRANSFER, waits until the byte arrived.
+ *
+ * @details Asking for a byte of frame n releases the bytes of the frames
+ * before it. A host silent for GATEWAY_TIMEOUT_MS gets GATEWAY_FAILED and
+ * the board is reset.
+ *
+ * @param Offset Offset of the byte in the session.
+ * @return uint8_t Byte at Offset.
+ */
+uint8_t SRV_GATEWAY_Byte(uint32_t Offset);
+
+/**
+ * @brief Report the outcome to the host and drop what it still sends.
+ *
+ * @param Completed 1 when every frame was acknowledged.
+ * @return None
+ */
+void SRV_GATEWAY_Close(uint8_t Completed);
+
+#endif /* GATEWAY_H_ */
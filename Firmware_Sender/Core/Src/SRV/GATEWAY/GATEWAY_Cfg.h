@@ -0,0 +1,32 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: GATEWAY_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef GATEWAY_CFG_H_
+#define GATEWAY_CFG_H_
+
+/*
+ * 1: forward the images a host streams in on USART1 instead of sending
+ * dataToWrite, one session after the other. The core then runs at 64MHz
+ * from the PLL so USART1 reaches the baud rate, APB1 stays at 8MHz.
+ */
+#define GATEWAY_ENABLE              0
+
+/* USART1 baud rate, at most 4Mbaud (PCLK2 / 16) */
+#define GATEWAY_BAUDRATE            2000000UL
+
+/* DMA ring buffer, a power of two */
+#define GATEWAY_RING_SIZE           2048UL
+
+/* Bytes the host may send per GATEWAY_CREDIT byte, a divisor of GATEWAY_RING_SIZE */
+#define GATEWAY_CREDIT_BLOCK        256UL
+
+/* A session whose host sent nothing for this long is failed and the board reset */
+#define GATEWAY_TIMEOUT_MS          2000U
+
+/* Silence on the line that ends the bytes of a finished session */
+#define GATEWAY_IDLE_MS             50U
+
+#endif /* GATEWAY_CFG_H_ */
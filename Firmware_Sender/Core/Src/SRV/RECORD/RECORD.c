@@ -0,0 +1,319 @@
+/*================================================================
+ * 	File Name: RECORD.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "RECORD.h"
+
+/* What the next character of the file is */
+#define RECORD_STATE_START      0U  /* ':' or 'S' of a record, or blank lines */
+#define RECORD_STATE_TYPE       1U  /* Type digit of an S-record */
+#define RECORD_STATE_DIGITS     2U  /* Hex digits of the record bytes */
+#define RECORD_STATE_LINE_END   3U  /* Blanks up to the end of the line */
+#define RECORD_STATE_STOPPED    4U  /* End of file or error */
+
+/* Count, address, type, 255 data bytes and the checksum of an Intel HEX record */
+#define RECORD_MAX_BYTES        260U
+
+#define RECORD_NOT_HEX          0xFFU
+
+static SRV_RECORD_Extent_t ExtentCallback;
+static uint8_t State;
+static uint8_t Status;
+static uint8_t Format;
+static uint8_t SrecType;
+static uint8_t Record[RECORD_MAX_BYTES];
+static uint32_t Received;           /* Bytes of the record parsed so far */
+static uint32_t Expected;           /* Bytes of the record, known from its count */
+static uint8_t HighNibble;          /* First digit of the byte being parsed, RECORD_NOT_HEX if none */
+static uint8_t Sum;
+static uint32_t Offset;             /* Extended segment or linear address of Intel HEX */
+static uint32_t Line;
+static uint32_t Entry;
+
+static uint8_t SRV_RECORD_Nibble(uint8_t Char)
+{
+	uint8_t Value = RECORD_NOT_HEX;
+
+	if ((uint8_t)(Char - '0') < 10U)
+	{
+		Value = (uint8_t)(Char - '0');
+	}
+	else if ((uint8_t)((Char | 0x20U) - 'a') < 6U)
+	{
+		Value = (uint8_t)((Char | 0x20U) - 'a' + 10U);
+	}
+	return Value;
+}
+
+static uint32_t SRV_RECORD_BigEndian(const uint8_t *Bytes, uint8_t Count)
+{
+	uint32_t Value = 0;
+
+	while (Count > 0U)
+	{
+		Value = (Value << 8) | *Bytes++;
+		Count--;
+	}
+	return Value;
+}
+
+/* Number of address bytes of an S-record type, 0 for an unknown type */
+static uint8_t SRV_RECORD_SrecAddressSize(uint8_t Type)
+{
+	static const uint8_t Sizes[10] = {2U, 2U, 3U, 4U, 0U, 2U, 3U, 4U, 3U, 2U};
+
+	return Sizes[Type];
+}
+
+static uint8_t SRV_RECORD_HexRecord(void)
+{
+	uint8_t Count = Record[0];
+	uint32_t Address = ((uint32_t)Record[1] << 8) | Record[2];
+	uint8_t Result = RECORD_OK;
+
+	if (Sum != 0U)
+	{
+		return RECORD_BAD_CHECKSUM;
+	}
+	switch (Record[3])
+	{
+	case 0x00U: /* Data */
+		if (Count > 0U)
+		{
+			ExtentCallback(Offset + Address, &Record[4], Count);
+		}
+		break;
+	case 0x01U: /* End of file */
+		Result = RECORD_END;
+		break;
+	case 0x02U: /* Extended segment address */
+		Result = (Count == 2U) ? RECORD_OK : RECORD_BAD_LENGTH;
+		Offset = SRV_RECORD_BigEndian(&Record[4], 2U) << 4;
+		break;
+	case 0x03U: /* Start segment address, CS:IP */
+		Result = (Count == 4U) ? RECORD_OK : RECORD_BAD_LENGTH;
+		Entry = (SRV_RECORD_BigEndian(&Record[4], 2U) << 4) + SRV_RECORD_BigEndian(&Record[6], 2U);
+		break;
+	case 0x04U: /* Extended linear address */
+		Result = (Count == 2U) ? RECORD_OK : RECORD_BAD_LENGTH;
+		Offset = SRV_RECORD_BigEndian(&Record[4], 2U) << 16;
+		break;
+	case 0x05U: /* Start linear address */
+		Result = (Count == 4U) ? RECORD_OK : RECORD_BAD_LENGTH;
+		Entry = SRV_RECORD_BigEndian(&Record[4], 4U);
+		break;
+	default:
+		Result = RECORD_BAD_TYPE;
+		break;
+	}
+	return Result;
+}
+
+static uint8_t SRV_RECORD_SrecRecord(void)
+{
+	uint8_t AddressSize = SRV_RECORD_SrecAddressSize(SrecType);
+	uint32_t Address = SRV_RECORD_BigEndian(&Record[1], AddressSize);
+	uint32_t DataSize = Expected - 2U - AddressSize;
+	uint8_t Result = RECORD_OK;
+
+	if (Sum != 0xFFU)
+	{
+		return RECORD_BAD_CHECKSUM;
+	}
+	switch (SrecType)
+	{
+	case 1U: /* Data, 16, 24 or 32-bit address */
+	case 2U:
+	case 3U:
+		if (DataSize > 0U)
+		{
+			ExtentCallback(Address, &Record[1U + AddressSize], DataSize);
+		}
+		break;
+	case 7U: /* Start address, which ends the file */
+	case 8U:
+	case 9U:
+		Entry = Address;
+		Result = RECORD_END;
+		break;
+	default: /* Header and record counts */
+		break;
+	}
+	return Result;
+}
+
+/* Check the count byte, the first byte of every record */
+static uint8_t SRV_RECORD_Count(uint8_t Count)
+{
+	uint8_t Result = RECORD_OK;
+
+	if (Format == RECORD_FORMAT_HEX)
+	{
+		Expected = (uint32_t)Count + 5U;
+	}
+	else
+	{
+		/* The count covers the address, the data and the checksum */
+		Expected = (uint32_t)Count + 1U;
+		if (Count < (uint8_t)(SRV_RECORD_SrecAddressSize(SrecType) + 1U))
+		{
+			Result = RECORD_BAD_LENGTH;
+		}
+	}
+	return Result;
+}
+
+void SRV_RECORD_Init(SRV_RECORD_Extent_t Extent)
+{
+	ExtentCallback = Extent;
+	State = RECORD_STATE_START;
+	Status = RECORD_OK;
+	Format = RECORD_FORMAT_NONE;
+	Offset = 0;
+	Line = 1;
+	Entry = 0;
+}
+
+uint8_t SRV_RECORD_Feed(const uint8_t *Input, uint32_t Length)
+{
+	const uint8_t *End = Input + Length;
+	uint8_t Char;
+	uint8_t Nibble;
+
+	while ((Input < End) && (State != RECORD_STATE_STOPPED))
+	{
+		Char = *Input++;
+		switch (State)
+		{
+		case RECORD_STATE_DIGITS:
+			Nibble = SRV_RECORD_Nibble(Char);
+			if (Nibble == RECORD_NOT_HEX)
+			{
+				Status = ((Char == '\r') || (Char == '\n')) ? RECORD_BAD_LENGTH : RECORD_BAD_CHAR;
+				State = RECORD_STATE_STOPPED;
+				break;
+			}
+			if (HighNibble == RECORD_NOT_HEX)
+			{
+				HighNibble = Nibble;
+				break;
+			}
+			Record[Received] = (uint8_t)((HighNibble << 4) | Nibble);
+			Sum = (uint8_t)(Sum + Record[Received]);
+			HighNibble = RECORD_NOT_HEX;
+			if ((Received == 0U) && (SRV_RECORD_Count(Record[0]) != RECORD_OK))
+			{
+				Status = RECORD_BAD_LENGTH;
+				State = RECORD_STATE_STOPPED;
+				break;
+			}
+			Received++;
+
+			/* Most of the file: take whole bytes without going around the switch,
+			 * anything else is left to the character by character path */
+			while ((Received < Expected) && ((End - Input) >= 2))
+			{
+				uint8_t High = SRV_RECORD_Nibble(Input[0]);
+				uint8_t Low = SRV_RECORD_Nibble(Input[1]);
+
+				if ((High | Low) > 0x0FU)
+				{
+					break;
+				}
+				Input += 2;
+				Record[Received] = (uint8_t)((High << 4) | Low);
+				Sum = (uint8_t)(Sum + Record[Received]);
+				Received++;
+			}
+			if (Received == Expected)
+			{
+				Status = (Format == RECORD_FORMAT_HEX) ? SRV_RECORD_HexRecord() : SRV_RECORD_SrecRecord();
+				State = (Status == RECORD_OK) ? RECORD_STATE_LINE_END : RECORD_STATE_STOPPED;
+			}
+			break;
+
+		case RECORD_STATE_START:
+			if ((Char == ':') && (Format != RECORD_FORMAT_SREC))
+			{
+				Format = RECORD_FORMAT_HEX;
+				State = RECORD_STATE_DIGITS;
+			}
+			else if ((Char == 'S') && (Format != RECORD_FORMAT_HEX))
+			{
+				Format = RECORD_FORMAT_SREC;
+				State = RECORD_STATE_TYPE;
+			}
+			else if (Char == '\n')
+			{
+				Line++;
+			}
+			else if ((Char != '\r') && (Char != ' ') && (Char != '\t'))
+			{
+				Status = RECORD_BAD_CHAR;
+				State = RECORD_STATE_STOPPED;
+			}
+			Received = 0;
+			Expected = 1;
+			HighNibble = RECORD_NOT_HEX;
+			Sum = 0;
+			break;
+
+		case RECORD_STATE_TYPE:
+			SrecType = (uint8_t)(Char - '0');
+			if ((SrecType > 9U) || (SRV_RECORD_SrecAddressSize(SrecType) == 0U))
+			{
+				Status = RECORD_BAD_TYPE;
+				State = RECORD_STATE_STOPPED;
+			}
+			else
+			{
+				State = RECORD_STATE_DIGITS;
+			}
+			break;
+
+		default: /* RECORD_STATE_LINE_END */
+			if (Char == '\n')
+			{
+				Line++;
+				State = RECORD_STATE_START;
+			}
+			else if ((Char != '\r') && (Char != ' ') && (Char != '\t'))
+			{
+				Status = RECORD_BAD_LENGTH;
+				State = RECORD_STATE_STOPPED;
+			}
+			break;
+		}
+	}
+	return Status;
+}
+
+uint8_t SRV_RECORD_Finish(void)
+{
+	if (State == RECORD_STATE_DIGITS || State == RECORD_STATE_TYPE)
+	{
+		Status = RECORD_BAD_LENGTH;
+		State = RECORD_STATE_STOPPED;
+	}
+	else if (Status == RECORD_OK)
+	{
+		Status = RECORD_END;
+		State = RECORD_STATE_STOPPED;
+	}
+	return Status;
+}
+
+uint8_t SRV_RECORD_GetFormat(void)
+{
+	return Format;
+}
+
+uint32_t SRV_RECORD_GetLine(void)
+{
+	return Line;
+}
+
+uint32_t SRV_RECORD_GetEntry(void)
+{
+	return Entry;
+}
@@ -0,0 +1,108 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: RECORD.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Streaming parser of Intel HEX and Motorola S-record files.
+ *
+ * The text is fed in chunks of any size, cut anywhere, and the data of
+ * every data record is handed to an extent callback with its absolute
+ * address as soon as the record is complete and its checksum matched.
+ * The parser keeps one record (at most 260 bytes) and a few counters,
+ * it allocates nothing, so the same code runs on a sender fed from a
+ * UART and in the host flasher.
+ *
+ * Records are taken as they come: extents follow each other in the
+ * order of the file, which is address order for the output of objcopy.
+ * Gaps between extents are the caller's business (erased flash).
+ *
+ * Accepted records:
+ *   Intel HEX : 00 data, 01 end of file, 02 extended segment address,
+ *               03 start segment address, 04 extended linear address,
+ *               05 start linear address
+ *   S-record  : S0 header, S1/S2/S3 data, S5/S6 count, S7/S8/S9 start
+ *               address and end of file
+ * A file is one format or the other, one record per line.
+ */
+#ifndef RECORD_H_
+#define RECORD_H_
+
+#include <stdint.h>
+
+#define RECORD_OK               0U   /**< Input consumed, waiting for more */
+#define RECORD_END              1U   /**< End of file record seen, the rest is ignored */
+#define RECORD_BAD_CHAR         2U   /**< Not a record, or not a hex digit inside one */
+#define RECORD_BAD_LENGTH       3U   /**< Record shorter or longer than its count */
+#define RECORD_BAD_CHECKSUM     4U
+#define RECORD_BAD_TYPE         5U   /**< Unknown record type */
+
+#define RECORD_FORMAT_NONE      0U   /**< No record seen yet */
+#define RECORD_FORMAT_HEX       1U
+#define RECORD_FORMAT_SREC      2U
+
+/**
+ * @brief Receiver of the data of one data record.
+ *
+ * @param Address Absolute address of the first byte.
+ * @param Data Bytes of the record, valid during the call only.
+ * @param Length Number of bytes, at least 1.
+ */
+typedef void (*SRV_RECORD_Extent_t)(uint32_t Address, const uint8_t *Data, uint32_t Length);
+
+/**
+ * @brief Restart the parser at the beginning of a file.
+ *
+ * @param Extent Callback receiving the data records.
+ * @return None
+ */
+void SRV_RECORD_Init(SRV_RECORD_Extent_t Extent);
+
+/**
+ * @brief Parse the next bytes of the file.
+ *
+ * @param Input Next bytes of the text.
+ * @param Length Number of bytes in Input.
+ * @return uint8_t RECORD_OK, RECORD_END once the end of file record is
+ *         parsed, or the error that stopped the parser. An error sticks
+ *         until SRV_RECORD_Init.
+ */
+uint8_t SRV_RECORD_Feed(const uint8_t *Input, uint32_t Length);
+
+/**
+ * @brief Check the parser after the last bytes of the file.
+ *
+ * @details A file is allowed to end without an end of file record, but not
+ * in the middle of a record.
+ *
+ * @param None
+ * @return uint8_t RECORD_END if the file ended between records, the error otherwise.
+ */
+uint8_t SRV_RECORD_Finish(void);
+
+/**
+ * @brief Get the format of the file, known after its first record.
+ *
+ * @param None
+ * @return uint8_t RECORD_FORMAT_HEX, RECORD_FORMAT_SREC or RECORD_FORMAT_NONE.
+ */
+uint8_t SRV_RECORD_GetFormat(void);
+
+/**
+ * @brief Get the line being parsed, the one an error was found in.
+ *
+ * @param None
+ * @return uint32_t Line number, starting at 1.
+ */
+uint32_t SRV_RECORD_GetLine(void);
+
+/**
+ * @brief Get the start address of the file.
+ *
+ * @param None
+ * @return uint32_t Address of the start record, 0 if there was none.
+ */
+uint32_t SRV_RECORD_GetEntry(void);
+
+#endif /* RECORD_H_ */
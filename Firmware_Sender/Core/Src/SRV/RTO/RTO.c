@@ -0,0 +1,88 @@
+/*================================================================
+ * 	File Name: RTO.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "RTO.h"
+#include "RTO_Cfg.h"
+
+/* SRTT is kept scaled by 8 and RTTVAR scaled by 4 to avoid fractions. */
+#define RTO_SRTT_SHIFT      3U
+#define RTO_RTTVAR_SHIFT    2U
+
+static uint32_t SmoothedRtt = 0;        /* SRTT << 3 */
+static uint32_t RttVariation = 0;       /* RTTVAR << 2 */
+static uint32_t Timeout = RTO_INITIAL_TICKS;
+static uint8_t  HasSample = 0;
+static uint32_t Retransmissions = 0;
+
+static uint32_t SRV_RTO_Clamp(uint32_t Ticks)
+{
+	if (Ticks < RTO_MIN_TICKS)
+	{
+		Ticks = RTO_MIN_TICKS;
+	}
+	else if (Ticks > RTO_MAX_TICKS)
+	{
+		Ticks = RTO_MAX_TICKS;
+	}
+	return Ticks;
+}
+
+void SRV_RTO_Init(void)
+{
+	SmoothedRtt = 0;
+	RttVariation = 0;
+	Timeout = RTO_INITIAL_TICKS;
+	HasSample = 0;
+	Retransmissions = 0;
+}
+
+void SRV_RTO_Sample(uint16_t RttTicks)
+{
+	int32_t Delta;
+
+	if (!HasSample)
+	{
+		/* First measurement: SRTT = R, RTTVAR = R/2 */
+		SmoothedRtt = (uint32_t)RttTicks << RTO_SRTT_SHIFT;
+		RttVariation = (uint32_t)RttTicks << (RTO_RTTVAR_SHIFT - 1U);
+		HasSample = 1;
+	}
+	else
+	{
+		/* SRTT += (R - SRTT) / 8 */
+		Delta = (int32_t)RttTicks - (int32_t)(SmoothedRtt >> RTO_SRTT_SHIFT);
+		SmoothedRtt = (uint32_t)((int32_t)SmoothedRtt + Delta);
+		/* RTTVAR += (|R - SRTT| - RTTVAR) / 4 */
+		if (Delta < 0)
+		{
+			Delta = -Delta;
+		}
+		Delta -= (int32_t)(RttVariation >> RTO_RTTVAR_SHIFT);
+		RttVariation = (uint32_t)((int32_t)RttVariation + Delta);
+	}
+
+	/* RTO = SRTT + 4 * RTTVAR, RTTVAR is already scaled by 4 */
+	Timeout = SRV_RTO_Clamp((SmoothedRtt >> RTO_SRTT_SHIFT) + RttVariation);
+}
+
+void SRV_RTO_Backoff(void)
+{
+	Timeout = SRV_RTO_Clamp(Timeout << 1);
+	Retransmissions++;
+}
+
+uint16_t SRV_RTO_GetTimeout(void)
+{
+	return (uint16_t)Timeout;
+}
+
+uint16_t SRV_RTO_GetSmoothedRtt(void)
+{
+	return (uint16_t)(SmoothedRtt >> RTO_SRTT_SHIFT);
+}
+
+uint32_t SRV_RTO_GetRetransmissions(void)
+{
+	return Retransmissions;
+}
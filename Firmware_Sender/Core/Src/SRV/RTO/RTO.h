@@ -0,0 +1,78 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: RTO.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Retransmission timeout estimator for the stop-and-wait transfer.
+ * The smoothed round-trip time (SRTT) and its variation (RTTVAR) are
+ * tracked with the integer form of Jacobson's algorithm (RFC 6298):
+ *
+ *   RTTVAR = 3/4 * RTTVAR + 1/4 * |SRTT - R|
+ *   SRTT   = 7/8 * SRTT   + 1/8 * R
+ *   RTO    = SRTT + 4 * RTTVAR
+ *
+ * Samples of retransmitted frames must not be fed to the estimator
+ * (Karn's algorithm), because the ACK can not be matched to one send.
+ */
+#ifndef RTO_H_
+#define RTO_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Reset the estimator to its initial timeout.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_RTO_Init(void);
+
+/**
+ * @brief Feed one measured round-trip time into the estimator.
+ *
+ * @details Updates SRTT/RTTVAR and recomputes the timeout. Any exponential
+ * backoff applied by SRV_RTO_Backoff is discarded.
+ *
+ * @param RttTicks Round-trip time of a frame that was sent exactly once, in TIM1 ticks.
+ * @return None
+ */
+void SRV_RTO_Sample(uint16_t RttTicks);
+
+/**
+ * @brief Double the current timeout after it expired.
+ *
+ * @details The timeout is clamped to RTO_MAX_TICKS and the retransmission
+ * counter is incremented.
+ *
+ * @param None
+ * @return None
+ */
+void SRV_RTO_Backoff(void);
+
+/**
+ * @brief Get the current retransmission timeout.
+ *
+ * @param None
+ * @return uint16_t Timeout in TIM1 ticks.
+ */
+uint16_t SRV_RTO_GetTimeout(void);
+
+/**
+ * @brief Get the smoothed round-trip time.
+ *
+ * @param None
+ * @return uint16_t SRTT in TIM1 ticks, 0 if no sample was taken yet.
+ */
+uint16_t SRV_RTO_GetSmoothedRtt(void);
+
+/**
+ * @brief Get the number of retransmissions since SRV_RTO_Init.
+ *
+ * @param None
+ * @return uint32_t Retransmission count.
+ */
+uint32_t SRV_RTO_GetRetransmissions(void);
+
+#endif /* RTO_H_ */
@@ -0,0 +1,38 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: RTO_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef RTO_CFG_H_
+#define RTO_CFG_H_
+
+/*
+ * All values are expressed in TIM1 ticks. TIM1 runs from the 8MHz HSI with a
+ * prescaler of 80, so one tick is 10us and the 16-bit counter wraps every 655ms.
+ */
+#define RTO_TICK_US             10U
+
+/* Timeout used before the first round-trip sample has been taken (20ms). */
+#define RTO_INITIAL_TICKS       2000U
+
+/* Lower bound of the timeout, protects against a too aggressive estimate (1ms). */
+#define RTO_MIN_TICKS           100U
+
+/*
+ * Upper bound of the timeout (600ms). It must stay below the TIM1 wrap period
+ * so that elapsed time can be computed with a plain 16-bit subtraction.
+ */
+#define RTO_MAX_TICKS           60000U
+
+/*
+ * Wait for the ACK of a frame the receiver answered with ACK_FRAME_BUSY
+ * (200ms), a few page erase and program times. It does not back off the
+ * timeout and the frame is sent again when it expires.
+ */
+#define RTO_BUSY_TICKS          20000U
+
+/* Consecutive timeouts of the same frame before the session is aborted. */
+#define RTO_MAX_RETRIES         10U
+
+#endif /* RTO_CFG_H_ */
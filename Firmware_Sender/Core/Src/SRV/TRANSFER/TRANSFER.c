@@ -0,0 +1,288 @@
+/*================================================================
+ * 	File Name: TRANSFER.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "TRANSFER.h"
+#include "../RTO/RTO.h"
+#include "../RTO/RTO_Cfg.h"
+#include "../BUSMON/BUSMON.h"
+
+/* Current tick of the time base */
+#define TRANSFER_NOW()      ((uint16_t)__HAL_TIM_GET_COUNTER(TransferTimer))
+
+static CAN_HandleTypeDef *TransferCan;
+static TIM_HandleTypeDef *TransferTimer;
+static CAN_TxHeaderTypeDef DataHeader;
+static uint32_t DataMailbox;
+
+/* Session being sent: a table of frames, or a byte source when SessionTable is NULL */
+static const TxFrame_t *SessionTable;
+static SRV_TRANSFER_Source_t SessionSource;
+static uint32_t SessionSize;
+
+static volatile uint32_t FrameCount = 0;    /* Index of the outstanding frame */
+static volatile uint8_t Acked = 1;          /* The outstanding frame was acknowledged */
+static volatile uint16_t SentAt = 0;        /* Tick at which the outstanding frame was (re)transmitted */
+static volatile uint16_t AckedAt = 0;       /* Tick at which the last frame was acknowledged */
+static volatile uint8_t Retries = 0;        /* Number of timeouts of the outstanding frame */
+static volatile uint8_t Busy = 0;           /* The receiver is programming the page the outstanding frame completed */
+static volatile uint8_t RespReceived = 0;   /* An answer arrived on the control channel */
+static uint8_t RespData[8];                 /* Last answer of the control channel */
+
+static void SRV_TRANSFER_SendDataFrame(void)
+{
+	uint8_t Data[CHUNK_SIZE];
+	uint32_t Offset = FrameCount * CHUNK_SIZE;
+	const TxFrame_t *Frame;
+	uint32_t Index;
+
+	if (SessionTable != NULL)
+	{
+		/* Only this frame is outstanding, so a mailbox is empty and CODE is its number */
+		Frame = &SessionTable[FrameCount];
+		Index = (TransferCan->Instance->TSR & CAN_TSR_CODE) >> CAN_TSR_CODE_Pos;
+		SentAt = TRANSFER_NOW();
+		TransferCan->Instance->sTxMailBox[Index].TDTR = Frame->TDTR;
+		TransferCan->Instance->sTxMailBox[Index].TDLR = Frame->TDLR;
+		TransferCan->Instance->sTxMailBox[Index].TDHR = Frame->TDHR;
+		/* TXRQ is set in the record, the frame is requested by this store */
+		TransferCan->Instance->sTxMailBox[Index].TIR = Frame->TIR;
+		DataMailbox = 1UL << Index;
+		return;
+	}
+
+	for (uint8_t i = 0; i < CHUNK_SIZE; i++)
+	{
+		Data[i] = ((Offset + i) < SessionSize) ? SessionSource(Offset + i) : 0xFF;
+	}
+	DataHeader.StdId = DATA_FRAME_ID_SEQ(FrameCount);
+
+	SentAt = TRANSFER_NOW();
+	if (HAL_CAN_AddTxMessage(TransferCan, &DataHeader, Data, &DataMailbox) != HAL_OK)
+	{
+		Error_Handler();
+	}
+}
+
+/* Send frames FirstFrame..TotalFrames-1 of the session set up by the caller */
+static uint8_t SRV_TRANSFER_Run(uint32_t TotalFrames, uint32_t FirstFrame)
+{
+	FrameCount = FirstFrame;
+	Acked = 1;
+	AckedAt = TRANSFER_NOW();
+
+	while (1)
+	{
+		if (Acked)
+		{
+			if (FrameCount >= TotalFrames)
+			{
+				return 1;
+			}
+			/* Space the frames out while the transmit error counter is high */
+			if (HAL_CAN_GetTxMailboxesFreeLevel(TransferCan) > 0 &&
+				(uint16_t)(TRANSFER_NOW() - AckedAt) >= SRV_BUSMON_GetThrottle())
+			{
+				Retries = 0;
+				Busy = 0;
+				Acked = 0;
+				SRV_TRANSFER_SendDataFrame();
+			}
+		}
+		else if (SRV_BUSMON_IsBusOff())
+		{
+			/* Nothing can be acknowledged until the controller rejoins the bus,
+			   the wait does not count as a timeout of the outstanding frame. */
+			SentAt = TRANSFER_NOW();
+		}
+		else if ((uint16_t)(TRANSFER_NOW() - SentAt) >= (Busy ? RTO_BUSY_TICKS : SRV_RTO_GetTimeout()))
+		{
+			/* The frame or its ACK was lost: back off and send the same frame again.
+			   A busy receiver answers again, its programming time says nothing of the round trip. */
+			if (++Retries > RTO_MAX_RETRIES)
+			{
+				return 0;
+			}
+			/* Drop the old copy if it is still waiting for the bus. */
+			if (HAL_CAN_IsTxMessagePending(TransferCan, DataMailbox))
+			{
+				HAL_CAN_AbortTxRequest(TransferCan, DataMailbox);
+			}
+			if (!Busy)
+			{
+				SRV_RTO_Backoff();
+			}
+			SRV_TRANSFER_SendDataFrame();
+		}
+	}
+}
+
+/* The last answer of the control channel is the one to Command, positive or negative */
+static uint8_t SRV_TRANSFER_Answers(uint8_t Command)
+{
+	return (RespData[0] == (Command | RESP_POSITIVE)) || ((RespData[0] == RESP_NEGATIVE) && (RespData[1] == Command));
+}
+
+/* Ask the receiver for the frame to continue from, refused when it did not take the header */
+static uint8_t SRV_TRANSFER_QueryResume(uint32_t *FirstFrame)
+{
+	uint8_t Cmd[1] = {CMD_RESUME_QUERY};
+	uint8_t Response[8];
+
+	if (!SRV_TRANSFER_Command(Cmd, sizeof(Cmd), Response))
+	{
+		return 0;
+	}
+	*FirstFrame = (uint32_t)Response[1] | ((uint32_t)Response[2] << 8) |
+	              ((uint32_t)Response[3] << 16) | ((uint32_t)Response[4] << 24);
+	return 1;
+}
+
+void SRV_TRANSFER_Init(CAN_HandleTypeDef *Can, TIM_HandleTypeDef *Timer)
+{
+	TransferCan = Can;
+	TransferTimer = Timer;
+
+	DataHeader.IDE = CAN_ID_STD;
+	DataHeader.StdId = DATA_FRAME_ID_SEQ(0);
+	DataHeader.RTR = CAN_RTR_DATA;
+	DataHeader.DLC = CHUNK_SIZE;
+
+	FrameCount = 0;
+	Acked = 1;
+	Retries = 0;
+	Busy = 0;
+	RespReceived = 0;
+
+	SRV_BUSMON_Init(Can);
+	SRV_RTO_Init();
+}
+
+void SRV_TRANSFER_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data)
+{
+	/* Only an ACK for the outstanding frame completes it, stale ACKs of a
+	   retransmitted frame carry the other sequence bit and are dropped. */
+	if (!Acked && Header->StdId == ACK_FRAME_ID && Header->DLC >= 2 &&
+		Data[0] == ACK_FRAME_BUSY && Data[1] == (FrameCount & DATA_FRAME_SEQ_MASK))
+	{
+		/* The frame arrived and completed a page, wait for the programming instead of timing out */
+		SentAt = TRANSFER_NOW();
+		Retries = 0;
+		Busy = 1;
+	}
+	else if (!Acked && Header->StdId == ACK_FRAME_ID && Header->DLC >= 2 &&
+		Data[0] == ACK_FRAME_DATA && Data[1] == (FrameCount & DATA_FRAME_SEQ_MASK))
+	{
+		/* Karn's algorithm: the round trip of a retransmitted frame is ambiguous,
+		   the one of a busy frame holds the page programming */
+		if (Retries == 0 && !Busy)
+		{
+			SRV_RTO_Sample((uint16_t)(TRANSFER_NOW() - SentAt));
+		}
+		FrameCount++;
+		AckedAt = TRANSFER_NOW();
+		Acked = 1;
+	}
+	else if (Header->StdId == RESP_FRAME_ID && Header->DLC >= 1 && !RespReceived)
+	{
+		for (uint8_t i = 0; i < 8; i++)
+		{
+			RespData[i] = (i < Header->DLC) ? Data[i] : 0;
+		}
+		RespReceived = 1;
+	}
+}
+
+uint8_t SRV_TRANSFER_Command(const uint8_t *Cmd, uint8_t Length, uint8_t *Response)
+{
+	CAN_TxHeaderTypeDef CmdHeader = {0};
+	uint32_t CmdMailbox;
+	uint8_t Attempt;
+	uint16_t QueriedAt;
+
+	CmdHeader.IDE = CAN_ID_STD;
+	CmdHeader.StdId = CMD_FRAME_ID;
+	CmdHeader.RTR = CAN_RTR_DATA;
+	CmdHeader.DLC = Length;
+
+	for (Attempt = 0; Attempt <= RTO_MAX_RETRIES; Attempt++)
+	{
+		RespReceived = 0;
+		QueriedAt = TRANSFER_NOW();
+		if (HAL_CAN_AddTxMessage(TransferCan, &CmdHeader, (uint8_t *)Cmd, &CmdMailbox) != HAL_OK)
+		{
+			Error_Handler();
+		}
+		/* A late answer to an earlier, retransmitted command is dropped, the wait goes on */
+		while ((uint16_t)(TRANSFER_NOW() - QueriedAt) < SRV_RTO_GetTimeout())
+		{
+			/* The ISR stores no answer while RespReceived is set */
+			if (RespReceived)
+			{
+				if (SRV_TRANSFER_Answers(Cmd[0]))
+				{
+					break;
+				}
+				RespReceived = 0;
+			}
+		}
+		if (RespReceived && SRV_TRANSFER_Answers(Cmd[0]))
+		{
+			if (Attempt == 0)
+			{
+				SRV_RTO_Sample((uint16_t)(TRANSFER_NOW() - QueriedAt));
+			}
+			if (Response != NULL)
+			{
+				for (uint8_t i = 0; i < 8; i++)
+				{
+					Response[i] = RespData[i];
+				}
+			}
+			return (RespData[0] == (Cmd[0] | RESP_POSITIVE));
+		}
+		if (HAL_CAN_IsTxMessagePending(TransferCan, CmdMailbox))
+		{
+			HAL_CAN_AbortTxRequest(TransferCan, CmdMailbox);
+		}
+		SRV_RTO_Backoff();
+	}
+	return 0;
+}
+
+uint8_t SRV_TRANSFER_EnterUpdate(void)
+{
+	uint8_t Cmd[1] = {CMD_ENTER_UPDATE};
+
+	return SRV_TRANSFER_Command(Cmd, sizeof(Cmd), NULL);
+}
+
+uint8_t SRV_TRANSFER_OpenImage(SRV_TRANSFER_Source_t Source, uint32_t *FirstFrame)
+{
+	uint8_t Cmd[1] = {CMD_IMAGE_START};
+
+	return SRV_TRANSFER_Command(Cmd, sizeof(Cmd), NULL) && SRV_TRANSFER_Send(Source, IMAGE_HEADER_SIZE, 0) &&
+	       SRV_TRANSFER_QueryResume(FirstFrame);
+}
+
+uint8_t SRV_TRANSFER_OpenTable(const TxFrame_t *Frames, uint32_t *FirstFrame)
+{
+	uint8_t Cmd[1] = {CMD_IMAGE_START};
+
+	return SRV_TRANSFER_Command(Cmd, sizeof(Cmd), NULL) &&
+	       SRV_TRANSFER_SendTable(Frames, IMAGE_HEADER_SIZE / CHUNK_SIZE, 0) && SRV_TRANSFER_QueryResume(FirstFrame);
+}
+
+uint8_t SRV_TRANSFER_Send(SRV_TRANSFER_Source_t Source, uint32_t Size, uint32_t FirstFrame)
+{
+	SessionTable = NULL;
+	SessionSource = Source;
+	SessionSize = Size;
+	return SRV_TRANSFER_Run((Size + CHUNK_SIZE - 1) / CHUNK_SIZE, FirstFrame);
+}
+
+uint8_t SRV_TRANSFER_SendTable(const TxFrame_t *Frames, uint32_t FrameCount, uint32_t FirstFrame)
+{
+	SessionTable = Frames;
+	return SRV_TRANSFER_Run(FrameCount, FirstFrame);
+}
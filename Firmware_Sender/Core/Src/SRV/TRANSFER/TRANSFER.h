@@ -0,0 +1,131 @@
+/*================================================================
+ *	Project Name: CANtx
+ * 	File Name: TRANSFER.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Sending side of the firmware update protocol.
+ *
+ * Data frames are sent stop-and-wait: the next frame leaves once the
+ * ACK carrying its sequence bit came back, a lost frame or ACK is
+ * recovered by the adaptive timeout of SRV/RTO and the send rate is
+ * lowered on a disturbed bus by SRV/BUSMON. A frame answered with
+ * ACK_FRAME_BUSY completed a page of the receiver, its ACK is waited for
+ * RTO_BUSY_TICKS without backing off the timeout. Commands of the control
+ * channel are retransmitted on the same timeout.
+ *
+ * A session is sent either from a byte source, packed into a frame by
+ * the HAL, or from a table of TxFrame_t records generated on the host,
+ * which are stored into a free mailbox as four words without packing.
+ *
+ * TIM1 (10us tick, free running over 16 bits) is the time base.
+ */
+#ifndef TRANSFER_H_
+#define TRANSFER_H_
+
+#include "main.h"
+
+/**
+ * @brief Source of the bytes to transmit.
+ *
+ * @param Offset Offset of the byte in the session.
+ * @return uint8_t Byte at Offset.
+ */
+typedef uint8_t (*SRV_TRANSFER_Source_t)(uint32_t Offset);
+
+/**
+ * @brief Initialize the transfer engine, SRV/RTO and SRV/BUSMON.
+ *
+ * @param Can Handle of the CAN peripheral, already started.
+ * @param Timer Handle of the running 10us time base.
+ * @return None
+ */
+void SRV_TRANSFER_Init(CAN_HandleTypeDef *Can, TIM_HandleTypeDef *Timer);
+
+/**
+ * @brief Process a received frame, to be called from the CAN RX interrupt.
+ *
+ * @param Header Header of the received frame.
+ * @param Data Payload of the received frame.
+ * @return None
+ */
+void SRV_TRANSFER_RxIndication(const CAN_RxHeaderTypeDef *Header, const uint8_t *Data);
+
+/**
+ * @brief Send a command on the control channel and wait for its answer.
+ *
+ * @param Cmd Command code followed by its parameters.
+ * @param Length Number of bytes in Cmd, at most 8.
+ * @param Response Buffer of 8 bytes receiving the answer, may be NULL.
+ * @return uint8_t 1 on a positive answer to the command, 0 on a negative or no answer.
+ */
+uint8_t SRV_TRANSFER_Command(const uint8_t *Cmd, uint8_t Length, uint8_t *Response);
+
+/**
+ * @brief Get the receiver running, whatever runs on the target.
+ *
+ * @details Sends CMD_ENTER_UPDATE. An application with the update agent
+ * answers and resets into the receiver, the next command is retransmitted
+ * until the receiver is up. The receiver answers as well.
+ *
+ * @param None
+ * @return uint8_t 1 on a positive answer, 0 if the target did not answer (an
+ *         application without the agent, the receiver may still be started by hand).
+ */
+uint8_t SRV_TRANSFER_EnterUpdate(void);
+
+/**
+ * @brief Open an image session and find out where it has to continue.
+ *
+ * @details Sends CMD_IMAGE_START, the IMAGE_HEADER_SIZE bytes of the header at
+ * the start of the session, then asks the receiver for the frame to continue
+ * from, which is past the header and any page it already holds.
+ *
+ * @param Source Source of the session bytes, starting with the header.
+ * @param FirstFrame Receives the index of the first frame to send.
+ * @return uint8_t 1 once the receiver accepted the header, 0 if it refused it or did not answer.
+ */
+uint8_t SRV_TRANSFER_OpenImage(SRV_TRANSFER_Source_t Source, uint32_t *FirstFrame);
+
+/**
+ * @brief Open an image session whose frames come from a table.
+ *
+ * @details Same as SRV_TRANSFER_OpenImage, the header is the first
+ * IMAGE_HEADER_SIZE / CHUNK_SIZE records of the table.
+ *
+ * @param Frames Frames of the session, starting with the header.
+ * @param FirstFrame Receives the index of the first frame to send.
+ * @return uint8_t 1 once the receiver accepted the header, 0 if it refused it or did not answer.
+ */
+uint8_t SRV_TRANSFER_OpenTable(const TxFrame_t *Frames, uint32_t *FirstFrame);
+
+/**
+ * @brief Send a session and wait until its last frame was acknowledged.
+ *
+ * @details The last frame of a session whose size is not a multiple of
+ * CHUNK_SIZE is padded with the erased flash value.
+ *
+ * @param Source Source of the session bytes.
+ * @param Size Session size in bytes.
+ * @param FirstFrame Index of the first frame to send.
+ * @return uint8_t 1 when all frames were acknowledged, 0 if a frame stayed
+ *         unacknowledged for RTO_MAX_RETRIES timeouts.
+ */
+uint8_t SRV_TRANSFER_Send(SRV_TRANSFER_Source_t Source, uint32_t Size, uint32_t FirstFrame);
+
+/**
+ * @brief Send a session from a table and wait until its last frame was acknowledged.
+ *
+ * @details Frame i of the session is Frames[i], its identifier must carry
+ * the sequence bit of i.
+ *
+ * @param Frames Frames of the session.
+ * @param FrameCount Number of frames in the session.
+ * @param FirstFrame Index of the first frame to send.
+ * @return uint8_t 1 when all frames were acknowledged, 0 if a frame stayed
+ *         unacknowledged for RTO_MAX_RETRIES timeouts.
+ */
+uint8_t SRV_TRANSFER_SendTable(const TxFrame_t *Frames, uint32_t FrameCount, uint32_t FirstFrame);
+
+#endif /* TRANSFER_H_ */
@@ -5,18 +5,46 @@
 =================================================================================
   */
 
-/*    |============================|0x08000000
-  *   |         Bootloader         |               >>> 25KB
-  *   |============================|0x08006400
-  *   | 	 Firmware Receiver     |			   >>> 30KB
-  *   |============================|0x0800dc00
-  *   |         New Firmware       |			   >>> 30KB
-  *   |============================|0x08015400
-  */
+/*
+ * Flash of the receiving board (ECU1), the layout of README.md. This board
+ * only sends, the image it serves is linked for slot A or slot B.
+ *
+ *   |============================|0x08000000
+ *   |         Bootloader         |               >>> 8KB
+ *   |============================|0x08002000
+ *   |  Bootloader (HAL) or free  |               >>> 17KB
+ *   |============================|0x08006400
+ *   |     Firmware Receiver      |               >>> 29KB
+ *   |============================|0x0800d800
+ *   | Download journal (JOURNAL) |               >>> 1KB
+ *   |============================|0x0800dc00
+ *   |   New Firmware (slot A)    |               >>> 30KB
+ *   |============================|0x08015400
+ *   |   New Firmware (slot B)    |               >>> 30KB
+ *   |============================|0x0801cc00
+ *   |            Free            |               >>> 11KB
+ *   |============================|0x0801f800
+ *   | Boot control (SRV/BOOTCTL) |               >>> 2KB
+ *   |============================|0x08020000
+ *
+ * SRAM of every image on that board: the first 16 bytes (0x20000000) are
+ * the boot mailbox (SRV/BOOTMBX) in .noinit, kept over a reset, and .data,
+ * .bss, the heap and the stack start at 0x20000010.
+ */
 
 #include "main.h"
 #include "HAL/LED/LED.h"
 #include "HAL/LCD/LCD.h"
+#include "SRV/BUSMON/BUSMON.h"
+#include "SRV/TRANSFER/TRANSFER.h"
+#include "SRV/BENCH/BENCH.h"
+#include "SRV/BENCH/BENCH_Cfg.h"
+#include "SRV/GATEWAY/GATEWAY.h"
+#include "SRV/GATEWAY/GATEWAY_Cfg.h"
+
+#if (BENCH_ENABLE == 1) && (GATEWAY_ENABLE == 1)
+#error "BENCH_ENABLE and GATEWAY_ENABLE select different payloads"
+#endif
 
 CAN_FilterTypeDef FilterConfig;/* - Configuration for CAN message filtering settings. */
 CAN_RxHeaderTypeDef RxHeader;  /* - Header information of received CAN messages. */
@@ -26,15 +54,10 @@ uint8_t RxData[8];			   /* - An array to store received CAN message data, with a
 /*====================================================================================================================*/
 TIM_HandleTypeDef htim1;
 CAN_HandleTypeDef hcan;        /* - Configuration and status of the CAN peripheral. */
-CAN_TxHeaderTypeDef TxHeader;  /* - Header information for CAN messages to be transmitted. */
-uint8_t TxData[8];			   /* - An array used to store data that will be transmitted via CAN, with a maximum length of 8 bytes. */
-uint32_t TxMailbox;            /* - Stores the mailbox number where a transmitted CAN message is placed. */
-
-uint8_t isFree = 0;     	   /* Represents the available space (level) in the mailbox for transmitting CAN messages. */
-uint32_t FrameCount = 0;       /* Keeps track of the number of data frames transmitted so far. */
-uint8_t dataCheck = 0;   	   /* Variable for checking data integrity or performing data validation (not used in the provided code). */
-uint8_t ACK = 1;        	   /* Flag indicating the acknowledgment status for the last transmitted message. It is set to 1 when an acknowledgment is received. */
+
 uint8_t txCompleted = 0;  	   /* Flag indicating whether the entire data transmission process is complete. It is set to 1 when all data frames have been transmitted successfully. */
+uint8_t txAborted = 0;         /* Flag set when a frame stayed unacknowledged for RTO_MAX_RETRIES timeouts. */
+uint32_t firstFrame = 0;       /* Frame the image continues from, past the header and the pages the receiver holds. */
 
 
 /**
@@ -66,11 +89,60 @@ void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
     {
         Error_Handler();
     }
-    if(RxHeader.StdId == ACK_FRAME_ID || RxData[0] == 0x1F){
-    	ACK = 1;
-    	HAL_GPIO_WritePin(GPIOC, LED_GREEN, GPIO_PIN_RESET);
+    /* ACKs of the data frames and answers of the control channel */
+    SRV_TRANSFER_RxIndication(&RxHeader, RxData);
+	HAL_GPIO_WritePin(GPIOC, LED_GREEN, GPIO_PIN_RESET);
+}
+
+/**
+  * @brief CAN error interrupt: error warning, error passive, bus-off or a bus error.
+  *
+  * The controller leaves bus-off on its own (AutoBusOff), the monitor only
+  * tracks the error state the send rate is adapted to.
+  *
+  * @retval None
+  */
+void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan)
+{
+    SRV_BUSMON_ErrorIndication();
+}
+
+#if BENCH_ENABLE == 1
+/**
+  * @brief Open a benchmark session of BENCH_PAYLOAD_SIZE bytes on the receiver.
+  *
+  * @retval 1 if the receiver accepted the session, 0 otherwise.
+  */
+static uint8_t StartBenchmark(void)
+{
+    uint8_t Cmd[5] = {CMD_BENCH_START,
+                      (uint8_t)(BENCH_PAYLOAD_SIZE), (uint8_t)(BENCH_PAYLOAD_SIZE >> 8),
+                      (uint8_t)(BENCH_PAYLOAD_SIZE >> 16), (uint8_t)(BENCH_PAYLOAD_SIZE >> 24)};
+
+    return SRV_TRANSFER_Command(Cmd, sizeof(Cmd), NULL);
+}
+
+/**
+  * @brief Read the measurements of the receiver into SRV/BENCH.
+  *
+  * @retval None
+  */
+static void ReadBenchmarkResults(void)
+{
+    uint8_t Cmd[2] = {CMD_BENCH_RESULT, 0};
+    uint8_t Response[8];
+
+    for (uint8_t Index = BENCH_RESULT_FRAMES; Index <= BENCH_RESULT_PAGES; Index++)
+    {
+        Cmd[1] = Index;
+        if (SRV_TRANSFER_Command(Cmd, sizeof(Cmd), Response) && Response[1] == Index)
+        {
+            SRV_BENCH_SetReceiverResult(Index, (uint32_t)Response[2] | ((uint32_t)Response[3] << 8) |
+                                               ((uint32_t)Response[4] << 16) | ((uint32_t)Response[5] << 24));
+        }
     }
 }
+#endif
 
 
 /*====================================================================================================================*/
@@ -105,54 +177,86 @@ int main(void)
     {
   	  Error_Handler();
     }
+    /* Second bank for the answers of the control channel */
+    FilterConfig.FilterBank = 1;
+    FilterConfig.FilterIdHigh = (RESP_FRAME_ID << 5);
+    if (HAL_CAN_ConfigFilter(&hcan, &FilterConfig) != HAL_OK)
+    {
+  	  Error_Handler();
+    }
 
-    TxHeader.IDE = CAN_ID_STD;
-    TxHeader.StdId = DATA_FRAME_ID;
-    TxHeader.RTR = CAN_RTR_DATA;
-    TxHeader.DLC = CHUNK_SIZE;
     HAL_CAN_Start(&hcan);
 
     if (HAL_CAN_ActivateNotification(&hcan, CAN_IT_RX_FIFO0_MSG_PENDING) != HAL_OK)
     {
         Error_Handler();
     }
-    while (!txCompleted)
+    SRV_TRANSFER_Init(&hcan, &htim1);
+    HAL_GPIO_WritePin(GPIOC, LED_YELLOW, GPIO_PIN_SET);
+
+#if BENCH_ENABLE == 1
+    if (StartBenchmark())
     {
-        HAL_GPIO_WritePin(GPIOC, LED_YELLOW, GPIO_PIN_SET);
-        isFree = HAL_CAN_GetTxMailboxesFreeLevel(&hcan); /* Check the number of free transmit mailboxes. */
+        SRV_BENCH_Begin();
+        txCompleted = SRV_TRANSFER_Send(SRV_BENCH_GetPayloadByte, BENCH_PAYLOAD_SIZE, 0);
+    }
+#elif GATEWAY_ENABLE == 1
+    SRV_GATEWAY_Init();
+    HAL_GPIO_WritePin(GPIOC, LED_YELLOW, GPIO_PIN_RESET);
+    while (1)
+    {
+        uint32_t sessionSize;
 
-        if (FrameCount <= (APPLICATION_SIZE / 8))
-        {
-            /* Check if there are free transmit mailboxes and the transmission flag is not set. */
-            if (isFree > 0 && ACK == 1)
-            {
-                /* Copy the data to be transmitted into TxData buffer. */
-                for (uint8_t i = 0; i < 8; i++)
-                {
-                    TxData[i] = dataToWrite[i + FrameCount * CHUNK_SIZE];
-                }
-                FrameCount++;
-
-                ACK = 0;
-                while(HAL_CAN_IsTxMessagePending(&hcan, TxMailbox) == 1);
-                /* Transmit the CAN message. */
-                HAL_CAN_AddTxMessage(&hcan, &TxHeader, TxData, &TxMailbox);
-                /* Update the record count. */
-                resetTxMailbox(&hcan, 0);
-            }
-        }
-        else
-        {
-            HAL_GPIO_WritePin(GPIOC, LED_YELLOW, GPIO_PIN_RESET);
-        	HAL_GPIO_WritePin(GPIOC, LED_BLUE, GPIO_PIN_SET);
-            txCompleted = 1; /*Set a flag to indicate transmission completion*/
+        /* One image per host session, forwarded while it is still arriving */
+        SRV_GATEWAY_Open();
+        HAL_GPIO_WritePin(GPIOC, LED_BLUE, GPIO_PIN_RESET);
+        HAL_GPIO_WritePin(GPIOA, LED_RED1, GPIO_PIN_RESET);
+        HAL_GPIO_WritePin(GPIOC, LED_YELLOW, GPIO_PIN_SET);
+        sessionSize = SRV_GATEWAY_GetSessionSize();
+        (void)SRV_TRANSFER_EnterUpdate();
+        txCompleted = SRV_TRANSFER_OpenImage(SRV_GATEWAY_Byte, &firstFrame) &&
+                      SRV_TRANSFER_Send(SRV_GATEWAY_Byte, sessionSize, firstFrame);
+        SRV_GATEWAY_Close(txCompleted);
+
+        HAL_GPIO_WritePin(GPIOC, LED_YELLOW, GPIO_PIN_RESET);
+        HAL_GPIO_WritePin(txCompleted ? GPIOC : GPIOA, txCompleted ? LED_BLUE : LED_RED1, GPIO_PIN_SET);
+    }
+#else
+    /* A running application resets into the receiver, then skip the frames of pages that are already programmed */
+    (void)SRV_TRANSFER_EnterUpdate();
+    txCompleted = SRV_TRANSFER_OpenTable(dataToWrite, &firstFrame) &&
+                  SRV_TRANSFER_SendTable(dataToWrite, (dataToWriteSize + CHUNK_SIZE - 1) / CHUNK_SIZE, firstFrame);
+#endif
+    txAborted = !txCompleted;
+
+    HAL_GPIO_WritePin(GPIOC, LED_YELLOW, GPIO_PIN_RESET);
+    if (txCompleted)
+    {
+        HAL_GPIO_WritePin(GPIOC, LED_BLUE, GPIO_PIN_SET);
+    }
+    else
+    {
+        HAL_GPIO_WritePin(GPIOA, LED_RED1, GPIO_PIN_SET);
+    }
 
-        }
+#if BENCH_ENABLE == 1
+    SRV_BENCH_End(txCompleted ? ((BENCH_PAYLOAD_SIZE + CHUNK_SIZE - 1) / CHUNK_SIZE) : 0);
+    if (txCompleted)
+    {
+        ReadBenchmarkResults();
+    }
+    SRV_BENCH_SendSummary(&hcan);
+    /* The LCD busy waits on TIM1, it is only used once nothing is outstanding */
+    HAL_LCD_Init();
+    for (uint8_t Page = 0; ; Page ^= 1)
+    {
+        SRV_BENCH_ShowPage(Page);
+        HAL_Delay(BENCH_DISPLAY_MS);
     }
+#endif
 }
 
 
-
 /**
   * @brief System Clock Configuration
   * @retval None
@@ -168,7 +272,14 @@ void SystemClock_Config(void)
   RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
   RCC_OscInitStruct.HSIState = RCC_HSI_ON;
   RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+#if GATEWAY_ENABLE == 1
+  /* 64MHz from HSI/2 x16 for USART1 (SRV/GATEWAY) */
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI_DIV2;
+  RCC_OscInitStruct.PLL.PLLMUL = RCC_PLL_MUL16;
+#else
   RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+#endif
   if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
   {
     Error_Handler();
@@ -177,12 +288,20 @@ void SystemClock_Config(void)
   */
   RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
                               |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
-  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
   RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
-  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
   RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+#if GATEWAY_ENABLE == 1
+  /* APB1 stays at 8MHz, the CAN bit timing does not change */
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV8;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2) != HAL_OK)
+#else
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
 
   if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_0) != HAL_OK)
+#endif
   {
     Error_Handler();
   }
@@ -203,7 +322,7 @@ static void MX_CAN_Init(void)
   hcan.Init.TimeSeg1 = CAN_BS1_2TQ;
   hcan.Init.TimeSeg2 = CAN_BS2_2TQ;
   hcan.Init.TimeTriggeredMode = DISABLE;
-  hcan.Init.AutoBusOff = DISABLE;
+  hcan.Init.AutoBusOff = ENABLE;  /* Rejoin the bus after 128x11 recessive bits without software */
   hcan.Init.AutoWakeUp = DISABLE;
   hcan.Init.AutoRetransmission = ENABLE;
   hcan.Init.ReceiveFifoLocked = DISABLE;
@@ -221,9 +340,10 @@ static void MX_TIM1_Init(void)
   TIM_ClockConfigTypeDef sClockSourceConfig = {0};
   TIM_MasterConfigTypeDef sMasterConfig = {0};
   htim1.Instance = TIM1;
-  htim1.Init.Prescaler = 72-1;
+  /* 10us tick over the full 16-bit range, the time base of SRV/RTO (see RTO_Cfg.h) */
+  htim1.Init.Prescaler = (HAL_RCC_GetPCLK2Freq() / 100000U) - 1U;
   htim1.Init.CounterMode = TIM_COUNTERMODE_UP;
-  htim1.Init.Period = 0xffff-1;
+  htim1.Init.Period = 0xffff;
   htim1.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
   htim1.Init.RepetitionCounter = 0;
   htim1.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
@@ -256,7 +376,7 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_8, GPIO_PIN_RESET);
 
   /*Configure GPIO pin Output Level */
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_11|GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15, GPIO_PIN_RESET);
 
   /*Configure GPIO pins : PC13 PC14 PC15 */
   GPIO_InitStruct.Pin = GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15;
@@ -272,8 +392,8 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
-  /*Configure GPIO pins : PB12 PB13 PB14 PB15 */
-  GPIO_InitStruct.Pin = GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15;
+  /*Configure GPIO pins : PB11 PB12 PB13 PB14 PB15 */
+  GPIO_InitStruct.Pin = GPIO_PIN_11|GPIO_PIN_12|GPIO_PIN_13|GPIO_PIN_14|GPIO_PIN_15;
   GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
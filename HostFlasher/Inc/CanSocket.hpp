@@ -0,0 +1,83 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: CanSocket.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Non-blocking raw SocketCAN socket bound to one interface.
+ *
+ * Outgoing frames are queued and written with one sendmmsg call per
+ * flush, incoming frames are read with recvmmsg. A full transmit queue
+ * (EAGAIN or ENOBUFS, the driver has no room) leaves the frames queued
+ * for the next flush instead of failing.
+ */
+#ifndef CANSOCKET_HPP_
+#define CANSOCKET_HPP_
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+#include <linux/can.h>
+
+class CanSocket
+{
+public:
+	/**
+	 * @brief Open a socket on an interface, receiving only the given identifiers.
+	 *
+	 * @param Interface Interface name, for example can0 or vcan0.
+	 * @param ReceiveIds Standard identifiers to receive.
+	 */
+	CanSocket(const std::string &Interface, const std::vector<uint32_t> &ReceiveIds);
+	~CanSocket();
+
+	CanSocket(const CanSocket &) = delete;
+	CanSocket &operator=(const CanSocket &) = delete;
+
+	/**
+	 * @brief Queue a standard data frame.
+	 *
+	 * @param Id Standard identifier.
+	 * @param Data Payload.
+	 * @param Length Payload length, at most 8.
+	 */
+	void Queue(uint32_t Id, const uint8_t *Data, uint8_t Length);
+
+	/**
+	 * @brief Write the queued frames with as few system calls as possible.
+	 *
+	 * @return bool True once the queue is empty.
+	 */
+	bool Flush();
+
+	/**
+	 * @brief Drop the queued frames that have not been written yet.
+	 */
+	void DiscardQueued() { Pending.clear(); }
+
+	/**
+	 * @brief Read the frames waiting on the socket.
+	 *
+	 * @param Frames Receives the frames, cleared first.
+	 * @return size_t Number of frames read.
+	 */
+	size_t Receive(std::vector<can_frame> &Frames);
+
+	int Fd() const { return Socket; }
+	const std::string &Name() const { return Interface; }
+	bool HasQueued() const { return !Pending.empty(); }
+
+	uint64_t FramesWritten() const { return Written; }
+	uint64_t WriteCalls() const { return Calls; }
+
+private:
+	std::string Interface;
+	int Socket;
+	std::deque<can_frame> Pending;
+	uint64_t Written;
+	uint64_t Calls;
+};
+
+#endif /* CANSOCKET_HPP_ */
@@ -0,0 +1,33 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: Delta.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Generator of the delta updates applied by the receiver's SRV/DELTA:
+ * a stream of copy and insert operations that rebuilds a new image from
+ * the base image already in the receiver's slot.
+ */
+#ifndef DELTA_HPP_
+#define DELTA_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace Delta
+{
+	/**
+	 * @brief Build the delta from Base to Target.
+	 *
+	 * @details Every position of Target is matched against the whole base,
+	 * matches shorter than a copy operation costs are inserted instead.
+	 *
+	 * @param Base Image the receiver holds.
+	 * @param Target New image.
+	 * @return std::vector<uint8_t> The delta, see DELTA.h for its layout.
+	 */
+	std::vector<uint8_t> Create(const std::vector<uint8_t> &Base, const std::vector<uint8_t> &Target);
+}
+
+#endif /* DELTA_HPP_ */
@@ -0,0 +1,64 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: Gateway.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Serial link to a Firmware_Sender built as a gateway (SRV/GATEWAY),
+ * which forwards the session to its receiver while it is still arriving.
+ *
+ * The session follows GatewayStartMagic. The gateway grants credit one
+ * GatewayCreditBlock at a time as its ring buffer drains onto the bus,
+ * nothing is written beyond it. GatewayDone or GatewayFailed ends the
+ * session once the receiver acknowledged, or did not acknowledge, the
+ * last frame.
+ *
+ * Any character device works, a PTY included, so the link is tested
+ * without hardware.
+ */
+#ifndef GATEWAY_HPP_
+#define GATEWAY_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Gateway
+{
+public:
+	/**
+	 * @brief Open a serial device in raw mode, 8N1 without flow control.
+	 *
+	 * @param Device Path of the device, for example /dev/ttyUSB0.
+	 * @param Baudrate Line speed, one of the termios rates.
+	 */
+	Gateway(const std::string &Device, uint32_t Baudrate);
+	~Gateway();
+
+	Gateway(const Gateway &) = delete;
+	Gateway &operator=(const Gateway &) = delete;
+
+	/**
+	 * @brief Send a session and wait for its outcome.
+	 *
+	 * @param Payload The image header followed by the image or its encoded stream.
+	 * @param Silence Longest time the gateway may stay silent.
+	 * @return bool True on GatewayDone, false on GatewayFailed; throws
+	 *         std::runtime_error when the gateway stays silent or the device fails.
+	 */
+	bool Send(const std::vector<uint8_t> &Payload, std::chrono::milliseconds Silence);
+
+	const std::string &Name() const { return Device; }
+	uint64_t BytesWritten() const { return Written; }
+	uint64_t Credits() const { return Granted; }
+
+private:
+	std::string Device;
+	int Fd;
+	uint64_t Written;
+	uint64_t Granted;
+};
+
+#endif /* GATEWAY_HPP_ */
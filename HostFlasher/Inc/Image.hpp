@@ -0,0 +1,71 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: Image.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Application image read from a raw binary, an Intel HEX or S-record
+ * file or an ELF32 executable. Records, parsed by the sender's own
+ * SRV/RECORD, and ELF PT_LOAD segments are placed at their load address,
+ * gaps between them are filled with 0xFF (erased flash), and the result
+ * is one contiguous block starting at the lowest address.
+ */
+#ifndef IMAGE_HPP_
+#define IMAGE_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Image
+{
+public:
+	enum class Format { Binary, IntelHex, SRecord, Elf };
+
+	/**
+	 * @brief Load an image, the format is detected from the content and the extension.
+	 *
+	 * @param Path File to read.
+	 * @param BinaryBase Load address of a raw binary, which does not carry one.
+	 * @return Image The image, throws std::runtime_error on a malformed file.
+	 */
+	static Image Load(const std::string &Path, uint32_t BinaryBase);
+
+	/**
+	 * @brief Parse an Intel HEX text.
+	 *
+	 * @param Text File content.
+	 * @return Image The image, throws std::runtime_error on a bad record or checksum.
+	 */
+	static Image FromIntelHex(const std::string &Text);
+
+	/**
+	 * @brief Parse a Motorola S-record text (S19, S28 or S37).
+	 *
+	 * @param Text File content.
+	 * @return Image The image, throws std::runtime_error on a bad record or checksum.
+	 */
+	static Image FromSRecord(const std::string &Text);
+
+	/**
+	 * @brief Parse a little endian ELF32 executable.
+	 *
+	 * @param Content File content.
+	 * @return Image The PT_LOAD segments at their physical address.
+	 */
+	static Image FromElf(const std::vector<uint8_t> &Content);
+
+	uint32_t BaseAddress() const { return Base; }
+	Format SourceFormat() const { return Source; }
+	const std::vector<uint8_t> &Bytes() const { return Data; }
+
+private:
+	Image(uint32_t BaseAddress, std::vector<uint8_t> Content, Format SourceFormat);
+
+	uint32_t Base;
+	std::vector<uint8_t> Data;
+	Format Source;
+};
+
+#endif /* IMAGE_HPP_ */
@@ -0,0 +1,29 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: Lzss.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Encoder of the compressed image format decoded by the receiver's
+ * SRV/LZSS. The window and match limits come from its LZSS_Cfg.h, so
+ * a stream always fits the window the receiver keeps in RAM.
+ */
+#ifndef LZSS_HPP_
+#define LZSS_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace Lzss
+{
+	/**
+	 * @brief Compress a block, searching the whole window for the longest match.
+	 *
+	 * @param Input Bytes to compress.
+	 * @return std::vector<uint8_t> The stream, see LZSS.h for its layout.
+	 */
+	std::vector<uint8_t> Compress(const std::vector<uint8_t> &Input);
+}
+
+#endif /* LZSS_HPP_ */
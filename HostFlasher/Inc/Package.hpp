@@ -0,0 +1,118 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: Package.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Transfer-ready form of an image: the SRV/IMAGE header, the stream sent
+ * after it (the image itself, LZSS, a delta or sparse extents) and the
+ * CRC-32 of every flash page the image covers.
+ *
+ * A package is stored in a container file for the host flasher, all
+ * fields little endian:
+ *   0      Magic "FWC1"
+ *   4      Flash page size
+ *   8      Page count
+ *   12     SRV/IMAGE header, IMAGE_HEADER_SIZE bytes
+ *   52     Stream, StreamSize bytes of the header
+ *   ...    Page count CRC-32 of the image pages, erased bytes past the end
+ *   ...    CRC-32 of all bytes before it
+ * so the session sent on the bus is the container from offset 12 on.
+ *
+ * For Firmware_Sender it is written as a C table of TxFrame_t records,
+ * one per data frame in the layout of a bxCAN transmit mailbox.
+ */
+#ifndef PACKAGE_HPP_
+#define PACKAGE_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Protocol.hpp"
+
+extern "C"
+{
+#include "SRV/IMAGE/IMAGE.h"
+}
+
+namespace Package
+{
+	constexpr uint32_t ContainerMagic = 0x31435746;    /* "FWC1" */
+	constexpr uint32_t ContainerHeaderSize = 12;
+
+	struct Options
+	{
+		uint32_t Version = 0;
+		uint32_t LoadAddress = Protocol::NewFirmwareAddress;   /* Slot the image is linked for */
+		bool Compress = false;
+		bool Sparse = false;
+		const std::vector<uint8_t> *Base = nullptr;    /* Image the receiver holds, sent as a delta to it */
+	};
+
+	struct Contents
+	{
+		SRV_IMAGE_Header_t Header;
+		std::vector<uint8_t> Stream;
+		std::vector<uint32_t> PageCrcs;
+	};
+
+	/**
+	 * @brief Pad an image with erased bytes up to the next flash page boundary.
+	 *
+	 * @param Bytes Image starting at a page boundary.
+	 * @return std::vector<uint8_t> The image covering whole pages.
+	 */
+	std::vector<uint8_t> PadToPages(std::vector<uint8_t> Bytes);
+
+	/**
+	 * @brief Build the header and stream of an image for the new firmware slot.
+	 *
+	 * @param Bytes Image to send.
+	 * @param Settings Version and encoding.
+	 * @return Contents The package, throws std::runtime_error if the image or
+	 *         its stream does not fit the slot.
+	 */
+	Contents Pack(const std::vector<uint8_t> &Bytes, const Options &Settings);
+
+	/**
+	 * @brief Bytes of the session: the header followed by the stream.
+	 */
+	std::vector<uint8_t> Payload(const Contents &Packed);
+
+	/**
+	 * @brief Serialize a package into a container.
+	 */
+	std::vector<uint8_t> Serialize(const Contents &Packed);
+
+	/**
+	 * @brief Parse a container.
+	 *
+	 * @param Content File content.
+	 * @return Contents The package, throws std::runtime_error on a malformed
+	 *         or corrupted container or a header the receivers would refuse.
+	 */
+	Contents Parse(const std::vector<uint8_t> &Content);
+
+	/**
+	 * @brief Check whether a file starts like a container.
+	 */
+	bool IsContainer(const std::string &Path);
+
+	/**
+	 * @brief Read and parse a container file.
+	 */
+	Contents Load(const std::string &Path);
+
+	/**
+	 * @brief Source of the dataToWrite table of Firmware_Sender.
+	 *
+	 * @param Packed Package to send.
+	 * @param FileName Name of the generated file, for its banner.
+	 * @return std::string C source defining dataToWrite and dataToWriteSize.
+	 */
+	std::string CTable(const Contents &Packed, const std::string &FileName);
+}
+
+#endif /* PACKAGE_HPP_ */
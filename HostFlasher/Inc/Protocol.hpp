@@ -0,0 +1,83 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: Protocol.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Frame identifiers and command codes of the update protocol, the same
+ * values as in Firmware_Receiver/Core/Inc/main.h.
+ *
+ * Data frames carry CHUNK_SIZE bytes of the image on DATA_FRAME_ID with
+ * the alternating sequence bit in the identifier LSB. Every data frame is
+ * acknowledged on ACK_FRAME_ID with [ACK_FRAME_DATA, sequence bit] before
+ * the next one is sent (stop-and-wait). The ACK of the last frame of a
+ * flash page is held back until the page is programmed, the receiver
+ * answers [ACK_FRAME_BUSY, sequence bit] meanwhile.
+ *
+ * An image session opens with CmdImageStart, its first HeaderFrames data
+ * frames carry the SRV/IMAGE header that describes the image. Before it,
+ * CmdEnterUpdate has an application with the update agent reset into the
+ * receiver (the boot mailbox of SRV/BOOTMBX), the receiver just answers.
+ *
+ * A Firmware_Sender built with GATEWAY_ENABLE takes the session over its
+ * UART instead, see SRV/GATEWAY of Firmware_Sender for the Gateway values.
+ */
+#ifndef PROTOCOL_HPP_
+#define PROTOCOL_HPP_
+
+#include <cstdint>
+
+extern "C"
+{
+#include "SRV/IMAGE/IMAGE.h"
+#include "LIB/Protocol/Protocol.h"
+}
+
+namespace Protocol
+{
+	constexpr uint32_t DataFrameId = DATA_FRAME_ID;
+	constexpr uint32_t DataFrameSeqMask = DATA_FRAME_SEQ_MASK;
+	constexpr uint32_t AckFrameId = ACK_FRAME_ID;
+	constexpr uint8_t AckFrameData = ACK_FRAME_DATA;
+	constexpr uint8_t AckFrameBusy = ACK_FRAME_BUSY;
+
+	constexpr uint32_t CmdFrameId = CMD_FRAME_ID;
+	constexpr uint32_t RespFrameId = RESP_FRAME_ID;
+	constexpr uint8_t RespPositive = RESP_POSITIVE;
+	constexpr uint8_t RespNegative = RESP_NEGATIVE;
+	constexpr uint8_t CmdResumeQuery = CMD_RESUME_QUERY;
+	constexpr uint8_t CmdImageStart = CMD_IMAGE_START;
+	constexpr uint8_t CmdEnterUpdate = CMD_ENTER_UPDATE;
+
+	constexpr uint32_t ChunkSize = CHUNK_SIZE;
+	constexpr uint32_t FlashPageSize = 1024;
+	constexpr uint32_t HeaderFrames = IMAGE_HEADER_SIZE / ChunkSize;
+
+	/* The receiver programs an image into the slot it does not run from, the image
+	 * is linked for that slot */
+	constexpr uint32_t NewFirmwareAddress = NEW_FIRMWARE_START_ADDRESS;
+	constexpr uint32_t SlotBAddress = NEW_FIRMWARE_SLOT_B_ADDRESS;
+	/* The largest image and stream */
+	constexpr uint32_t SlotSize = NEW_FIRMWARE_SLOT_SIZE;
+
+	/* SRV/GATEWAY of Firmware_Sender */
+	constexpr char GatewayStartMagic[] = "GWS1";
+	constexpr uint8_t GatewayCredit = 0x06;
+	constexpr uint8_t GatewayDone = 0x04;
+	constexpr uint8_t GatewayFailed = 0x15;
+	constexpr uint32_t GatewayCreditBlock = 256;
+	constexpr uint32_t GatewayBaudrate = 2000000;
+
+	constexpr bool IsSlot(uint32_t Address)
+	{
+		return Address == NewFirmwareAddress || Address == SlotBAddress;
+	}
+
+	constexpr uint32_t DataFrameIdSeq(uint32_t Frame)
+	{
+		return DataFrameId ^ (Frame & DataFrameSeqMask);
+	}
+}
+
+#endif /* PROTOCOL_HPP_ */
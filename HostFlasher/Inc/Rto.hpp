@@ -0,0 +1,56 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: Rto.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Retransmission timeout estimator, the algorithm of the sender's
+ * SRV/RTO (RFC 6298) in microseconds:
+ * SRTT and RTTVAR follow every unambiguous round trip, the timeout is
+ * SRTT + 4 * RTTVAR, and it doubles on every retransmission.
+ */
+#ifndef RTO_HPP_
+#define RTO_HPP_
+
+#include <cstdint>
+
+class Rto
+{
+public:
+	static constexpr uint32_t InitialUs = 20000;    /* Before the first sample */
+	static constexpr uint32_t MinUs = 1000;
+	static constexpr uint32_t MaxUs = 600000;
+	static constexpr uint32_t BusyUs = 200000;      /* Wait for the ACK of a frame the receiver is busy with */
+	static constexpr unsigned MaxRetries = 10;      /* Timeouts of one frame before giving up */
+
+	/**
+	 * @brief Feed the round trip of a frame that was sent only once (Karn's rule).
+	 *
+	 * @param RttUs Round trip in microseconds.
+	 */
+	void Sample(uint32_t RttUs);
+
+	/**
+	 * @brief Double the timeout after a retransmission.
+	 */
+	void Backoff();
+
+	uint32_t TimeoutUs() const { return Timeout; }
+	uint32_t SmoothedRttUs() const { return SmoothedRtt >> SrttShift; }
+	uint32_t Retransmissions() const { return Backoffs; }
+
+private:
+	static constexpr unsigned SrttShift = 3;
+	static constexpr unsigned RttVarShift = 2;
+
+	static uint32_t Clamp(uint64_t Us);
+
+	uint32_t SmoothedRtt = 0;       /* SRTT << 3 */
+	uint32_t RttVariation = 0;      /* RTTVAR << 2 */
+	uint32_t Timeout = InitialUs;
+	bool HasSample = false;
+	uint32_t Backoffs = 0;
+};
+
+#endif /* RTO_HPP_ */
@@ -0,0 +1,108 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: Session.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Update of one receiver, the host counterpart of the sender's
+ * SRV/TRANSFER driven by an event loop instead of busy waiting:
+ * CmdEnterUpdate, CmdImageStart, the image header in the first data frames, a resume
+ * query on the control channel, then the stop-and-wait data phase with
+ * the adaptive retransmission timeout of Rto. While the receiver answers a
+ * data frame with AckFrameBusy the timeout is Rto::BusyUs, not backed off.
+ *
+ * A target that does not answer CmdEnterUpdate or refuses it is taken
+ * as the receiver, the session goes on with CmdImageStart.
+ *
+ * The receiver decides from the header whether the image continues where
+ * an earlier session stopped. Encoded images (compressed or delta) always
+ * continue right after the header.
+ *
+ * A session never blocks. The owner feeds it the frames read from its
+ * socket and calls OnTimer once Deadline() has passed.
+ */
+#ifndef SESSION_HPP_
+#define SESSION_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include <linux/can.h>
+
+#include "CanSocket.hpp"
+#include "Rto.hpp"
+
+class Session
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	enum class State { Enter, Open, Header, Query, Data, Done, Failed };
+
+	/**
+	 * @brief Prepare the update of the receiver reachable through Socket.
+	 *
+	 * @param Socket Socket of the bus the receiver is on.
+	 * @param Payload The image header followed by the image or its encoded stream.
+	 */
+	Session(CanSocket &Socket, std::vector<uint8_t> Payload);
+
+	/**
+	 * @brief Send the first frame.
+	 *
+	 * @param Now Current time.
+	 */
+	void Start(Clock::time_point Now);
+
+	/**
+	 * @brief Handle a frame received on the socket.
+	 *
+	 * @param Frame Received frame.
+	 * @param Now Reception time.
+	 */
+	void OnFrame(const can_frame &Frame, Clock::time_point Now);
+
+	/**
+	 * @brief Handle the expiry of the retransmission timeout.
+	 *
+	 * @param Now Current time.
+	 */
+	void OnTimer(Clock::time_point Now);
+
+	Clock::time_point Deadline() const { return TimeoutAt; }
+	State GetState() const { return Phase; }
+	bool Finished() const { return Phase == State::Done || Phase == State::Failed; }
+	CanSocket &Socket() const { return Bus; }
+
+	uint32_t TotalFrames() const { return FrameTotal; }
+	uint32_t FirstFrame() const { return ResumeFrame; }
+	uint32_t FramesAcked() const { return FrameCount - ResumeFrame; }
+	uint32_t PayloadBytes() const { return (uint32_t)Payload.size(); }
+	const Rto &Timeout() const { return Estimator; }
+	Clock::time_point StartedAt() const { return Started; }
+	Clock::time_point FinishedAt() const { return Ended; }
+
+private:
+	void SendCommand(uint8_t Command, Clock::time_point Now);
+	void SendData(Clock::time_point Now);
+	void Arm(Clock::time_point Now);
+	void Finish(State Result, Clock::time_point Now);
+
+	CanSocket &Bus;
+	std::vector<uint8_t> Payload;
+	Rto Estimator;
+	State Phase;
+
+	uint32_t FrameTotal;
+	uint32_t ResumeFrame;
+	uint32_t FrameCount;        /* Index of the outstanding frame */
+	unsigned Retries;           /* Timeouts of the outstanding frame or command */
+	bool Busy;                  /* The receiver is programming the page the outstanding frame completed */
+	Clock::time_point SentAt;
+	Clock::time_point TimeoutAt;
+	Clock::time_point Started;
+	Clock::time_point Ended;
+};
+
+#endif /* SESSION_HPP_ */
@@ -0,0 +1,29 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: Sparse.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Encoder of sparse images for SRV/SPARSE of Firmware_Receiver: runs of
+ * one byte value (erased gaps, zeroed tables) become fill extents, the
+ * rest is sent as data extents.
+ */
+#ifndef SPARSE_HPP_
+#define SPARSE_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace Sparse
+{
+	/**
+	 * @brief Describe an image as an extent list.
+	 *
+	 * @param Input Image to encode.
+	 * @return std::vector<uint8_t> The extents, see SPARSE.h for their layout.
+	 */
+	std::vector<uint8_t> Encode(const std::vector<uint8_t> &Input);
+}
+
+#endif /* SPARSE_HPP_ */
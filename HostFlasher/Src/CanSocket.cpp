@@ -0,0 +1,175 @@
+/*================================================================
+ * 	File Name: CanSocket.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "CanSocket.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <net/if.h>
+#include <stdexcept>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <linux/can/raw.h>
+
+namespace
+{
+	/* Frames per sendmmsg and recvmmsg call */
+	constexpr size_t BatchSize = 32;
+
+	std::runtime_error SystemError(const std::string &What)
+	{
+		return std::runtime_error(What + ": " + std::strerror(errno));
+	}
+}
+
+CanSocket::CanSocket(const std::string &Interface, const std::vector<uint32_t> &ReceiveIds)
+	: Interface(Interface), Socket(-1), Written(0), Calls(0)
+{
+	struct ifreq Request = {};
+	struct sockaddr_can Address = {};
+	std::vector<can_filter> Filters;
+
+	if (Interface.size() >= sizeof(Request.ifr_name))
+	{
+		throw std::runtime_error("interface name too long: " + Interface);
+	}
+
+	Socket = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, CAN_RAW);
+	if (Socket < 0)
+	{
+		throw SystemError("socket");
+	}
+
+	std::strncpy(Request.ifr_name, Interface.c_str(), sizeof(Request.ifr_name) - 1);
+	if (ioctl(Socket, SIOCGIFINDEX, &Request) < 0)
+	{
+		close(Socket);
+		throw SystemError(Interface);
+	}
+
+	for (uint32_t Id : ReceiveIds)
+	{
+		Filters.push_back({Id, CAN_SFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG});
+	}
+	if (setsockopt(Socket, SOL_CAN_RAW, CAN_RAW_FILTER, Filters.data(),
+	               (socklen_t)(Filters.size() * sizeof(can_filter))) < 0)
+	{
+		close(Socket);
+		throw SystemError("CAN_RAW_FILTER");
+	}
+
+	Address.can_family = AF_CAN;
+	Address.can_ifindex = Request.ifr_ifindex;
+	if (bind(Socket, reinterpret_cast<struct sockaddr *>(&Address), sizeof(Address)) < 0)
+	{
+		close(Socket);
+		throw SystemError("bind " + Interface);
+	}
+}
+
+CanSocket::~CanSocket()
+{
+	if (Socket >= 0)
+	{
+		close(Socket);
+	}
+}
+
+void CanSocket::Queue(uint32_t Id, const uint8_t *Data, uint8_t Length)
+{
+	can_frame Frame = {};
+
+	Frame.can_id = Id & CAN_SFF_MASK;
+	Frame.can_dlc = (Length > CAN_MAX_DLEN) ? CAN_MAX_DLEN : Length;
+	std::memcpy(Frame.data, Data, Frame.can_dlc);
+	Pending.push_back(Frame);
+}
+
+bool CanSocket::Flush()
+{
+	struct mmsghdr Messages[BatchSize];
+	struct iovec Vectors[BatchSize];
+	can_frame Frames[BatchSize];
+
+	while (!Pending.empty())
+	{
+		size_t Count = std::min(Pending.size(), BatchSize);
+		int Sent;
+
+		for (size_t i = 0; i < Count; i++)
+		{
+			Frames[i] = Pending[i];
+			Vectors[i].iov_base = &Frames[i];
+			Vectors[i].iov_len = sizeof(can_frame);
+			std::memset(&Messages[i], 0, sizeof(Messages[i]));
+			Messages[i].msg_hdr.msg_iov = &Vectors[i];
+			Messages[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		Sent = sendmmsg(Socket, Messages, (unsigned)Count, MSG_DONTWAIT);
+		Calls++;
+		if (Sent < 0)
+		{
+			if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS)
+			{
+				return false;
+			}
+			throw SystemError("sendmmsg " + Interface);
+		}
+		Pending.erase(Pending.begin(), Pending.begin() + Sent);
+		Written += (uint64_t)Sent;
+		if ((size_t)Sent < Count)
+		{
+			/* The driver queue filled up part way through the batch */
+			return false;
+		}
+	}
+	return true;
+}
+
+size_t CanSocket::Receive(std::vector<can_frame> &Frames)
+{
+	struct mmsghdr Messages[BatchSize];
+	struct iovec Vectors[BatchSize];
+	can_frame Buffer[BatchSize];
+	int Count;
+
+	Frames.clear();
+	while (true)
+	{
+		for (size_t i = 0; i < BatchSize; i++)
+		{
+			Vectors[i].iov_base = &Buffer[i];
+			Vectors[i].iov_len = sizeof(can_frame);
+			std::memset(&Messages[i], 0, sizeof(Messages[i]));
+			Messages[i].msg_hdr.msg_iov = &Vectors[i];
+			Messages[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		Count = recvmmsg(Socket, Messages, BatchSize, MSG_DONTWAIT, nullptr);
+		if (Count < 0)
+		{
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+			{
+				break;
+			}
+			throw SystemError("recvmmsg " + Interface);
+		}
+		for (int i = 0; i < Count; i++)
+		{
+			if (Messages[i].msg_len == sizeof(can_frame))
+			{
+				Frames.push_back(Buffer[i]);
+			}
+		}
+		if ((size_t)Count < BatchSize)
+		{
+			break;
+		}
+	}
+	return Frames.size();
+}
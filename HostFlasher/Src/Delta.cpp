@@ -0,0 +1,120 @@
+/*================================================================
+ * 	File Name: Delta.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "Delta.hpp"
+
+#include <cstddef>
+#include <unordered_map>
+
+extern "C"
+{
+#include "SRV/DELTA/DELTA.h"
+}
+
+namespace
+{
+	/* Bytes hashed to find match candidates in the base */
+	constexpr size_t SeedLength = 4;
+	/* Candidates compared per position, bounds the work on erased runs */
+	constexpr size_t MaxCandidates = 64;
+
+	uint32_t Seed(const std::vector<uint8_t> &Data, size_t Position)
+	{
+		return (uint32_t)Data[Position] | ((uint32_t)Data[Position + 1] << 8) |
+		       ((uint32_t)Data[Position + 2] << 16) | ((uint32_t)Data[Position + 3] << 24);
+	}
+
+	void PutNumber(std::vector<uint8_t> &Out, size_t Value)
+	{
+		do
+		{
+			uint8_t Byte = (uint8_t)(Value & 0x7F);
+			Value >>= 7;
+			Out.push_back((Value != 0) ? (uint8_t)(Byte | 0x80) : Byte);
+		} while (Value != 0);
+	}
+
+	size_t NumberSize(size_t Value)
+	{
+		size_t Size = 1;
+
+		while (Value >= 0x80)
+		{
+			Value >>= 7;
+			Size++;
+		}
+		return Size;
+	}
+
+	void PutInsert(std::vector<uint8_t> &Out, const std::vector<uint8_t> &Target, size_t Start, size_t End)
+	{
+		if (End > Start)
+		{
+			Out.push_back(DELTA_OP_INSERT);
+			PutNumber(Out, End - Start);
+			Out.insert(Out.end(), Target.begin() + (long)Start, Target.begin() + (long)End);
+		}
+	}
+}
+
+std::vector<uint8_t> Delta::Create(const std::vector<uint8_t> &Base, const std::vector<uint8_t> &Target)
+{
+	std::unordered_multimap<uint32_t, size_t> Index;
+	std::vector<uint8_t> Out;
+	size_t InsertStart = 0;
+	size_t Position = 0;
+	size_t Expected = 0;    /* Base offset continuing the last copy */
+
+	for (size_t i = 0; i + SeedLength <= Base.size(); i++)
+	{
+		Index.emplace(Seed(Base, i), i);
+	}
+
+	while (Position < Target.size())
+	{
+		size_t BestLength = 0;
+		size_t BestOffset = 0;
+
+		if (Position + SeedLength <= Target.size())
+		{
+			auto Candidates = Index.equal_range(Seed(Target, Position));
+			size_t Compared = 0;
+
+			for (auto It = Candidates.first; It != Candidates.second && Compared < MaxCandidates; ++It, Compared++)
+			{
+				size_t Length = 0;
+
+				while (It->second + Length < Base.size() && Position + Length < Target.size() &&
+				       Base[It->second + Length] == Target[Position + Length])
+				{
+					Length++;
+				}
+				/* Prefer the offset that continues the previous copy on a tie */
+				if (Length > BestLength || (Length == BestLength && It->second == Expected))
+				{
+					BestLength = Length;
+					BestOffset = It->second;
+				}
+			}
+		}
+
+		/* A copy has to be cheaper than inserting the same bytes */
+		if (BestLength > 1 + NumberSize(BestLength) + NumberSize(BestOffset) + 1)
+		{
+			PutInsert(Out, Target, InsertStart, Position);
+			Out.push_back(DELTA_OP_COPY);
+			PutNumber(Out, BestLength);
+			PutNumber(Out, BestOffset);
+			Position += BestLength;
+			InsertStart = Position;
+			Expected = BestOffset + BestLength;
+		}
+		else
+		{
+			Position++;
+		}
+	}
+	PutInsert(Out, Target, InsertStart, Position);
+	return Out;
+}
@@ -0,0 +1,163 @@
+/*================================================================
+ * 	File Name: Gateway.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "Gateway.hpp"
+#include "Protocol.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdexcept>
+#include <termios.h>
+#include <unistd.h>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr size_t MagicSize = sizeof(Protocol::GatewayStartMagic) - 1;
+
+	std::runtime_error SystemError(const std::string &What)
+	{
+		return std::runtime_error(What + ": " + std::strerror(errno));
+	}
+
+	speed_t Speed(uint32_t Baudrate)
+	{
+		switch (Baudrate)
+		{
+		case 115200:
+			return B115200;
+		case 230400:
+			return B230400;
+		case 460800:
+			return B460800;
+		case 500000:
+			return B500000;
+		case 921600:
+			return B921600;
+		case 1000000:
+			return B1000000;
+		case 1500000:
+			return B1500000;
+		case 2000000:
+			return B2000000;
+		case 3000000:
+			return B3000000;
+		case 4000000:
+			return B4000000;
+		default:
+			throw std::runtime_error("unsupported baud rate " + std::to_string(Baudrate));
+		}
+	}
+}
+
+Gateway::Gateway(const std::string &Device, uint32_t Baudrate)
+	: Device(Device), Fd(-1), Written(0), Granted(0)
+{
+	speed_t Rate = Speed(Baudrate);
+	struct termios Settings;
+
+	Fd = open(Device.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+	if (Fd < 0)
+	{
+		throw SystemError(Device);
+	}
+	if (tcgetattr(Fd, &Settings) < 0)
+	{
+		close(Fd);
+		throw SystemError(Device);
+	}
+	cfmakeraw(&Settings);
+	Settings.c_cflag &= ~(tcflag_t)(CSTOPB | PARENB | CRTSCTS);
+	Settings.c_cflag |= CLOCAL | CREAD | CS8;
+	cfsetispeed(&Settings, Rate);
+	cfsetospeed(&Settings, Rate);
+	if (tcsetattr(Fd, TCSANOW, &Settings) < 0)
+	{
+		close(Fd);
+		throw SystemError(Device);
+	}
+	/* Whatever the gateway sent before is not an answer to this session */
+	tcflush(Fd, TCIOFLUSH);
+}
+
+Gateway::~Gateway()
+{
+	if (Fd >= 0)
+	{
+		close(Fd);
+	}
+}
+
+bool Gateway::Send(const std::vector<uint8_t> &Payload, std::chrono::milliseconds Silence)
+{
+	std::vector<uint8_t> Out(Protocol::GatewayStartMagic, Protocol::GatewayStartMagic + MagicSize);
+	size_t Sent = 0;
+	size_t Allowed = MagicSize;     /* The magic needs no credit */
+	Clock::time_point HeardAt = Clock::now();
+	uint8_t Answer[64];
+
+	Out.insert(Out.end(), Payload.begin(), Payload.end());
+	while (true)
+	{
+		struct pollfd Polled = {Fd, POLLIN, 0};
+		auto Left = std::chrono::duration_cast<std::chrono::milliseconds>(HeardAt + Silence - Clock::now());
+		ssize_t Count;
+
+		if (Left.count() <= 0)
+		{
+			throw std::runtime_error(Device + ": no answer from the gateway after " + std::to_string(Sent - MagicSize) +
+			                         " of " + std::to_string(Payload.size()) + " bytes");
+		}
+		if (Sent < std::min(Allowed, Out.size()))
+		{
+			Polled.events |= POLLOUT;
+		}
+		if (poll(&Polled, 1, (int)std::min<int64_t>(Left.count(), 1000)) < 0 && errno != EINTR)
+		{
+			throw SystemError("poll");
+		}
+
+		if ((Polled.revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+		{
+			Count = read(Fd, Answer, sizeof(Answer));
+			if (Count < 0 && errno != EAGAIN && errno != EINTR)
+			{
+				throw SystemError(Device);
+			}
+			for (ssize_t i = 0; i < Count; i++)
+			{
+				if (Answer[i] == Protocol::GatewayCredit)
+				{
+					Allowed += Protocol::GatewayCreditBlock;
+					Granted++;
+				}
+				else if (Answer[i] == Protocol::GatewayDone || Answer[i] == Protocol::GatewayFailed)
+				{
+					return Answer[i] == Protocol::GatewayDone;
+				}
+			}
+			if (Count > 0)
+			{
+				HeardAt = Clock::now();
+			}
+		}
+		if ((Polled.revents & POLLOUT) != 0)
+		{
+			Count = write(Fd, Out.data() + Sent, std::min(Allowed, Out.size()) - Sent);
+			if (Count < 0 && errno != EAGAIN && errno != EINTR)
+			{
+				throw SystemError(Device);
+			}
+			if (Count > 0)
+			{
+				Sent += (size_t)Count;
+				Written += (uint64_t)Count;
+			}
+		}
+	}
+}
@@ -0,0 +1,329 @@
+/*================================================================
+ * 	File Name: HostFlasher.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <poll.h>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "CanSocket.hpp"
+#include "Gateway.hpp"
+#include "Image.hpp"
+#include "Package.hpp"
+#include "Protocol.hpp"
+#include "Session.hpp"
+
+namespace
+{
+	/* Longest silence of a gateway: it says nothing while the receiver programs the last pages */
+	constexpr std::chrono::milliseconds GatewaySilence(10000);
+
+	struct Options
+	{
+		std::vector<std::string> Interfaces;
+		std::string GatewayPath;
+		uint32_t Baudrate = Protocol::GatewayBaudrate;
+		std::string ImagePath;
+		uint32_t BinaryBase = Protocol::NewFirmwareAddress;
+		uint32_t Version = 0;
+		bool Compress = false;
+		bool Sparse = false;
+		std::string BasePath;
+	};
+
+	[[noreturn]] void Usage(const char *Name)
+	{
+		std::fprintf(stderr,
+		             "usage: %s {-i IFACE [-i IFACE ...] | -u TTY [--baud N]} [--base ADDR] [--version N]\n"
+		             "       [--compress | --sparse | --delta BASE] IMAGE\n"
+		             "  -i IFACE     CAN interface of a receiver, repeat to flash several buses in parallel\n"
+		             "  -u TTY       serial port of a Firmware_Sender built as a gateway (GATEWAY_ENABLE)\n"
+		             "  --baud       baud rate of the gateway (default %u)\n"
+		             "  --base       load address of a .bin image (default 0x%08X, slot B is 0x%08X)\n"
+		             "  --version    version number written into the image header (default 0)\n"
+		             "  --compress   send the image as an LZSS stream the receivers expand while programming\n"
+		             "  --sparse     send the image as extents, runs of one byte value are generated by the receivers\n"
+		             "  --delta      send the difference to BASE, the image the receivers hold now\n"
+		             "  IMAGE        .bin, .hex, .s19 or .elf file, or a container of ImagePacker\n",
+		             Name, (unsigned)Protocol::GatewayBaudrate, (unsigned)Protocol::NewFirmwareAddress,
+		             (unsigned)Protocol::SlotBAddress);
+		std::exit(2);
+	}
+
+	Options ParseOptions(int argc, char **argv)
+	{
+		Options Parsed;
+
+		for (int i = 1; i < argc; i++)
+		{
+			std::string Arg = argv[i];
+
+			if ((Arg == "-i" || Arg == "-u" || Arg == "--baud" || Arg == "--base" || Arg == "--version" || Arg == "--delta") &&
+				i + 1 >= argc)
+			{
+				Usage(argv[0]);
+			}
+			if (Arg == "-i")
+			{
+				Parsed.Interfaces.push_back(argv[++i]);
+			}
+			else if (Arg == "-u")
+			{
+				Parsed.GatewayPath = argv[++i];
+			}
+			else if (Arg == "--baud")
+			{
+				Parsed.Baudrate = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+			}
+			else if (Arg == "--base")
+			{
+				Parsed.BinaryBase = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+			}
+			else if (Arg == "--version")
+			{
+				Parsed.Version = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+			}
+			else if (Arg == "--compress")
+			{
+				Parsed.Compress = true;
+			}
+			else if (Arg == "--sparse")
+			{
+				Parsed.Sparse = true;
+			}
+			else if (Arg == "--delta")
+			{
+				Parsed.BasePath = argv[++i];
+			}
+			else if (!Arg.empty() && Arg[0] == '-')
+			{
+				Usage(argv[0]);
+			}
+			else if (Parsed.ImagePath.empty())
+			{
+				Parsed.ImagePath = Arg;
+			}
+			else
+			{
+				Usage(argv[0]);
+			}
+		}
+		if (Parsed.Interfaces.empty() == Parsed.GatewayPath.empty() || Parsed.ImagePath.empty() ||
+			((int)Parsed.Compress + (int)Parsed.Sparse + (int)!Parsed.BasePath.empty()) > 1)
+		{
+			Usage(argv[0]);
+		}
+		return Parsed;
+	}
+
+	const char *FormatName(Image::Format Format)
+	{
+		switch (Format)
+		{
+		case Image::Format::IntelHex:
+			return "Intel HEX";
+		case Image::Format::SRecord:
+			return "S-record";
+		case Image::Format::Elf:
+			return "ELF";
+		default:
+			return "binary";
+		}
+	}
+
+	void Report(const Session &Node)
+	{
+		double Seconds = std::chrono::duration<double>(Node.FinishedAt() - Node.StartedAt()).count();
+		double Bytes = (double)Node.FramesAcked() * Protocol::ChunkSize;
+		const CanSocket &Bus = Node.Socket();
+
+		std::printf("%-8s %s: %u/%u frames from %u in %.3f s, %.0f frames/s, %.0f bytes/s, "
+		            "%u retransmissions, srtt %u us, %llu frames in %llu writes\n",
+		            Bus.Name().c_str(), (Node.GetState() == Session::State::Done) ? "done" : "FAILED",
+		            Node.FramesAcked(), Node.TotalFrames() - Node.FirstFrame(), Node.FirstFrame(), Seconds,
+		            (Seconds > 0.0) ? Node.FramesAcked() / Seconds : 0.0, (Seconds > 0.0) ? Bytes / Seconds : 0.0,
+		            Node.Timeout().Retransmissions(), Node.Timeout().SmoothedRttUs(),
+		            (unsigned long long)Bus.FramesWritten(), (unsigned long long)Bus.WriteCalls());
+	}
+}
+
+int main(int argc, char **argv)
+{
+	Options Parsed = ParseOptions(argc, argv);
+	std::vector<std::unique_ptr<CanSocket>> Sockets;
+	std::vector<std::unique_ptr<Session>> Sessions;
+	std::vector<struct pollfd> Polled;
+	std::vector<can_frame> Frames;
+	bool AllDone = true;
+
+	try
+	{
+		std::vector<uint8_t> Payload;
+		std::set<std::string> Seen;
+
+		if (Package::IsContainer(Parsed.ImagePath))
+		{
+			/* Packed by ImagePacker, sent as it is */
+			Package::Contents Packed = Package::Load(Parsed.ImagePath);
+
+			if (Parsed.Compress || Parsed.Sparse || !Parsed.BasePath.empty() || Parsed.Version != 0)
+			{
+				throw std::runtime_error(Parsed.ImagePath + " is packed already, its header cannot be changed");
+			}
+			std::printf("%s: container, %u byte image version %u in a %u byte stream\n", Parsed.ImagePath.c_str(),
+			            (unsigned)Packed.Header.Length, (unsigned)Packed.Header.Version, (unsigned)Packed.Header.StreamSize);
+			Payload = Package::Payload(Packed);
+		}
+		else
+		{
+			Image Loaded = Image::Load(Parsed.ImagePath, Parsed.BinaryBase);
+			const std::vector<uint8_t> &Bytes = Loaded.Bytes();
+			std::vector<uint8_t> Base;
+			Package::Options Settings;
+			Package::Contents Packed;
+
+			std::printf("%s: %s image, %zu bytes at 0x%08X\n", Parsed.ImagePath.c_str(), FormatName(Loaded.SourceFormat()),
+			            Bytes.size(), (unsigned)Loaded.BaseAddress());
+			if (Protocol::IsSlot(Loaded.BaseAddress()))
+			{
+				Settings.LoadAddress = Loaded.BaseAddress();
+			}
+			else
+			{
+				std::fprintf(stderr, "warning: the receivers program images at 0x%08X or 0x%08X\n",
+				             (unsigned)Protocol::NewFirmwareAddress, (unsigned)Protocol::SlotBAddress);
+			}
+			Settings.Version = Parsed.Version;
+			Settings.Compress = Parsed.Compress;
+			Settings.Sparse = Parsed.Sparse;
+			if (!Parsed.BasePath.empty())
+			{
+				Base = Image::Load(Parsed.BasePath, Parsed.BinaryBase).Bytes();
+				Settings.Base = &Base;
+			}
+			/* Encoded images cannot be resumed, they always start after the header */
+			Packed = Package::Pack(Bytes, Settings);
+			if (Parsed.Compress)
+			{
+				std::printf("compressed to %u bytes, %.1f%% of %zu\n", (unsigned)Packed.Header.StreamSize,
+				            100.0 * (double)Packed.Header.StreamSize / (double)Bytes.size(), Bytes.size());
+			}
+			else if (Parsed.Sparse)
+			{
+				std::printf("sparse extents of %u bytes, %.1f%% of %zu\n", (unsigned)Packed.Header.StreamSize,
+				            100.0 * (double)Packed.Header.StreamSize / (double)Bytes.size(), Bytes.size());
+			}
+			else if (!Parsed.BasePath.empty())
+			{
+				std::printf("delta of %u bytes against %s (crc 0x%08X), %.1f%% of %zu\n", (unsigned)Packed.Header.StreamSize,
+				            Parsed.BasePath.c_str(), (unsigned)Packed.Header.BaseCrc,
+				            100.0 * (double)Packed.Header.StreamSize / (double)Bytes.size(), Bytes.size());
+			}
+			Payload = Package::Payload(Packed);
+		}
+
+		if (!Parsed.GatewayPath.empty())
+		{
+			/* The gateway runs the CAN session, the host only keeps its ring buffer filled */
+			Gateway Link(Parsed.GatewayPath, Parsed.Baudrate);
+			Session::Clock::time_point Started = Session::Clock::now();
+			bool Done = Link.Send(Payload, GatewaySilence);
+			double Seconds = std::chrono::duration<double>(Session::Clock::now() - Started).count();
+
+			std::printf("%-8s %s: %zu bytes in %.3f s, %.0f bytes/s, %llu credits\n", Link.Name().c_str(),
+			            Done ? "done" : "FAILED", Payload.size(), Seconds, (Seconds > 0.0) ? Payload.size() / Seconds : 0.0,
+			            (unsigned long long)Link.Credits());
+			return Done ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+
+		/* Identifiers are fixed by the protocol: one receiver per bus */
+		for (const std::string &Interface : Parsed.Interfaces)
+		{
+			if (!Seen.insert(Interface).second)
+			{
+				throw std::runtime_error(Interface + " is given twice, a bus carries a single receiver");
+			}
+			Sockets.push_back(std::make_unique<CanSocket>(Interface, std::vector<uint32_t>{
+				Protocol::AckFrameId, Protocol::RespFrameId}));
+			Sessions.push_back(std::make_unique<Session>(*Sockets.back(), Payload));
+		}
+
+		for (auto &Node : Sessions)
+		{
+			Node->Start(Session::Clock::now());
+		}
+
+		while (true)
+		{
+			Session::Clock::time_point Next = Session::Clock::time_point::max();
+			bool Running = false;
+			int WaitMs;
+
+			Polled.clear();
+			for (auto &Node : Sessions)
+			{
+				CanSocket &Bus = Node->Socket();
+				short Events = POLLIN;
+
+				/* Write what the last round produced in one call per bus */
+				if (Bus.HasQueued() && !Bus.Flush())
+				{
+					Events |= POLLOUT;
+				}
+				if (!Node->Finished())
+				{
+					Running = true;
+					Next = std::min(Next, Node->Deadline());
+				}
+				Polled.push_back({Bus.Fd(), Events, 0});
+			}
+			if (!Running)
+			{
+				break;
+			}
+
+			auto Wait = std::chrono::duration_cast<std::chrono::milliseconds>(Next - Session::Clock::now());
+			WaitMs = (Wait.count() < 0) ? 0 : (int)std::min<int64_t>(Wait.count() + 1, 1000);
+			if (poll(Polled.data(), Polled.size(), WaitMs) < 0 && errno != EINTR)
+			{
+				throw std::runtime_error(std::string("poll: ") + std::strerror(errno));
+			}
+
+			for (size_t i = 0; i < Sessions.size(); i++)
+			{
+				Session &Node = *Sessions[i];
+				Session::Clock::time_point Now;
+
+				if ((Polled[i].revents & POLLIN) != 0 && Node.Socket().Receive(Frames) > 0)
+				{
+					Now = Session::Clock::now();
+					for (const can_frame &Frame : Frames)
+					{
+						Node.OnFrame(Frame, Now);
+					}
+				}
+				Node.OnTimer(Session::Clock::now());
+			}
+		}
+	}
+	catch (const std::exception &Error)
+	{
+		std::fprintf(stderr, "error: %s\n", Error.what());
+		return EXIT_FAILURE;
+	}
+
+	for (auto &Node : Sessions)
+	{
+		Report(*Node);
+		AllDone = AllDone && (Node->GetState() == Session::State::Done);
+	}
+	return AllDone ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,209 @@
+/*================================================================
+ * 	File Name: Image.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "Image.hpp"
+
+#include <cstring>
+#include <elf.h>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+
+extern "C"
+{
+#include "SRV/RECORD/RECORD.h"
+}
+
+namespace
+{
+	/* Largest span between the lowest and the highest loaded byte */
+	constexpr uint32_t MaxImageSpan = 16UL * 1024UL * 1024UL;
+
+	using Chunks = std::map<uint32_t, std::vector<uint8_t>>;
+
+	std::vector<uint8_t> ReadFile(const std::string &Path)
+	{
+		std::ifstream File(Path, std::ios::binary);
+
+		if (!File)
+		{
+			throw std::runtime_error("cannot open " + Path);
+		}
+		return std::vector<uint8_t>(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+	}
+
+	bool EndsWith(const std::string &Text, const std::string &Suffix)
+	{
+		return Text.size() >= Suffix.size() &&
+		       Text.compare(Text.size() - Suffix.size(), Suffix.size(), Suffix) == 0;
+	}
+
+	/* Lay the chunks out from the lowest address, gaps stay erased */
+	std::vector<uint8_t> Flatten(const Chunks &Parts, uint32_t &Base)
+	{
+		uint64_t End = 0;
+		std::vector<uint8_t> Data;
+
+		if (Parts.empty())
+		{
+			throw std::runtime_error("the file carries no data");
+		}
+		Base = Parts.begin()->first;
+		for (const auto &Part : Parts)
+		{
+			End = std::max<uint64_t>(End, (uint64_t)Part.first + Part.second.size());
+		}
+		if (End - Base > MaxImageSpan)
+		{
+			throw std::runtime_error("the loaded addresses span more than 16MB");
+		}
+		Data.assign((size_t)(End - Base), 0xFF);
+		for (const auto &Part : Parts)
+		{
+			std::memcpy(&Data[Part.first - Base], Part.second.data(), Part.second.size());
+		}
+		return Data;
+	}
+
+	/* Extents of the file being parsed, SRV/RECORD has no context for its callback */
+	Chunks *Target = nullptr;
+
+	void AddExtent(uint32_t Address, const uint8_t *Data, uint32_t Length)
+	{
+		auto Next = Target->upper_bound(Address);
+		auto Previous = (Next == Target->begin()) ? Target->end() : std::prev(Next);
+
+		if (Previous != Target->end() && Previous->first + Previous->second.size() == Address)
+		{
+			/* Records usually follow each other, extend the current chunk */
+			Previous->second.insert(Previous->second.end(), Data, Data + Length);
+		}
+		else
+		{
+			(*Target)[Address].assign(Data, Data + Length);
+		}
+	}
+
+	Chunks ParseRecords(const std::string &Text, uint8_t Format)
+	{
+		const char *Name = (Format == RECORD_FORMAT_HEX) ? "hex" : "srec";
+		Chunks Parts;
+		uint8_t Status;
+
+		Target = &Parts;
+		SRV_RECORD_Init(AddExtent);
+		Status = SRV_RECORD_Feed((const uint8_t *)Text.data(), (uint32_t)Text.size());
+		if (Status == RECORD_OK)
+		{
+			Status = SRV_RECORD_Finish();
+		}
+		Target = nullptr;
+		if (Status == RECORD_END && SRV_RECORD_GetFormat() != Format)
+		{
+			Status = RECORD_BAD_CHAR;
+		}
+
+		switch (Status)
+		{
+		case RECORD_END:
+			return Parts;
+		case RECORD_BAD_LENGTH:
+			throw std::runtime_error(std::string(Name) + " line " + std::to_string(SRV_RECORD_GetLine()) + ": bad length");
+		case RECORD_BAD_CHECKSUM:
+			throw std::runtime_error(std::string(Name) + " line " + std::to_string(SRV_RECORD_GetLine()) + ": bad checksum");
+		case RECORD_BAD_TYPE:
+			throw std::runtime_error(std::string(Name) + " line " + std::to_string(SRV_RECORD_GetLine()) +
+			                         ": unknown record type");
+		default:
+			throw std::runtime_error(std::string(Name) + " line " + std::to_string(SRV_RECORD_GetLine()) + ": not a record");
+		}
+	}
+}
+
+Image::Image(uint32_t BaseAddress, std::vector<uint8_t> Content, Format SourceFormat)
+	: Base(BaseAddress), Data(std::move(Content)), Source(SourceFormat)
+{
+}
+
+Image Image::Load(const std::string &Path, uint32_t BinaryBase)
+{
+	std::vector<uint8_t> Content = ReadFile(Path);
+
+	if (Content.size() >= SELFMAG && std::memcmp(Content.data(), ELFMAG, SELFMAG) == 0)
+	{
+		return FromElf(Content);
+	}
+	if (EndsWith(Path, ".hex") || EndsWith(Path, ".ihex") || (!Content.empty() && Content[0] == ':'))
+	{
+		return FromIntelHex(std::string(Content.begin(), Content.end()));
+	}
+	if (EndsWith(Path, ".srec") || EndsWith(Path, ".s19") || EndsWith(Path, ".s28") || EndsWith(Path, ".s37") ||
+		(Content.size() >= 2 && Content[0] == 'S' && Content[1] >= '0' && Content[1] <= '9'))
+	{
+		return FromSRecord(std::string(Content.begin(), Content.end()));
+	}
+	if (Content.empty())
+	{
+		throw std::runtime_error(Path + " is empty");
+	}
+	return Image(BinaryBase, std::move(Content), Format::Binary);
+}
+
+Image Image::FromIntelHex(const std::string &Text)
+{
+	uint32_t Base = 0;
+	std::vector<uint8_t> Data = Flatten(ParseRecords(Text, RECORD_FORMAT_HEX), Base);
+	return Image(Base, std::move(Data), Format::IntelHex);
+}
+
+Image Image::FromSRecord(const std::string &Text)
+{
+	uint32_t Base = 0;
+	std::vector<uint8_t> Data = Flatten(ParseRecords(Text, RECORD_FORMAT_SREC), Base);
+	return Image(Base, std::move(Data), Format::SRecord);
+}
+
+Image Image::FromElf(const std::vector<uint8_t> &Content)
+{
+	Elf32_Ehdr Header;
+	Chunks Parts;
+
+	if (Content.size() < sizeof(Header))
+	{
+		throw std::runtime_error("truncated ELF header");
+	}
+	std::memcpy(&Header, Content.data(), sizeof(Header));
+	if (Header.e_ident[EI_CLASS] != ELFCLASS32 || Header.e_ident[EI_DATA] != ELFDATA2LSB)
+	{
+		throw std::runtime_error("only little endian ELF32 files are supported");
+	}
+	if (Header.e_phentsize != sizeof(Elf32_Phdr) ||
+		(uint64_t)Header.e_phoff + (uint64_t)Header.e_phnum * sizeof(Elf32_Phdr) > Content.size())
+	{
+		throw std::runtime_error("bad ELF program header table");
+	}
+
+	for (unsigned i = 0; i < Header.e_phnum; i++)
+	{
+		Elf32_Phdr Segment;
+
+		std::memcpy(&Segment, &Content[Header.e_phoff + i * sizeof(Elf32_Phdr)], sizeof(Segment));
+		if (Segment.p_type != PT_LOAD || Segment.p_filesz == 0)
+		{
+			continue;
+		}
+		if ((uint64_t)Segment.p_offset + Segment.p_filesz > Content.size())
+		{
+			throw std::runtime_error("ELF segment past the end of the file");
+		}
+		/* The load address: initialised data is copied out of flash by the startup code */
+		Parts[Segment.p_paddr].assign(Content.begin() + Segment.p_offset,
+		                              Content.begin() + Segment.p_offset + Segment.p_filesz);
+	}
+
+	uint32_t Base = 0;
+	std::vector<uint8_t> Data = Flatten(Parts, Base);
+	return Image(Base, std::move(Data), Format::Elf);
+}
@@ -0,0 +1,193 @@
+/*================================================================
+ * 	File Name: ImagePacker.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Image.hpp"
+#include "Package.hpp"
+#include "Protocol.hpp"
+
+namespace
+{
+	struct Options
+	{
+		std::string ImagePath;
+		std::string ContainerPath;
+		std::string TablePath;
+		std::string BasePath;
+		uint32_t BinaryBase = Protocol::NewFirmwareAddress;
+		Package::Options Settings;
+	};
+
+	[[noreturn]] void Usage(const char *Name)
+	{
+		std::fprintf(stderr,
+		             "usage: %s [--base ADDR] [--version N] [--compress | --sparse | --delta BASE] [-o CONTAINER] [-c TABLE] IMAGE\n"
+		             "  --base       load address of a .bin image (default 0x%08X, slot B is 0x%08X)\n"
+		             "  --version    version number written into the image header (default 0)\n"
+		             "  --compress   pack the image as an LZSS stream\n"
+		             "  --sparse     pack the image as extents, runs of one byte value are not sent\n"
+		             "  --delta      pack the difference to BASE, the image the receivers hold now\n"
+		             "  -o           container file for HostFlasher\n"
+		             "  -c           C table replacing Firmware_Sender/Core/Src/Application-HEX.c\n"
+		             "  IMAGE        .elf, .hex, .s19 or .bin file of the new firmware\n",
+		             Name, (unsigned)Protocol::NewFirmwareAddress, (unsigned)Protocol::SlotBAddress);
+		std::exit(2);
+	}
+
+	Options ParseOptions(int argc, char **argv)
+	{
+		Options Parsed;
+
+		for (int i = 1; i < argc; i++)
+		{
+			std::string Arg = argv[i];
+
+			if ((Arg == "--base" || Arg == "--version" || Arg == "--delta" || Arg == "-o" || Arg == "-c") && i + 1 >= argc)
+			{
+				Usage(argv[0]);
+			}
+			if (Arg == "--base")
+			{
+				Parsed.BinaryBase = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+			}
+			else if (Arg == "--version")
+			{
+				Parsed.Settings.Version = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+			}
+			else if (Arg == "--compress")
+			{
+				Parsed.Settings.Compress = true;
+			}
+			else if (Arg == "--sparse")
+			{
+				Parsed.Settings.Sparse = true;
+			}
+			else if (Arg == "--delta")
+			{
+				Parsed.BasePath = argv[++i];
+			}
+			else if (Arg == "-o")
+			{
+				Parsed.ContainerPath = argv[++i];
+			}
+			else if (Arg == "-c")
+			{
+				Parsed.TablePath = argv[++i];
+			}
+			else if (!Arg.empty() && Arg[0] == '-')
+			{
+				Usage(argv[0]);
+			}
+			else if (Parsed.ImagePath.empty())
+			{
+				Parsed.ImagePath = Arg;
+			}
+			else
+			{
+				Usage(argv[0]);
+			}
+		}
+		if (Parsed.ImagePath.empty() ||
+			((int)Parsed.Settings.Compress + (int)Parsed.Settings.Sparse + (int)!Parsed.BasePath.empty()) > 1)
+		{
+			Usage(argv[0]);
+		}
+		return Parsed;
+	}
+
+	/* The image as a slot holds it: at the address of slot A or B and covering whole pages */
+	std::vector<uint8_t> LoadForSlot(const std::string &Path, uint32_t BinaryBase, uint32_t &SlotAddress)
+	{
+		Image Loaded = Image::Load(Path, BinaryBase);
+
+		if (!Protocol::IsSlot(Loaded.BaseAddress()))
+		{
+			char Text[128];
+
+			std::snprintf(Text, sizeof(Text), "%s is linked at 0x%08X, the receivers program 0x%08X or 0x%08X",
+			              Path.c_str(), (unsigned)Loaded.BaseAddress(), (unsigned)Protocol::NewFirmwareAddress,
+			              (unsigned)Protocol::SlotBAddress);
+			throw std::runtime_error(Text);
+		}
+		SlotAddress = Loaded.BaseAddress();
+		return Package::PadToPages(Loaded.Bytes());
+	}
+
+	void WriteFile(const std::string &Path, const void *Data, size_t Size)
+	{
+		std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+
+		if (!File.write((const char *)Data, (std::streamsize)Size))
+		{
+			throw std::runtime_error("cannot write " + Path);
+		}
+	}
+
+	std::string BaseName(const std::string &Path)
+	{
+		size_t Slash = Path.find_last_of('/');
+
+		return (Slash == std::string::npos) ? Path : Path.substr(Slash + 1);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	Options Parsed = ParseOptions(argc, argv);
+
+	try
+	{
+		std::vector<uint8_t> Bytes = LoadForSlot(Parsed.ImagePath, Parsed.BinaryBase, Parsed.Settings.LoadAddress);
+		std::vector<uint8_t> Base;
+		uint32_t BaseAddress;
+		Package::Contents Packed;
+
+		if (!Parsed.BasePath.empty())
+		{
+			/* The base runs from the other slot, a .bin base is taken at the same address */
+			Base = LoadForSlot(Parsed.BasePath, Parsed.BinaryBase, BaseAddress);
+			Parsed.Settings.Base = &Base;
+		}
+		Packed = Package::Pack(Bytes, Parsed.Settings);
+
+		std::printf("%s: %zu pages at 0x%08X, version %u, crc 0x%08X\n", Parsed.ImagePath.c_str(),
+		            Packed.PageCrcs.size(), (unsigned)Packed.Header.LoadAddress, (unsigned)Packed.Header.Version,
+		            (unsigned)Packed.Header.ImageCrc);
+		for (size_t i = 0; i < Packed.PageCrcs.size(); i++)
+		{
+			std::printf("  page %2zu 0x%08X crc 0x%08X\n", i,
+			            (unsigned)(Packed.Header.LoadAddress + i * Protocol::FlashPageSize), (unsigned)Packed.PageCrcs[i]);
+		}
+		std::printf("stream of %u bytes, %.1f%% of %u, %u data frames\n", (unsigned)Packed.Header.StreamSize,
+		            100.0 * Packed.Header.StreamSize / Packed.Header.Length, (unsigned)Packed.Header.Length,
+		            (unsigned)((IMAGE_HEADER_SIZE + Packed.Header.StreamSize + Protocol::ChunkSize - 1) / Protocol::ChunkSize));
+
+		if (!Parsed.ContainerPath.empty())
+		{
+			std::vector<uint8_t> Container = Package::Serialize(Packed);
+
+			WriteFile(Parsed.ContainerPath, Container.data(), Container.size());
+			std::printf("wrote %s, %zu bytes\n", Parsed.ContainerPath.c_str(), Container.size());
+		}
+		if (!Parsed.TablePath.empty())
+		{
+			std::string Table = Package::CTable(Packed, BaseName(Parsed.TablePath));
+
+			WriteFile(Parsed.TablePath, Table.data(), Table.size());
+			std::printf("wrote %s\n", Parsed.TablePath.c_str());
+		}
+	}
+	catch (const std::exception &Error)
+	{
+		std::fprintf(stderr, "error: %s\n", Error.what());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/*================================================================
+ * 	File Name: Lzss.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "Lzss.hpp"
+
+#include <algorithm>
+
+#include "SRV/LZSS/LZSS_Cfg.h"
+
+namespace
+{
+	constexpr size_t WindowSize = size_t(1) << LZSS_OFFSET_BITS;
+	constexpr size_t MinMatch = LZSS_MIN_MATCH;
+	constexpr size_t MaxMatch = LZSS_MIN_MATCH + (size_t(1) << (16 - LZSS_OFFSET_BITS)) - 1;
+
+	struct Match
+	{
+		size_t Length = 0;
+		size_t Distance = 0;
+	};
+
+	/* Longest match of the bytes at Position inside the window, overlapping copies included */
+	Match LongestMatch(const std::vector<uint8_t> &Input, size_t Position)
+	{
+		Match Best;
+		size_t Limit = std::min(MaxMatch, Input.size() - Position);
+
+		for (size_t Distance = 1; Distance <= std::min(WindowSize, Position); Distance++)
+		{
+			size_t Length = 0;
+
+			while (Length < Limit && Input[Position - Distance + Length] == Input[Position + Length])
+			{
+				Length++;
+			}
+			if (Length > Best.Length)
+			{
+				Best.Length = Length;
+				Best.Distance = Distance;
+				if (Length == Limit)
+				{
+					break;
+				}
+			}
+		}
+		return Best;
+	}
+}
+
+std::vector<uint8_t> Lzss::Compress(const std::vector<uint8_t> &Input)
+{
+	std::vector<uint8_t> Output;
+	size_t FlagsAt = 0;
+	unsigned Items = 8;
+	size_t Position = 0;
+
+	while (Position < Input.size())
+	{
+		Match Current = LongestMatch(Input, Position);
+
+		/* Lazy matching: a literal is cheaper if the next position matches longer */
+		if (Current.Length >= MinMatch && Position + 1 < Input.size() &&
+			LongestMatch(Input, Position + 1).Length > Current.Length)
+		{
+			Current.Length = 0;
+		}
+
+		if (Items == 8)
+		{
+			FlagsAt = Output.size();
+			Output.push_back(0);
+			Items = 0;
+		}
+
+		if (Current.Length >= MinMatch)
+		{
+			uint16_t Reference = (uint16_t)(((Current.Length - MinMatch) << LZSS_OFFSET_BITS) | (Current.Distance - 1));
+
+			Output.push_back((uint8_t)Reference);
+			Output.push_back((uint8_t)(Reference >> 8));
+			Position += Current.Length;
+		}
+		else
+		{
+			Output[FlagsAt] |= (uint8_t)(1U << Items);
+			Output.push_back(Input[Position]);
+			Position++;
+		}
+		Items++;
+	}
+	return Output;
+}
@@ -0,0 +1,275 @@
+/*================================================================
+ * 	File Name: Package.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "Package.hpp"
+#include "Delta.hpp"
+#include "Lzss.hpp"
+#include "Protocol.hpp"
+#include "Sparse.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+extern "C"
+{
+#include "SRV/CRC/CRC.h"
+}
+
+namespace
+{
+	/* TIR of a bxCAN transmit mailbox: standard identifier and transmit request */
+	constexpr unsigned MailboxStidPos = 21;
+	constexpr uint32_t MailboxTxrq = 0x00000001;
+
+	void PutWord(std::vector<uint8_t> &Out, uint32_t Value)
+	{
+		for (unsigned i = 0; i < 4; i++)
+		{
+			Out.push_back((uint8_t)(Value >> (8 * i)));
+		}
+	}
+
+	uint32_t GetWord(const std::vector<uint8_t> &In, size_t Offset)
+	{
+		return (uint32_t)In[Offset] | ((uint32_t)In[Offset + 1] << 8) |
+		       ((uint32_t)In[Offset + 2] << 16) | ((uint32_t)In[Offset + 3] << 24);
+	}
+
+	/* CRC-32 of every page as programmed, the tail of the last one stays erased */
+	std::vector<uint32_t> PageCrcs(const std::vector<uint8_t> &Bytes)
+	{
+		std::vector<uint32_t> Crcs;
+
+		for (size_t Offset = 0; Offset < Bytes.size(); Offset += Protocol::FlashPageSize)
+		{
+			std::vector<uint8_t> Page(Protocol::FlashPageSize, 0xFF);
+
+			std::copy(Bytes.begin() + (long)Offset,
+			          Bytes.begin() + (long)std::min<size_t>(Bytes.size(), Offset + Protocol::FlashPageSize), Page.begin());
+			Crcs.push_back(SRV_CRC_Update(CRC_INITIAL, Page.data(), (uint32_t)Page.size()));
+		}
+		return Crcs;
+	}
+
+	/* One line per data frame from Start to End, TIR, TDTR, TDLR and TDHR; the last frame of the table has no comma */
+	void PutFrames(std::string &Text, const std::vector<uint8_t> &Bytes, size_t Start, size_t End, bool Last)
+	{
+		char Line[80];
+
+		for (size_t Offset = Start; Offset < End; Offset += Protocol::ChunkSize)
+		{
+			uint32_t Frame = (uint32_t)(Offset / Protocol::ChunkSize);
+
+			std::snprintf(Line, sizeof(Line), "    {0x%08x, 0x%08x, 0x%08x, 0x%08x}%s\n",
+			              (unsigned)((Protocol::DataFrameIdSeq(Frame) << MailboxStidPos) | MailboxTxrq),
+			              (unsigned)Protocol::ChunkSize, (unsigned)GetWord(Bytes, Offset), (unsigned)GetWord(Bytes, Offset + 4),
+			              (Last && Offset + Protocol::ChunkSize >= End) ? "" : ",");
+			Text += Line;
+		}
+	}
+
+	std::string Describe(const SRV_IMAGE_Header_t &Header)
+	{
+		char Text[160];
+
+		if ((Header.Flags & IMAGE_FLAG_LZSS) != 0U)
+		{
+			std::snprintf(Text, sizeof(Text), "LZSS stream of %u bytes expanding to an image of %u bytes",
+			              (unsigned)Header.StreamSize, (unsigned)Header.Length);
+		}
+		else if ((Header.Flags & IMAGE_FLAG_DELTA) != 0U)
+		{
+			std::snprintf(Text, sizeof(Text), "delta of %u bytes to an image of %u bytes, base of %u bytes crc 0x%08x",
+			              (unsigned)Header.StreamSize, (unsigned)Header.Length, (unsigned)Header.BaseLength,
+			              (unsigned)Header.BaseCrc);
+		}
+		else if ((Header.Flags & IMAGE_FLAG_SPARSE) != 0U)
+		{
+			std::snprintf(Text, sizeof(Text), "sparse image of %u bytes in %u bytes of extents",
+			              (unsigned)Header.Length, (unsigned)Header.StreamSize);
+		}
+		else
+		{
+			std::snprintf(Text, sizeof(Text), "plain image of %u bytes", (unsigned)Header.Length);
+		}
+		return Text;
+	}
+}
+
+std::vector<uint8_t> Package::PadToPages(std::vector<uint8_t> Bytes)
+{
+	size_t Pages = (Bytes.size() + Protocol::FlashPageSize - 1) / Protocol::FlashPageSize;
+
+	Bytes.resize(Pages * Protocol::FlashPageSize, 0xFF);
+	return Bytes;
+}
+
+Package::Contents Package::Pack(const std::vector<uint8_t> &Bytes, const Options &Settings)
+{
+	Contents Packed;
+
+	if (Bytes.empty() || Bytes.size() > Protocol::SlotSize)
+	{
+		throw std::runtime_error("the image takes " + std::to_string(Bytes.size()) +
+		                         " bytes, the receivers have " + std::to_string(Protocol::SlotSize));
+	}
+	Packed.Header = {};
+	Packed.Header.Length = (uint32_t)Bytes.size();
+	Packed.Header.LoadAddress = Settings.LoadAddress;
+	Packed.Header.Version = Settings.Version;
+	Packed.Header.ImageCrc = SRV_CRC_Update(CRC_INITIAL, Bytes.data(), (uint32_t)Bytes.size());
+	Packed.PageCrcs = PageCrcs(Bytes);
+
+	if (Settings.Compress)
+	{
+		Packed.Stream = Lzss::Compress(Bytes);
+		Packed.Header.Flags = IMAGE_FLAG_LZSS;
+	}
+	else if (Settings.Sparse)
+	{
+		Packed.Stream = Sparse::Encode(Bytes);
+		Packed.Header.Flags = IMAGE_FLAG_SPARSE;
+	}
+	else if (Settings.Base != nullptr)
+	{
+		if (Settings.Base->empty() || Settings.Base->size() > Protocol::SlotSize)
+		{
+			throw std::runtime_error("the base image does not fit the slot");
+		}
+		Packed.Stream = Delta::Create(*Settings.Base, Bytes);
+		Packed.Header.Flags = IMAGE_FLAG_DELTA;
+		Packed.Header.BaseLength = (uint32_t)Settings.Base->size();
+		Packed.Header.BaseCrc = SRV_CRC_Update(CRC_INITIAL, Settings.Base->data(), Packed.Header.BaseLength);
+	}
+	else
+	{
+		Packed.Stream = Bytes;
+	}
+	if (Packed.Stream.size() > Protocol::SlotSize)
+	{
+		throw std::runtime_error("the stream takes " + std::to_string(Packed.Stream.size()) +
+		                         " bytes, the receivers have " + std::to_string(Protocol::SlotSize));
+	}
+	Packed.Header.StreamSize = (uint32_t)Packed.Stream.size();
+	return Packed;
+}
+
+std::vector<uint8_t> Package::Payload(const Contents &Packed)
+{
+	std::vector<uint8_t> Out(IMAGE_HEADER_SIZE);
+	SRV_IMAGE_Header_t Header = Packed.Header;
+
+	SRV_IMAGE_Build(&Header, Out.data());
+	Out.insert(Out.end(), Packed.Stream.begin(), Packed.Stream.end());
+	return Out;
+}
+
+std::vector<uint8_t> Package::Serialize(const Contents &Packed)
+{
+	std::vector<uint8_t> Out;
+	std::vector<uint8_t> Session = Payload(Packed);
+
+	PutWord(Out, ContainerMagic);
+	PutWord(Out, Protocol::FlashPageSize);
+	PutWord(Out, (uint32_t)Packed.PageCrcs.size());
+	Out.insert(Out.end(), Session.begin(), Session.end());
+	for (uint32_t Crc : Packed.PageCrcs)
+	{
+		PutWord(Out, Crc);
+	}
+	PutWord(Out, SRV_CRC_Update(CRC_INITIAL, Out.data(), (uint32_t)Out.size()));
+	return Out;
+}
+
+Package::Contents Package::Parse(const std::vector<uint8_t> &Content)
+{
+	Contents Packed;
+	size_t Offset = ContainerHeaderSize + IMAGE_HEADER_SIZE;
+	uint32_t Pages;
+
+	if (Content.size() < Offset + 4U || GetWord(Content, 0) != ContainerMagic)
+	{
+		throw std::runtime_error("not an image container");
+	}
+	if (SRV_CRC_Update(CRC_INITIAL, Content.data(), (uint32_t)Content.size() - 4U) != GetWord(Content, Content.size() - 4U))
+	{
+		throw std::runtime_error("the container is corrupted");
+	}
+	if (GetWord(Content, 4) != Protocol::FlashPageSize)
+	{
+		throw std::runtime_error("the container was packed for " + std::to_string(GetWord(Content, 4)) + " byte pages");
+	}
+	if (SRV_IMAGE_Parse(&Content[ContainerHeaderSize], Protocol::NewFirmwareAddress, Protocol::SlotSize,
+	                    &Packed.Header) != IMAGE_OK &&
+		SRV_IMAGE_Parse(&Content[ContainerHeaderSize], Protocol::SlotBAddress, Protocol::SlotSize,
+	                    &Packed.Header) != IMAGE_OK)
+	{
+		throw std::runtime_error("the receivers refuse the image header of the container");
+	}
+	Pages = GetWord(Content, 8);
+	if (Pages != (Packed.Header.Length + Protocol::FlashPageSize - 1) / Protocol::FlashPageSize ||
+		Content.size() != Offset + Packed.Header.StreamSize + 4U * (size_t)Pages + 4U)
+	{
+		throw std::runtime_error("the container size does not match its header");
+	}
+	Packed.Stream.assign(Content.begin() + (long)Offset, Content.begin() + (long)(Offset + Packed.Header.StreamSize));
+	Offset += Packed.Header.StreamSize;
+	for (uint32_t i = 0; i < Pages; i++, Offset += 4)
+	{
+		Packed.PageCrcs.push_back(GetWord(Content, Offset));
+	}
+	return Packed;
+}
+
+bool Package::IsContainer(const std::string &Path)
+{
+	std::ifstream File(Path, std::ios::binary);
+	std::vector<uint8_t> Magic(4);
+
+	return File.read((char *)Magic.data(), (std::streamsize)Magic.size()) && GetWord(Magic, 0) == ContainerMagic;
+}
+
+Package::Contents Package::Load(const std::string &Path)
+{
+	std::ifstream File(Path, std::ios::binary);
+
+	if (!File)
+	{
+		throw std::runtime_error("cannot open " + Path);
+	}
+	return Parse(std::vector<uint8_t>(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>()));
+}
+
+std::string Package::CTable(const Contents &Packed, const std::string &FileName)
+{
+	std::vector<uint8_t> Session = Payload(Packed);
+	size_t Size = Session.size();
+	std::string Text;
+
+	/* Whole data frames, the padding is what the sender would fill in */
+	Session.resize((Size + Protocol::ChunkSize - 1) / Protocol::ChunkSize * Protocol::ChunkSize, 0xFF);
+
+	Text += "/*================================================================\n"
+	        " *\tProject Name: CANtx\n"
+	        " * \tFile Name: " + FileName + "\n"
+	        " *================================================================\n"
+	        " * Generated by HostFlasher/ImagePacker, do not edit.\n"
+	        " *\n"
+	        " * One record per data frame, the words stored into a bxCAN transmit\n"
+	        " * mailbox: TIR with the sequence bit and TXRQ, TDTR, TDLR and TDHR.\n"
+	        " */\n"
+	        "#include \"main.h\"\n"
+	        "\n"
+	        "const TxFrame_t dataToWrite[] = {\n";
+	Text += "    /* Image header: " + Describe(Packed.Header) + " for the new firmware slot, version " +
+	        std::to_string(Packed.Header.Version) + " */\n";
+	PutFrames(Text, Session, 0, IMAGE_HEADER_SIZE, false);
+	Text += "\n    /* Image */\n";
+	PutFrames(Text, Session, IMAGE_HEADER_SIZE, Session.size(), true);
+	Text += "};\nconst uint32_t dataToWriteSize = " + std::to_string(Size) + "U;\n";
+	return Text;
+}
@@ -0,0 +1,342 @@
+/*================================================================
+ * 	File Name: ReceiverEmu.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+/*
+ * Stand-in for Firmware_Receiver on a virtual CAN bus, to test the flasher
+ * without hardware. It follows SRV/UPDATER: duplicates are acknowledged but
+ * not stored, the ACK of the last frame of a page is held back for the
+ * programming time of the page, and other data frames are ignored
+ * meanwhile; that frame and its retransmissions are answered AckFrameBusy.
+ * The image header is checked with the receiver's own SRV/IMAGE, encoded
+ * images are decoded with SRV/LZSS, SRV/DELTA and SRV/SPARSE. --initial
+ * puts a running image into slot A, the session then programs slot B and a
+ * delta applies to slot A; without it either slot is taken, as on a fresh
+ * receiver. Nothing is journaled, every session starts right after the header.
+ */
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <poll.h>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "CanSocket.hpp"
+#include "Protocol.hpp"
+
+extern "C"
+{
+#include "SRV/CRC/CRC.h"
+#include "SRV/DELTA/DELTA.h"
+#include "SRV/IMAGE/IMAGE.h"
+#include "SRV/LZSS/LZSS.h"
+#include "SRV/SPARSE/SPARSE.h"
+}
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct Options
+	{
+		std::string Interface;
+		std::string OutPath;
+		std::string InitialPath;    /* Slot A content before the session, the running image */
+		uint32_t PageMs = 25;       /* Erase and program time of one page */
+		uint32_t DropPpm = 0;       /* Data frames lost before reaching the receiver */
+		uint32_t TimeoutS = 60;
+	};
+
+	[[noreturn]] void Usage(const char *Name)
+	{
+		std::fprintf(stderr,
+		             "usage: %s -i IFACE -o OUT [--initial FILE] [--page-ms MS] [--drop PPM] [--timeout S]\n", Name);
+		std::exit(2);
+	}
+
+	Options ParseOptions(int argc, char **argv)
+	{
+		Options Parsed;
+
+		for (int i = 1; i < argc; i++)
+		{
+			std::string Arg = argv[i];
+
+			if (i + 1 >= argc)
+			{
+				Usage(argv[0]);
+			}
+			if (Arg == "-i")
+			{
+				Parsed.Interface = argv[++i];
+			}
+			else if (Arg == "-o")
+			{
+				Parsed.OutPath = argv[++i];
+			}
+			else if (Arg == "--initial")
+			{
+				Parsed.InitialPath = argv[++i];
+			}
+			else if (Arg == "--page-ms")
+			{
+				Parsed.PageMs = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+			}
+			else if (Arg == "--drop")
+			{
+				Parsed.DropPpm = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+			}
+			else if (Arg == "--timeout")
+			{
+				Parsed.TimeoutS = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+			}
+			else
+			{
+				Usage(argv[0]);
+			}
+		}
+		if (Parsed.Interface.empty() || Parsed.OutPath.empty())
+		{
+			Usage(argv[0]);
+		}
+		return Parsed;
+	}
+
+	uint32_t Crc(const std::vector<uint8_t> &Data, uint32_t Length)
+	{
+		return SRV_CRC_Update(CRC_INITIAL, Data.data(), Length);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	Options Parsed = ParseOptions(argc, argv);
+	const uint32_t FramesPerPage = Protocol::FlashPageSize / Protocol::ChunkSize;
+	/* Slot the session programs, with room for the padding of the last frame */
+	std::vector<uint8_t> Flash(Protocol::SlotSize + Protocol::ChunkSize, 0xFF);
+	std::vector<uint8_t> Running;   /* Slot A when it holds the running image */
+	uint32_t Target = 0;        /* Address of the slot the session programs */
+	std::vector<can_frame> Frames;
+	std::mt19937 Random(1);
+	uint8_t HeaderBytes[IMAGE_HEADER_SIZE];
+	SRV_IMAGE_Header_t Header = {};
+	bool Opened = false;        /* CmdImageStart was received */
+	bool Accepted = false;      /* The header was checked, the image follows */
+	uint32_t Received = 0;
+	uint32_t SessionFrames = 0;
+	/* Decoder of an encoded image, all return 1 on success, none for a plain image */
+	uint8_t (*Decode)(const uint8_t *, uint32_t *, uint8_t *, uint32_t *) = nullptr;
+	uint32_t OutputCount = 0;   /* Decoded bytes of an encoded image */
+	bool PagePending = false;
+	uint8_t PendingSeq = 0;
+	Clock::time_point PageDoneAt;
+	Clock::time_point GiveUpAt = Clock::now() + std::chrono::seconds(Parsed.TimeoutS);
+
+	try
+	{
+		if (!Parsed.InitialPath.empty())
+		{
+			std::ifstream Initial(Parsed.InitialPath, std::ios::binary);
+			Running.assign(Protocol::SlotSize, 0xFF);
+			Initial.read(reinterpret_cast<char *>(Running.data()), Protocol::SlotSize);
+		}
+
+		CanSocket Bus(Parsed.Interface, {Protocol::DataFrameId, Protocol::DataFrameId ^ Protocol::DataFrameSeqMask,
+		                                 Protocol::CmdFrameId});
+		const uint8_t Refused[2] = {Protocol::RespNegative, Protocol::CmdImageStart};
+
+		while (Clock::now() < GiveUpAt)
+		{
+			struct pollfd Polled = {Bus.Fd(), POLLIN, 0};
+
+			if (PagePending && Clock::now() >= PageDoneAt)
+			{
+				const uint8_t Ack[2] = {Protocol::AckFrameData, PendingSeq};
+				PagePending = false;
+				/* The last frame is only acknowledged when the slot holds the image of the header */
+				if (Received >= SessionFrames)
+				{
+					if (Crc(Flash, Header.Length) != Header.ImageCrc)
+					{
+						Bus.Queue(Protocol::RespFrameId, Refused, sizeof(Refused));
+						Bus.Flush();
+						throw std::runtime_error("the image does not match the checksum of its header");
+					}
+				}
+				Bus.Queue(Protocol::AckFrameId, Ack, sizeof(Ack));
+			}
+			Bus.Flush();
+			if (Accepted && !PagePending && Received >= SessionFrames && !Bus.HasQueued())
+			{
+				break;
+			}
+
+			if (poll(&Polled, 1, PagePending ? 1 : 100) < 0 && errno != EINTR)
+			{
+				throw std::runtime_error(std::string("poll: ") + std::strerror(errno));
+			}
+			Bus.Receive(Frames);
+			for (const can_frame &Frame : Frames)
+			{
+				uint32_t Id = Frame.can_id & CAN_SFF_MASK;
+
+				if (Id == Protocol::CmdFrameId && Frame.can_dlc >= 1)
+				{
+					uint8_t Resp[5] = {(uint8_t)(Frame.data[0] | Protocol::RespPositive), (uint8_t)Received,
+					                   (uint8_t)(Received >> 8), (uint8_t)(Received >> 16), (uint8_t)(Received >> 24)};
+					if (Frame.data[0] == Protocol::CmdResumeQuery && Accepted)
+					{
+						Bus.Queue(Protocol::RespFrameId, Resp, sizeof(Resp));
+					}
+					else if (Frame.data[0] == Protocol::CmdImageStart && !PagePending)
+					{
+						Opened = true;
+						Accepted = false;
+						Received = 0;
+						SessionFrames = Protocol::HeaderFrames;
+						Bus.Queue(Protocol::RespFrameId, Resp, 1);
+					}
+					else if (Frame.data[0] == Protocol::CmdEnterUpdate)
+					{
+						/* The receiver is already running */
+						Bus.Queue(Protocol::RespFrameId, Resp, 1);
+					}
+					else
+					{
+						const uint8_t Negative[2] = {Protocol::RespNegative, Frame.data[0]};
+						Bus.Queue(Protocol::RespFrameId, Negative, sizeof(Negative));
+					}
+					continue;
+				}
+				if ((Id & ~Protocol::DataFrameSeqMask) != Protocol::DataFrameId || Frame.can_dlc != Protocol::ChunkSize)
+				{
+					continue;
+				}
+				if (!Opened || (Parsed.DropPpm != 0 && (Random() % 1000000U) < Parsed.DropPpm))
+				{
+					continue;
+				}
+
+				uint8_t Seq = (uint8_t)((Id ^ Protocol::DataFrameId) & Protocol::DataFrameSeqMask);
+				const uint8_t Ack[2] = {Protocol::AckFrameData, Seq};
+				const uint8_t Busy[2] = {Protocol::AckFrameBusy, Seq};
+				if (PagePending)
+				{
+					/* A retransmission of the frame that completed the page */
+					if (Seq == PendingSeq)
+					{
+						Bus.Queue(Protocol::AckFrameId, Busy, sizeof(Busy));
+					}
+					continue;
+				}
+				if (Seq != (Received & Protocol::DataFrameSeqMask) || Received >= SessionFrames)
+				{
+					Bus.Queue(Protocol::AckFrameId, Ack, sizeof(Ack));
+					continue;
+				}
+
+				bool PageComplete;
+				if (!Accepted)
+				{
+					std::memcpy(&HeaderBytes[Received * Protocol::ChunkSize], Frame.data, Protocol::ChunkSize);
+					if (++Received < Protocol::HeaderFrames)
+					{
+						Bus.Queue(Protocol::AckFrameId, Ack, sizeof(Ack));
+						continue;
+					}
+					Decode = nullptr;
+					/* The slot that is not running, the one the header is linked for on a fresh receiver */
+					Target = Running.empty() ? Protocol::NewFirmwareAddress : Protocol::SlotBAddress;
+					if (Running.empty() &&
+						SRV_IMAGE_Parse(HeaderBytes, Target, Protocol::SlotSize, &Header) != IMAGE_OK)
+					{
+						Target = Protocol::SlotBAddress;
+					}
+					if (SRV_IMAGE_Parse(HeaderBytes, Target, Protocol::SlotSize, &Header) != IMAGE_OK ||
+						((Header.Flags & IMAGE_FLAG_DELTA) != 0 &&
+						 (Running.empty() || Crc(Running, Header.BaseLength) != Header.BaseCrc)))
+					{
+						Opened = false;
+						Bus.Queue(Protocol::RespFrameId, Refused, sizeof(Refused));
+						continue;
+					}
+					if ((Header.Flags & IMAGE_FLAG_LZSS) != 0)
+					{
+						SRV_LZSS_Init();
+						Decode = SRV_LZSS_Decode;
+					}
+					else if ((Header.Flags & IMAGE_FLAG_SPARSE) != 0)
+					{
+						SRV_SPARSE_Init();
+						Decode = SRV_SPARSE_Expand;
+					}
+					else if ((Header.Flags & IMAGE_FLAG_DELTA) != 0)
+					{
+						SRV_DELTA_Init(Running.data(), Header.BaseLength);
+						Decode = SRV_DELTA_Apply;
+					}
+					Accepted = true;
+					SessionFrames = Protocol::HeaderFrames + (Header.StreamSize + Protocol::ChunkSize - 1) / Protocol::ChunkSize;
+					OutputCount = 0;
+					Bus.Queue(Protocol::AckFrameId, Ack, sizeof(Ack));
+					continue;
+				}
+				else if (Decode != nullptr)
+				{
+					uint32_t Consumed = Protocol::ChunkSize;
+					uint32_t Space = Header.Length - OutputCount;
+					uint32_t PageBefore = OutputCount / Protocol::FlashPageSize;
+
+					if (Decode(Frame.data, &Consumed, &Flash[OutputCount], &Space) == 0)
+					{
+						Bus.Queue(Protocol::RespFrameId, Refused, sizeof(Refused));
+						Bus.Flush();
+						throw std::runtime_error("corrupt stream at frame " + std::to_string(Received));
+					}
+					OutputCount += Space;
+					Received++;
+					PageComplete = (OutputCount / Protocol::FlashPageSize) != PageBefore ||
+					               OutputCount >= Header.Length || Received >= SessionFrames;
+				}
+				else
+				{
+					std::memcpy(&Flash[(Received - Protocol::HeaderFrames) * Protocol::ChunkSize], Frame.data,
+					            Protocol::ChunkSize);
+					Received++;
+					PageComplete = ((Received - Protocol::HeaderFrames) % FramesPerPage) == 0 || Received >= SessionFrames;
+				}
+				if (PageComplete)
+				{
+					PagePending = true;
+					PendingSeq = Seq;
+					PageDoneAt = Clock::now() + std::chrono::milliseconds(Parsed.PageMs);
+					Bus.Queue(Protocol::AckFrameId, Busy, sizeof(Busy));
+				}
+				else
+				{
+					Bus.Queue(Protocol::AckFrameId, Ack, sizeof(Ack));
+				}
+			}
+		}
+	}
+	catch (const std::exception &Error)
+	{
+		std::fprintf(stderr, "error: %s\n", Error.what());
+		return EXIT_FAILURE;
+	}
+
+	if (!Accepted || Received < SessionFrames)
+	{
+		std::fprintf(stderr, "error: timed out after %u of %u frames\n", Received, SessionFrames);
+		return EXIT_FAILURE;
+	}
+	std::printf("programmed slot 0x%08X, the bootloader starts it\n", (unsigned)Target);
+	std::ofstream Out(Parsed.OutPath, std::ios::binary);
+	Out.write(reinterpret_cast<const char *>(Flash.data()), Header.Length);
+	return Out ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,53 @@
+/*================================================================
+ * 	File Name: Rto.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "Rto.hpp"
+
+uint32_t Rto::Clamp(uint64_t Us)
+{
+	if (Us < MinUs)
+	{
+		return MinUs;
+	}
+	if (Us > MaxUs)
+	{
+		return MaxUs;
+	}
+	return (uint32_t)Us;
+}
+
+void Rto::Sample(uint32_t RttUs)
+{
+	int64_t Delta;
+
+	if (!HasSample)
+	{
+		/* First measurement: SRTT = R, RTTVAR = R/2 */
+		SmoothedRtt = RttUs << SrttShift;
+		RttVariation = RttUs << (RttVarShift - 1U);
+		HasSample = true;
+	}
+	else
+	{
+		/* SRTT += (R - SRTT) / 8 */
+		Delta = (int64_t)RttUs - (int64_t)(SmoothedRtt >> SrttShift);
+		SmoothedRtt = (uint32_t)((int64_t)SmoothedRtt + Delta);
+		/* RTTVAR += (|R - SRTT| - RTTVAR) / 4 */
+		if (Delta < 0)
+		{
+			Delta = -Delta;
+		}
+		Delta -= (int64_t)(RttVariation >> RttVarShift);
+		RttVariation = (uint32_t)((int64_t)RttVariation + Delta);
+	}
+
+	/* RTO = SRTT + 4 * RTTVAR, RTTVAR is already scaled by 4 */
+	Timeout = Clamp((uint64_t)(SmoothedRtt >> SrttShift) + RttVariation);
+}
+
+void Rto::Backoff()
+{
+	Timeout = Clamp((uint64_t)Timeout << 1);
+	Backoffs++;
+}
@@ -0,0 +1,192 @@
+/*================================================================
+ * 	File Name: Session.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "Session.hpp"
+#include "Protocol.hpp"
+
+Session::Session(CanSocket &Socket, std::vector<uint8_t> Payload)
+	: Bus(Socket), Payload(std::move(Payload)), Phase(State::Enter), ResumeFrame(0), FrameCount(0), Retries(0), Busy(false)
+{
+	FrameTotal = (uint32_t)((this->Payload.size() + Protocol::ChunkSize - 1) / Protocol::ChunkSize);
+}
+
+void Session::Start(Clock::time_point Now)
+{
+	Started = Now;
+	Retries = 0;
+	Phase = State::Enter;
+	SendCommand(Protocol::CmdEnterUpdate, Now);
+}
+
+void Session::Arm(Clock::time_point Now)
+{
+	SentAt = Now;
+	TimeoutAt = Now + std::chrono::microseconds(Busy ? Rto::BusyUs : Estimator.TimeoutUs());
+}
+
+void Session::Finish(State Result, Clock::time_point Now)
+{
+	Phase = Result;
+	Ended = Now;
+	TimeoutAt = Clock::time_point::max();
+}
+
+void Session::SendCommand(uint8_t Command, Clock::time_point Now)
+{
+	const uint8_t Cmd[1] = {Command};
+
+	Bus.Queue(Protocol::CmdFrameId, Cmd, sizeof(Cmd));
+	Arm(Now);
+}
+
+void Session::SendData(Clock::time_point Now)
+{
+	uint8_t Data[Protocol::ChunkSize];
+	size_t Offset = (size_t)FrameCount * Protocol::ChunkSize;
+
+	if (FrameCount >= FrameTotal)
+	{
+		Finish(State::Done, Now);
+		return;
+	}
+	for (uint32_t i = 0; i < Protocol::ChunkSize; i++)
+	{
+		Data[i] = ((Offset + i) < Payload.size()) ? Payload[Offset + i] : 0xFF;
+	}
+	Bus.Queue(Protocol::DataFrameIdSeq(FrameCount), Data, sizeof(Data));
+	Arm(Now);
+}
+
+void Session::OnFrame(const can_frame &Frame, Clock::time_point Now)
+{
+	uint32_t Id = Frame.can_id & CAN_SFF_MASK;
+	uint32_t RttUs = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(Now - SentAt).count();
+
+	if ((Frame.can_id & (CAN_EFF_FLAG | CAN_RTR_FLAG)) != 0U)
+	{
+		return;
+	}
+
+	/* The receiver refused the header or the resume query, or found the image corrupt */
+	if (!Finished() && Id == Protocol::RespFrameId && Frame.can_dlc >= 2 && Frame.data[0] == Protocol::RespNegative &&
+		(Frame.data[1] == Protocol::CmdImageStart || (Phase == State::Query && Frame.data[1] == Protocol::CmdResumeQuery)))
+	{
+		Finish(State::Failed, Now);
+	}
+	else if (Phase == State::Enter && Id == Protocol::RespFrameId && Frame.can_dlc >= 1 &&
+	         (Frame.data[0] == (Protocol::CmdEnterUpdate | Protocol::RespPositive) ||
+	          (Frame.can_dlc >= 2 && Frame.data[0] == Protocol::RespNegative && Frame.data[1] == Protocol::CmdEnterUpdate)))
+	{
+		/* An application resets into the receiver now, CmdImageStart is repeated until it is up */
+		if (Retries == 0)
+		{
+			Estimator.Sample(RttUs);
+		}
+		Retries = 0;
+		Phase = State::Open;
+		SendCommand(Protocol::CmdImageStart, Now);
+	}
+	else if (Phase == State::Open && Id == Protocol::RespFrameId && Frame.can_dlc >= 1 &&
+	         Frame.data[0] == (Protocol::CmdImageStart | Protocol::RespPositive))
+	{
+		if (Retries == 0)
+		{
+			Estimator.Sample(RttUs);
+		}
+		Retries = 0;
+		Phase = State::Header;
+		SendData(Now);
+	}
+	else if (Phase == State::Query && Id == Protocol::RespFrameId && Frame.can_dlc >= 5 &&
+	         Frame.data[0] == (Protocol::CmdResumeQuery | Protocol::RespPositive))
+	{
+		if (Retries == 0)
+		{
+			Estimator.Sample(RttUs);
+		}
+		ResumeFrame = (uint32_t)Frame.data[1] | ((uint32_t)Frame.data[2] << 8) |
+		              ((uint32_t)Frame.data[3] << 16) | ((uint32_t)Frame.data[4] << 24);
+		if (ResumeFrame < Protocol::HeaderFrames || ResumeFrame > FrameTotal)
+		{
+			Finish(State::Failed, Now);
+			return;
+		}
+		FrameCount = ResumeFrame;
+		Retries = 0;
+		Phase = State::Data;
+		SendData(Now);
+	}
+	else if ((Phase == State::Header || Phase == State::Data) && Id == Protocol::AckFrameId && Frame.can_dlc >= 2 &&
+	         Frame.data[0] == Protocol::AckFrameBusy && Frame.data[1] == (FrameCount & Protocol::DataFrameSeqMask))
+	{
+		/* The frame completed a page, wait for the programming instead of timing out */
+		Retries = 0;
+		Busy = true;
+		Arm(Now);
+	}
+	else if ((Phase == State::Header || Phase == State::Data) && Id == Protocol::AckFrameId && Frame.can_dlc >= 2 &&
+	         Frame.data[0] == Protocol::AckFrameData && Frame.data[1] == (FrameCount & Protocol::DataFrameSeqMask))
+	{
+		/* Karn's algorithm: the round trip of a retransmitted frame is ambiguous,
+		 * the one of a busy frame holds the page programming */
+		if (Retries == 0 && !Busy)
+		{
+			Estimator.Sample(RttUs);
+		}
+		FrameCount++;
+		Retries = 0;
+		Busy = false;
+		/* The header was accepted, ask where the image continues */
+		if (Phase == State::Header && FrameCount >= Protocol::HeaderFrames)
+		{
+			Phase = State::Query;
+			SendCommand(Protocol::CmdResumeQuery, Now);
+			return;
+		}
+		SendData(Now);
+	}
+}
+
+void Session::OnTimer(Clock::time_point Now)
+{
+	if (Finished() || Now < TimeoutAt)
+	{
+		return;
+	}
+
+	if (++Retries > Rto::MaxRetries)
+	{
+		if (Phase != State::Enter)
+		{
+			Finish(State::Failed, Now);
+			return;
+		}
+		/* No agent on the target, it may be the receiver started by hand */
+		Phase = State::Open;
+		Retries = 0;
+	}
+
+	/* The copy still waiting in our queue is stale, send the frame again */
+	Bus.DiscardQueued();
+	if (!Busy)
+	{
+		Estimator.Backoff();
+	}
+	if (Phase == State::Enter)
+	{
+		SendCommand(Protocol::CmdEnterUpdate, Now);
+	}
+	else if (Phase == State::Open)
+	{
+		SendCommand(Protocol::CmdImageStart, Now);
+	}
+	else if (Phase == State::Query)
+	{
+		SendCommand(Protocol::CmdResumeQuery, Now);
+	}
+	else
+	{
+		SendData(Now);
+	}
+}
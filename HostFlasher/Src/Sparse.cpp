@@ -0,0 +1,66 @@
+/*================================================================
+ * 	File Name: Sparse.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "Sparse.hpp"
+
+#include <cstddef>
+
+extern "C"
+{
+#include "SRV/SPARSE/SPARSE.h"
+}
+
+namespace
+{
+	/* Shortest run worth a fill extent: it and the data extent after it cost up to 8 bytes */
+	constexpr size_t MinFill = 16;
+
+	void PutNumber(std::vector<uint8_t> &Out, size_t Value)
+	{
+		do
+		{
+			uint8_t Byte = (uint8_t)(Value & 0x7F);
+			Value >>= 7;
+			Out.push_back((Value != 0) ? (uint8_t)(Byte | 0x80) : Byte);
+		} while (Value != 0);
+	}
+
+	void PutData(std::vector<uint8_t> &Out, const std::vector<uint8_t> &Input, size_t Start, size_t End)
+	{
+		if (End > Start)
+		{
+			Out.push_back(SPARSE_OP_DATA);
+			PutNumber(Out, End - Start);
+			Out.insert(Out.end(), Input.begin() + (long)Start, Input.begin() + (long)End);
+		}
+	}
+}
+
+std::vector<uint8_t> Sparse::Encode(const std::vector<uint8_t> &Input)
+{
+	std::vector<uint8_t> Out;
+	size_t DataStart = 0;
+	size_t Position = 0;
+
+	while (Position < Input.size())
+	{
+		size_t RunEnd = Position + 1;
+
+		while (RunEnd < Input.size() && Input[RunEnd] == Input[Position])
+		{
+			RunEnd++;
+		}
+		if (RunEnd - Position >= MinFill)
+		{
+			PutData(Out, Input, DataStart, Position);
+			Out.push_back(SPARSE_OP_FILL);
+			PutNumber(Out, RunEnd - Position);
+			Out.push_back(Input[Position]);
+			DataStart = RunEnd;
+		}
+		Position = RunEnd;
+	}
+	PutData(Out, Input, DataStart, Input.size());
+	return Out;
+}
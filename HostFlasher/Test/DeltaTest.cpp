@@ -0,0 +1,87 @@
+/*================================================================
+ * 	File Name: DeltaTest.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "Delta.hpp"
+#include "TestSupport.hpp"
+
+extern "C"
+{
+#include "SRV/CRC/CRC.h"
+#include "SRV/DELTA/DELTA.h"
+}
+
+namespace
+{
+	bool Apply(const std::vector<uint8_t> &Base, const std::vector<uint8_t> &Stream, size_t Size, uint32_t InputStep,
+	           uint32_t OutputStep, std::vector<uint8_t> &Output)
+	{
+		SRV_DELTA_Init(Base.data(), (uint32_t)Base.size());
+		return DecodeInChunks(SRV_DELTA_Apply, DELTA_OK, Stream, Size, InputStep, OutputStep, Output);
+	}
+
+	size_t RoundTrip(const std::vector<uint8_t> &Base, const std::vector<uint8_t> &Target, const char *What)
+	{
+		std::vector<uint8_t> Stream = Delta::Create(Base, Target);
+		std::vector<uint8_t> Output;
+
+		Check(Apply(Base, Stream, Target.size(), 8, 1024, Output) && Output == Target, What);
+		Check(Apply(Base, Stream, Target.size(), 8, 5, Output) && Output == Target, What);
+		Check(Apply(Base, Stream, Target.size(), 1, 1, Output) && Output == Target, What);
+		return Stream.size();
+	}
+}
+
+int main()
+{
+	std::mt19937 Random(5);
+	std::vector<uint8_t> Base(6856);
+	std::vector<uint8_t> Patched;
+	std::vector<uint8_t> Other(6856);
+	std::vector<uint8_t> Output(16);
+	const char *Check9 = "123456789";
+	const std::vector<uint8_t> OutsideBase = {DELTA_OP_COPY, 0x10, 0xC0, 0x35};
+	uint32_t Consumed = (uint32_t)OutsideBase.size();
+	uint32_t Space = (uint32_t)Output.size();
+	size_t PatchSize;
+
+	/* The check value of CRC-32/ISO-HDLC */
+	Check(SRV_CRC_Update(CRC_INITIAL, (const uint8_t *)Check9, 9) == 0xCBF43926UL, "crc check value");
+	Check(SRV_CRC_Update(SRV_CRC_Update(CRC_INITIAL, (const uint8_t *)Check9, 4), (const uint8_t *)Check9 + 4, 5) ==
+	      0xCBF43926UL, "crc in pieces");
+
+	for (size_t i = 0; i < Base.size(); i++)
+	{
+		Base[i] = (i < 6000) ? (uint8_t)Random() : 0xFF;
+	}
+	for (uint8_t &Byte : Other)
+	{
+		Byte = (uint8_t)Random();
+	}
+
+	/* A patch release: a few bytes changed, a function grown by 12 bytes, the tail shifted */
+	Patched = Base;
+	Patched[100] ^= 0x5A;
+	Patched[2500] ^= 0x01;
+	Patched.insert(Patched.begin() + 3000, 12, 0x00);
+	Patched.resize(Base.size());
+
+	Check(RoundTrip(Base, Base, "identical image") < 16, "identical image is a single copy");
+	PatchSize = RoundTrip(Base, Patched, "patched image");
+	Check(PatchSize < 64, "patch release stays small");
+	RoundTrip(Base, Other, "unrelated image");
+	RoundTrip(std::vector<uint8_t>(), Base, "empty base");
+
+	/* A copy reaching past the end of the base */
+	SRV_DELTA_Init(Base.data(), (uint32_t)Base.size());
+	Check(SRV_DELTA_Apply(OutsideBase.data(), &Consumed, Output.data(), &Space) == DELTA_CORRUPT, "copy outside the base");
+
+	std::printf("patch release: %zu bytes of delta for a %zu byte image\n", PatchSize, Patched.size());
+	return TestResult();
+}
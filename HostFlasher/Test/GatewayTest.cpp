@@ -0,0 +1,213 @@
+/*================================================================
+ * 	File Name: GatewayTest.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "Gateway.hpp"
+#include "Package.hpp"
+#include "Protocol.hpp"
+#include "TestSupport.hpp"
+
+namespace
+{
+	/* Ring of SRV/GATEWAY in its default configuration */
+	constexpr size_t RingSize = 2048;
+	constexpr size_t Window = RingSize - Protocol::GatewayCreditBlock;
+
+	/* The gateway side of a PTY: what SRV/GATEWAY does, with a bus that drains Rate bytes per ms */
+	struct Emulator
+	{
+		int Master = -1;
+		size_t Rate;
+		size_t FailAt;                  /* Session offset answered with GatewayFailed, 0 for none */
+		bool Silent;                    /* Never answers */
+		std::vector<uint8_t> Received;  /* Session bytes, magic stripped */
+		bool Overrun = false;           /* The host sent beyond its credit */
+		size_t Junk = 0;                /* Bytes dropped in front of the magic */
+
+		Emulator(size_t Rate, size_t FailAt, bool Silent) : Rate(Rate), FailAt(FailAt), Silent(Silent) {}
+
+		void Put(uint8_t Byte)
+		{
+			Check(write(Master, &Byte, 1) == 1, "emulator write");
+		}
+
+		bool Read(std::vector<uint8_t> &Bytes, int TimeoutMs)
+		{
+			struct pollfd Polled = {Master, POLLIN, 0};
+			uint8_t Buffer[512];
+			ssize_t Count;
+
+			if (poll(&Polled, 1, TimeoutMs) <= 0)
+			{
+				return false;
+			}
+			Count = read(Master, Buffer, sizeof(Buffer));
+			if (Count <= 0)
+			{
+				return false;
+			}
+			Bytes.insert(Bytes.end(), Buffer, Buffer + Count);
+			return true;
+		}
+
+		void Run()
+		{
+			std::vector<uint8_t> Line;
+			size_t Matched = 0;
+			size_t Released = 0;
+			size_t Credited = 0;
+			size_t Size = 0;
+
+			/* Everything up to the magic is dropped */
+			while (Matched < 4 && Read(Line, 2000))
+			{
+				size_t i = 0;
+
+				for (; i < Line.size() && Matched < 4; i++)
+				{
+					Matched = (Line[i] == (uint8_t)Protocol::GatewayStartMagic[Matched]) ? Matched + 1 :
+					          (Line[i] == (uint8_t)Protocol::GatewayStartMagic[0]) ? 1 : 0;
+					Junk++;
+				}
+				Received.assign(Line.begin() + (long)i, Line.end());
+				Line.clear();
+			}
+			Junk -= 4;
+			if (Silent || Matched < 4)
+			{
+				return;
+			}
+
+			while (true)
+			{
+				while (Credited + Protocol::GatewayCreditBlock <= Released + Window)
+				{
+					Credited += Protocol::GatewayCreditBlock;
+					Put(Protocol::GatewayCredit);
+				}
+				Read(Received, 1);
+				Overrun = Overrun || Received.size() > Credited;
+				if (Size == 0 && Received.size() >= IMAGE_HEADER_SIZE)
+				{
+					SRV_IMAGE_Header_t Header;
+
+					Check(SRV_IMAGE_Parse(Received.data(), Protocol::NewFirmwareAddress, Protocol::SlotSize, &Header) ==
+					      IMAGE_OK, "forwarded header");
+					Size = IMAGE_HEADER_SIZE + Header.StreamSize;
+				}
+				/* Frames leave one by one, a frame is released once the next one is sent */
+				Released = std::min(Released + Rate, Received.size() / Protocol::ChunkSize * Protocol::ChunkSize);
+				if (FailAt != 0 && Released >= FailAt)
+				{
+					Put(Protocol::GatewayFailed);
+					return;
+				}
+				if (Size != 0 && Received.size() >= Size)
+				{
+					Put(Protocol::GatewayDone);
+					return;
+				}
+			}
+		}
+	};
+
+	int OpenPty(std::string &SlavePath)
+	{
+		int Master = posix_openpt(O_RDWR | O_NOCTTY);
+
+		if (Master < 0 || grantpt(Master) < 0 || unlockpt(Master) < 0)
+		{
+			throw std::runtime_error("no pty");
+		}
+		SlavePath = ptsname(Master);
+		return Master;
+	}
+
+	/* One session through a fresh PTY, Result is 1 on done, 0 on failed and -1 when Send threw */
+	int RunSession(const std::vector<uint8_t> &Payload, Emulator &Side, std::chrono::milliseconds Silence,
+	               const char *Junk = "")
+	{
+		std::string SlavePath;
+		int Result;
+
+		Side.Master = OpenPty(SlavePath);
+		{
+			Gateway Link(SlavePath, Protocol::GatewayBaudrate);
+			std::thread Thread;
+
+			Thread = std::thread([&Side]() { Side.Run(); });
+			if (Junk[0] != '\0')
+			{
+				/* Noise on the line in front of the session */
+				int Slave = open(SlavePath.c_str(), O_WRONLY | O_NOCTTY);
+
+				Check(write(Slave, Junk, std::strlen(Junk)) == (ssize_t)std::strlen(Junk), "junk written");
+				close(Slave);
+			}
+			try
+			{
+				Result = Link.Send(Payload, Silence) ? 1 : 0;
+			}
+			catch (const std::runtime_error &)
+			{
+				Result = -1;
+			}
+			Thread.join();
+			Check(Link.BytesWritten() <= 4 + Link.Credits() * Protocol::GatewayCreditBlock, "writes within the credit");
+		}
+		close(Side.Master);
+		return Result;
+	}
+}
+
+int main()
+{
+	std::mt19937 Random(39);
+	std::vector<uint8_t> Image(7000);
+	std::vector<uint8_t> Payload;
+
+	for (uint8_t &Byte : Image)
+	{
+		Byte = (uint8_t)Random();
+	}
+	Payload = Package::Payload(Package::Pack(Package::PadToPages(Image), Package::Options()));
+
+	{
+		Emulator Side(64, 0, false);
+
+		Check(RunSession(Payload, Side, std::chrono::milliseconds(2000)) == 1, "session done");
+		Check(Side.Received == Payload, "session forwarded byte for byte");
+		Check(!Side.Overrun, "host kept to its credit");
+	}
+	{
+		/* A bus slower than the line, the host waits for credit most of the time */
+		Emulator Side(8, 0, false);
+
+		Check(RunSession(Payload, Side, std::chrono::milliseconds(2000), "GW\x06GWS") == 1, "slow bus");
+		Check(Side.Received == Payload && Side.Junk == 6, "junk before the magic dropped");
+		Check(!Side.Overrun, "host kept to its credit on a slow bus");
+	}
+	{
+		Emulator Side(64, 3000, false);
+
+		Check(RunSession(Payload, Side, std::chrono::milliseconds(2000)) == 0, "failed session reported");
+	}
+	{
+		Emulator Side(64, 0, true);
+
+		Check(RunSession(Payload, Side, std::chrono::milliseconds(200)) == -1, "silent gateway");
+	}
+	return TestResult();
+}
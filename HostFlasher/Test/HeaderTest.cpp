@@ -0,0 +1,106 @@
+/*================================================================
+ * 	File Name: HeaderTest.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "Protocol.hpp"
+#include "SampleTable.hpp"
+#include "TestSupport.hpp"
+
+extern "C"
+{
+#include "SRV/CRC/CRC.h"
+#include "SRV/IMAGE/IMAGE.h"
+}
+
+namespace
+{
+	SRV_IMAGE_Header_t Plain(uint32_t Length)
+	{
+		SRV_IMAGE_Header_t Header = {};
+
+		Header.Length = Length;
+		Header.LoadAddress = Protocol::NewFirmwareAddress;
+		Header.Version = 7;
+		Header.ImageCrc = 0x12345678;
+		Header.StreamSize = Length;
+		return Header;
+	}
+
+	/* Seal the header and check it as the receiver does */
+	bool Accepted(SRV_IMAGE_Header_t Header)
+	{
+		uint8_t Bytes[IMAGE_HEADER_SIZE];
+		SRV_IMAGE_Header_t Parsed;
+
+		SRV_IMAGE_Build(&Header, Bytes);
+		return SRV_IMAGE_Parse(Bytes, Protocol::NewFirmwareAddress, Protocol::SlotSize, &Parsed) == IMAGE_OK;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	SRV_IMAGE_Header_t Header = Plain(6856);
+	SRV_IMAGE_Header_t Parsed = {};
+	SRV_IMAGE_Header_t Changed;
+	uint8_t Bytes[IMAGE_HEADER_SIZE];
+	bool AllCaught = true;
+
+	SRV_IMAGE_Build(&Header, Bytes);
+	Check(SRV_IMAGE_Parse(Bytes, Protocol::NewFirmwareAddress, Protocol::SlotSize, &Parsed) == IMAGE_OK, "plain header");
+	Check(Parsed.Magic == IMAGE_MAGIC && Parsed.Length == 6856 && Parsed.Version == 7 &&
+	      Parsed.ImageCrc == 0x12345678 && Parsed.HeaderCrc == Header.HeaderCrc, "fields survive the round trip");
+	Check(Bytes[0] == 'I' && Bytes[3] == '1' && Bytes[8] == 0xC8 && Bytes[9] == 0x1A, "little endian layout");
+
+	/* Every single bit error is caught by the header checksum */
+	for (uint32_t Bit = 0; Bit < IMAGE_HEADER_SIZE * 8; Bit++)
+	{
+		Bytes[Bit / 8] ^= (uint8_t)(1U << (Bit % 8));
+		AllCaught = AllCaught &&
+		            SRV_IMAGE_Parse(Bytes, Protocol::NewFirmwareAddress, Protocol::SlotSize, &Parsed) == IMAGE_INVALID;
+		Bytes[Bit / 8] ^= (uint8_t)(1U << (Bit % 8));
+	}
+	Check(AllCaught, "bit errors");
+
+	Check(Accepted(Plain(1)), "one byte image");
+	Check(Accepted(Plain(Protocol::SlotSize)), "image filling the slot");
+	Check(!Accepted(Plain(0)), "empty image");
+	Check(!Accepted(Plain(Protocol::SlotSize + 1)), "image larger than the slot");
+	Changed = Plain(6856);
+	Changed.LoadAddress = 0x08000000;
+	Check(!Accepted(Changed), "image for another address");
+	Changed = Plain(6856);
+	Changed.StreamSize = 4000;
+	Check(!Accepted(Changed), "plain image of another size than its stream");
+	Changed.Flags = IMAGE_FLAG_LZSS;
+	Check(Accepted(Changed), "compressed image");
+	Changed.Flags = IMAGE_FLAG_LZSS | IMAGE_FLAG_DELTA;
+	Check(!Accepted(Changed), "compressed delta");
+	Changed.Flags = IMAGE_FLAG_SPARSE;
+	Check(Accepted(Changed), "sparse image");
+	Changed.Flags = IMAGE_FLAG_SPARSE | IMAGE_FLAG_LZSS;
+	Check(!Accepted(Changed), "compressed sparse image");
+	Changed.Flags = 0x80;
+	Check(!Accepted(Changed), "unknown flag");
+	Changed.Flags = IMAGE_FLAG_DELTA;
+	Check(!Accepted(Changed), "delta without a base");
+	Changed.BaseLength = 6000;
+	Check(Accepted(Changed), "delta");
+
+	/* The sender's sample starts with the header of the image that follows */
+	if (argc > 1)
+	{
+		std::vector<uint8_t> Application = SampleApplication(argv[1]);
+
+		Check(Application.size() > IMAGE_HEADER_SIZE &&
+		      SRV_IMAGE_Parse(Application.data(), Protocol::NewFirmwareAddress, Protocol::SlotSize, &Parsed) == IMAGE_OK,
+		      "sample header");
+		Check(Parsed.Length == Application.size() - IMAGE_HEADER_SIZE &&
+		      Parsed.ImageCrc == SRV_CRC_Update(CRC_INITIAL, Application.data() + IMAGE_HEADER_SIZE, Parsed.Length),
+		      "sample image matches its header");
+	}
+	return TestResult();
+}
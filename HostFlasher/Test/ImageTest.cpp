@@ -0,0 +1,129 @@
+/*================================================================
+ * 	File Name: ImageTest.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <elf.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Image.hpp"
+#include "TestSupport.hpp"
+
+namespace
+{
+	std::string HexRecord(uint8_t Type, uint16_t Address, const std::vector<uint8_t> &Data)
+	{
+		std::vector<uint8_t> Record = {(uint8_t)Data.size(), (uint8_t)(Address >> 8), (uint8_t)Address, Type};
+		std::string Line = ":";
+		uint8_t Sum = 0;
+		char Digits[3];
+
+		Record.insert(Record.end(), Data.begin(), Data.end());
+		for (uint8_t Byte : Record)
+		{
+			Sum = (uint8_t)(Sum + Byte);
+		}
+		Record.push_back((uint8_t)(0x100 - Sum));
+		for (uint8_t Byte : Record)
+		{
+			std::snprintf(Digits, sizeof(Digits), "%02X", Byte);
+			Line += Digits;
+		}
+		return Line + "\r\n";
+	}
+
+	void TestIntelHex()
+	{
+		std::string Text = HexRecord(0x04, 0, {0x08, 0x00}) +
+		                   HexRecord(0x00, 0xDC00, {0x00, 0x50, 0x00, 0x20}) +
+		                   HexRecord(0x00, 0xDC04, {0xAD, 0x2F}) +
+		                   HexRecord(0x00, 0xDC10, {0x11}) +
+		                   HexRecord(0x05, 0, {0x08, 0x00, 0xDC, 0x01}) +
+		                   HexRecord(0x01, 0, {});
+		Image Loaded = Image::FromIntelHex(Text);
+
+		Check(Loaded.BaseAddress() == 0x0800DC00, "hex base address");
+		Check(Loaded.Bytes().size() == 0x11, "hex span");
+		Check(Loaded.Bytes()[0] == 0x00 && Loaded.Bytes()[1] == 0x50 && Loaded.Bytes()[5] == 0x2F, "hex data");
+		Check(Loaded.Bytes()[6] == 0xFF && Loaded.Bytes()[0x0F] == 0xFF, "hex gap is erased");
+		Check(Loaded.Bytes()[0x10] == 0x11, "hex last byte");
+
+		std::string Corrupt = Text;
+		Corrupt[Corrupt.find("0050") + 1] = '1';
+		try
+		{
+			Image::FromIntelHex(Corrupt);
+			Check(false, "hex checksum error is detected");
+		}
+		catch (const std::runtime_error &)
+		{
+		}
+	}
+
+	void TestElf()
+	{
+		std::vector<uint8_t> File(0x200, 0);
+		Elf32_Ehdr Header = {};
+		Elf32_Phdr Segments[3] = {};
+		const uint8_t Text[4] = {0xDE, 0xAD, 0xBE, 0xEF};
+		const uint8_t Data[2] = {0x12, 0x34};
+
+		std::memcpy(Header.e_ident, ELFMAG, SELFMAG);
+		Header.e_ident[EI_CLASS] = ELFCLASS32;
+		Header.e_ident[EI_DATA] = ELFDATA2LSB;
+		Header.e_type = ET_EXEC;
+		Header.e_machine = EM_ARM;
+		Header.e_phoff = sizeof(Header);
+		Header.e_phentsize = sizeof(Elf32_Phdr);
+		Header.e_phnum = 3;
+
+		/* .text in flash */
+		Segments[0].p_type = PT_LOAD;
+		Segments[0].p_offset = 0x100;
+		Segments[0].p_vaddr = 0x0800DC00;
+		Segments[0].p_paddr = 0x0800DC00;
+		Segments[0].p_filesz = sizeof(Text);
+		/* .data runs from RAM, it is loaded right after .text */
+		Segments[1].p_type = PT_LOAD;
+		Segments[1].p_offset = 0x180;
+		Segments[1].p_vaddr = 0x20000000;
+		Segments[1].p_paddr = 0x0800DC08;
+		Segments[1].p_filesz = sizeof(Data);
+		/* .bss has nothing to load */
+		Segments[2].p_type = PT_LOAD;
+		Segments[2].p_vaddr = 0x20000010;
+		Segments[2].p_paddr = 0x20000010;
+		Segments[2].p_memsz = 0x100;
+
+		std::memcpy(&File[0], &Header, sizeof(Header));
+		std::memcpy(&File[sizeof(Header)], Segments, sizeof(Segments));
+		std::memcpy(&File[0x100], Text, sizeof(Text));
+		std::memcpy(&File[0x180], Data, sizeof(Data));
+
+		Image Loaded = Image::FromElf(File);
+		Check(Loaded.BaseAddress() == 0x0800DC00, "elf base address");
+		Check(Loaded.Bytes().size() == 10, "elf span");
+		Check(std::memcmp(Loaded.Bytes().data(), Text, sizeof(Text)) == 0, "elf text");
+		Check(Loaded.Bytes()[4] == 0xFF && Loaded.Bytes()[7] == 0xFF, "elf gap is erased");
+		Check(Loaded.Bytes()[8] == 0x12 && Loaded.Bytes()[9] == 0x34, "elf data at its load address");
+	}
+}
+
+int main()
+{
+	try
+	{
+		TestIntelHex();
+		TestElf();
+	}
+	catch (const std::exception &Error)
+	{
+		std::fprintf(stderr, "FAIL: %s\n", Error.what());
+		Failures++;
+	}
+	return TestResult();
+}
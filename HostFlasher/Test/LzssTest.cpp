@@ -0,0 +1,83 @@
+/*================================================================
+ * 	File Name: LzssTest.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Lzss.hpp"
+#include "SampleTable.hpp"
+#include "TestSupport.hpp"
+
+extern "C"
+{
+#include "SRV/IMAGE/IMAGE.h"
+#include "SRV/LZSS/LZSS.h"
+}
+
+namespace
+{
+	bool Expand(const std::vector<uint8_t> &Stream, size_t Size, uint32_t InputStep, uint32_t OutputStep,
+	            std::vector<uint8_t> &Output)
+	{
+		SRV_LZSS_Init();
+		return DecodeInChunks(SRV_LZSS_Decode, LZSS_OK, Stream, Size, InputStep, OutputStep, Output);
+	}
+
+	void RoundTrip(const std::vector<uint8_t> &Input, const char *What)
+	{
+		std::vector<uint8_t> Stream = Lzss::Compress(Input);
+		std::vector<uint8_t> Output;
+
+		Check(Expand(Stream, Input.size(), 8, 1024, Output) && Output == Input, What);
+		/* Output buffers that split matches and literals everywhere */
+		Check(Expand(Stream, Input.size(), 8, 7, Output) && Output == Input, What);
+		Check(Expand(Stream, Input.size(), 3, 1, Output) && Output == Input, What);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	std::mt19937 Random(3);
+	std::vector<uint8_t> Noise(5000);
+	std::vector<uint8_t> Pattern(30 * 1024);
+	const std::vector<uint8_t> Corrupt = {0x00, 0x00, 0x00};
+	std::vector<uint8_t> Output(16);
+	uint32_t Consumed = (uint32_t)Corrupt.size();
+	uint32_t Space = (uint32_t)Output.size();
+
+	for (uint8_t &Byte : Noise)
+	{
+		Byte = (uint8_t)Random();
+	}
+	for (size_t i = 0; i < Pattern.size(); i++)
+	{
+		Pattern[i] = (i % 1000 < 600) ? (uint8_t)(i / 7) : 0xFF;
+	}
+
+	RoundTrip(Noise, "random data");
+	RoundTrip(Pattern, "patterned data");
+	RoundTrip(std::vector<uint8_t>(3000, 0), "zeros");
+	RoundTrip({0x42}, "single byte");
+
+	/* A back-reference in front of the first byte */
+	SRV_LZSS_Init();
+	Check(SRV_LZSS_Decode(Corrupt.data(), &Consumed, Output.data(), &Space) == LZSS_CORRUPT, "corrupt stream");
+
+	if (argc > 1)
+	{
+		std::vector<uint8_t> Application = SampleApplication(argv[1]);
+		size_t Compressed;
+
+		/* The sender's table starts with the image header, the image covers 7 flash pages */
+		Check(Application.size() == IMAGE_HEADER_SIZE + 7 * 1024, "sample application size");
+		Application.erase(Application.begin(), Application.begin() + IMAGE_HEADER_SIZE);
+		Compressed = Lzss::Compress(Application).size();
+		RoundTrip(Application, "sample application");
+		std::printf("sample application: %zu -> %zu bytes (%.1f%%)\n", Application.size(), Compressed,
+		            100.0 * (double)Compressed / (double)Application.size());
+	}
+	return TestResult();
+}
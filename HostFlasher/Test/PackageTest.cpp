@@ -0,0 +1,164 @@
+/*================================================================
+ * 	File Name: PackageTest.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Package.hpp"
+#include "Protocol.hpp"
+#include "SampleTable.hpp"
+#include "TestSupport.hpp"
+
+extern "C"
+{
+#include "SRV/CRC/CRC.h"
+}
+
+namespace
+{
+	bool Refused(const std::vector<uint8_t> &Container)
+	{
+		try
+		{
+			Package::Parse(Container);
+		}
+		catch (const std::runtime_error &)
+		{
+			return true;
+		}
+		return false;
+	}
+
+	bool Same(const Package::Contents &A, const Package::Contents &B)
+	{
+		return A.Header.Flags == B.Header.Flags && A.Header.Length == B.Header.Length &&
+		       A.Header.Version == B.Header.Version && A.Header.ImageCrc == B.Header.ImageCrc &&
+		       A.Header.StreamSize == B.Header.StreamSize && A.Header.BaseLength == B.Header.BaseLength &&
+		       A.Header.BaseCrc == B.Header.BaseCrc && A.Stream == B.Stream && A.PageCrcs == B.PageCrcs;
+	}
+
+	/* The words of a generated table, back to bytes */
+	std::vector<uint8_t> TableBytes(const std::string &Table)
+	{
+		char Path[] = "/tmp/PackageTestXXXXXX";
+		int Fd = mkstemp(Path);
+		FILE *File = fdopen(Fd, "w");
+		std::vector<uint8_t> Bytes;
+
+		std::fputs(Table.c_str(), File);
+		std::fclose(File);
+		Bytes = SampleApplication(Path);
+		std::remove(Path);
+		return Bytes;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	std::mt19937 Random(36);
+	std::vector<uint8_t> Image(5000);
+	std::vector<uint8_t> Padded;
+	std::vector<uint8_t> Container;
+	Package::Options Settings;
+	Package::Contents Packed;
+
+	for (size_t i = 0; i < Image.size(); i++)
+	{
+		Image[i] = (i < 3000) ? (uint8_t)Random() : 0xFF;
+	}
+	Padded = Package::PadToPages(Image);
+	Check(Padded.size() == 5 * Protocol::FlashPageSize && Padded[4999] == Image[4999] && Padded[5000] == 0xFF,
+	      "padded to whole pages");
+	Check(Package::PadToPages(Padded) == Padded, "padding whole pages");
+
+	Settings.Version = 3;
+	Packed = Package::Pack(Padded, Settings);
+	Check(Packed.Header.Length == Padded.size() && Packed.Header.StreamSize == Padded.size() &&
+	      Packed.Header.LoadAddress == Protocol::NewFirmwareAddress && Packed.Header.Version == 3 &&
+	      Packed.Header.ImageCrc == SRV_CRC_Update(CRC_INITIAL, Padded.data(), (uint32_t)Padded.size()), "plain header");
+	Check(Packed.PageCrcs.size() == 5 &&
+	      Packed.PageCrcs[1] == SRV_CRC_Update(CRC_INITIAL, &Padded[Protocol::FlashPageSize], Protocol::FlashPageSize),
+	      "page crcs");
+	/* The last page is checked as programmed, erased past the image */
+	Check(Package::Pack(Image, Settings).PageCrcs == Packed.PageCrcs, "page crcs of an unpadded image");
+
+	Container = Package::Serialize(Packed);
+	Check(Same(Package::Parse(Container), Packed), "container round trip");
+	Check(std::vector<uint8_t>(Container.begin() + Package::ContainerHeaderSize,
+	                           Container.begin() + Package::ContainerHeaderSize + IMAGE_HEADER_SIZE + Packed.Stream.size()) ==
+	      Package::Payload(Packed), "the container holds the session");
+
+	for (size_t Offset : {0UL, 4UL, 20UL, 100UL, Container.size() - 20, Container.size() - 1})
+	{
+		std::vector<uint8_t> Corrupt = Container;
+
+		Corrupt[Offset] ^= 0x10;
+		Check(Refused(Corrupt), "corrupted container");
+	}
+	Check(Refused(std::vector<uint8_t>(Container.begin(), Container.end() - 4)), "truncated container");
+	Check(Refused({}), "empty container");
+
+	/* An image linked for the other slot */
+	Settings.LoadAddress = Protocol::SlotBAddress;
+	Packed = Package::Pack(Padded, Settings);
+	Check(Packed.Header.LoadAddress == Protocol::SlotBAddress &&
+	      Package::Parse(Package::Serialize(Packed)).Header.LoadAddress == Protocol::SlotBAddress, "slot B package");
+	Settings.LoadAddress = 0x08000000;
+	Check(Refused(Package::Serialize(Package::Pack(Padded, Settings))), "package for the bootloader area");
+	Settings.LoadAddress = Protocol::NewFirmwareAddress;
+
+	Settings.Compress = true;
+	Packed = Package::Pack(Padded, Settings);
+	Check(Packed.Header.Flags == IMAGE_FLAG_LZSS && Packed.Stream.size() < Padded.size(), "compressed package");
+	Check(Same(Package::Parse(Package::Serialize(Packed)), Packed), "compressed container round trip");
+
+	Settings.Compress = false;
+	Settings.Base = &Image;
+	Packed = Package::Pack(Padded, Settings);
+	Check(Packed.Header.Flags == IMAGE_FLAG_DELTA && Packed.Header.BaseLength == Image.size() &&
+	      Packed.Header.BaseCrc == SRV_CRC_Update(CRC_INITIAL, Image.data(), (uint32_t)Image.size()), "delta package");
+	Check(Same(Package::Parse(Package::Serialize(Packed)), Packed), "delta container round trip");
+
+	Settings.Base = nullptr;
+	try
+	{
+		Package::Pack(std::vector<uint8_t>(Protocol::SlotSize + 1), Settings);
+		Check(false, "image larger than the slot");
+	}
+	catch (const std::runtime_error &)
+	{
+	}
+
+	/* Odd stream sizes end in a padded frame, dataToWriteSize keeps the real size */
+	Packed = Package::Pack(std::vector<uint8_t>(Image.begin(), Image.end() - 1), Settings);
+	Check(TableBytes(Package::CTable(Packed, "Table.c")) == Package::Payload(Packed), "C table");
+	/* Records of frames 0 and 1: identifier with the sequence bit and TXRQ, then the DLC */
+	Check(Package::CTable(Packed, "Table.c").find("{0x24600001, 0x00000008, ") != std::string::npos &&
+	      Package::CTable(Packed, "Table.c").find("{0x24400001, 0x00000008, ") != std::string::npos,
+	      "mailbox records");
+
+	/* The sender's sample is the table the packer writes for its image */
+	if (argc > 1)
+	{
+		std::vector<uint8_t> Application = SampleApplication(argv[1]);
+		std::ifstream File(argv[1]);
+		std::stringstream Text;
+		SRV_IMAGE_Header_t Header;
+
+		Text << File.rdbuf();
+		Check(Application.size() > IMAGE_HEADER_SIZE &&
+		      SRV_IMAGE_Parse(Application.data(), Protocol::NewFirmwareAddress, Protocol::SlotSize, &Header) == IMAGE_OK,
+		      "sample header");
+		Settings.Version = Header.Version;
+		Packed = Package::Pack(std::vector<uint8_t>(Application.begin() + IMAGE_HEADER_SIZE, Application.end()), Settings);
+		Check(Package::CTable(Packed, "Application-HEX.c") == Text.str(), "sample regenerated by the packer");
+	}
+	return TestResult();
+}
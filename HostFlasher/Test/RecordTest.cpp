@@ -0,0 +1,269 @@
+/*================================================================
+ * 	File Name: RecordTest.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Image.hpp"
+#include "TestSupport.hpp"
+
+extern "C"
+{
+#include "SRV/RECORD/RECORD.h"
+}
+
+namespace
+{
+	/* Extents handed out by the parser, laid out from Origin, the records of the error cases are dropped */
+	constexpr uint32_t Origin = 0x08000000;
+	std::vector<uint8_t> Parsed;
+	size_t Extents = 0;
+
+	void Collect(uint32_t Address, const uint8_t *Data, uint32_t Length)
+	{
+		if (Address < Origin)
+		{
+			return;
+		}
+		if (Address - Origin + Length > Parsed.size())
+		{
+			Parsed.resize(Address - Origin + Length, 0xFF);
+		}
+		std::copy(Data, Data + Length, Parsed.begin() + (Address - Origin));
+		Extents++;
+	}
+
+	void Discard(uint32_t, const uint8_t *, uint32_t)
+	{
+	}
+
+	std::string Line(const std::string &Start, const std::vector<uint8_t> &Bytes, uint8_t FinalSum)
+	{
+		static const char Digits[] = "0123456789ABCDEF";
+		std::string Text = Start;
+		uint8_t Sum = 0;
+
+		for (uint8_t Byte : Bytes)
+		{
+			Sum = (uint8_t)(Sum + Byte);
+		}
+		for (uint8_t Byte : Bytes)
+		{
+			Text += Digits[Byte >> 4];
+			Text += Digits[Byte & 0x0F];
+		}
+		Sum = (uint8_t)(FinalSum - Sum);
+		Text += Digits[Sum >> 4];
+		Text += Digits[Sum & 0x0F];
+		return Text + "\r\n";
+	}
+
+	std::string HexRecord(uint8_t Type, uint16_t Address, const std::vector<uint8_t> &Data)
+	{
+		std::vector<uint8_t> Bytes = {(uint8_t)Data.size(), (uint8_t)(Address >> 8), (uint8_t)Address, Type};
+
+		Bytes.insert(Bytes.end(), Data.begin(), Data.end());
+		return Line(":", Bytes, 0x00);
+	}
+
+	std::string SrecRecord(char Type, uint32_t Address, const std::vector<uint8_t> &Data)
+	{
+		unsigned AddressSize = (Type == '0' || Type == '1' || Type == '5' || Type == '9') ? 2
+		                     : (Type == '2' || Type == '6' || Type == '8')                ? 3
+		                                                                                  : 4;
+		std::vector<uint8_t> Bytes = {(uint8_t)(AddressSize + Data.size() + 1)};
+
+		for (unsigned i = AddressSize; i > 0; i--)
+		{
+			Bytes.push_back((uint8_t)(Address >> (8 * (i - 1))));
+		}
+		Bytes.insert(Bytes.end(), Data.begin(), Data.end());
+		return Line(std::string("S") + Type, Bytes, 0xFF);
+	}
+
+	/* What objcopy writes: 16 bytes per record, an extended linear address every 64KB */
+	std::string ToHex(const std::vector<uint8_t> &Image)
+	{
+		std::string Text;
+
+		for (size_t i = 0; i < Image.size(); i += 16)
+		{
+			uint32_t Address = Origin + (uint32_t)i;
+
+			if (i == 0 || (Address & 0xFFFF) == 0)
+			{
+				Text += HexRecord(0x04, 0, {(uint8_t)(Address >> 24), (uint8_t)(Address >> 16)});
+			}
+			Text += HexRecord(0x00, (uint16_t)Address,
+			                  std::vector<uint8_t>(Image.begin() + i, Image.begin() + std::min(i + 16, Image.size())));
+		}
+		Text += HexRecord(0x05, 0, {0x08, 0x00, 0x01, 0x01});
+		return Text + HexRecord(0x01, 0, {});
+	}
+
+	std::string ToSrec(const std::vector<uint8_t> &Image)
+	{
+		std::string Text = SrecRecord('0', 0, {'t', 'e', 's', 't'});
+
+		for (size_t i = 0; i < Image.size(); i += 32)
+		{
+			Text += SrecRecord('3', Origin + (uint32_t)i,
+			                   std::vector<uint8_t>(Image.begin() + i, Image.begin() + std::min(i + 32, Image.size())));
+		}
+		Text += SrecRecord('5', (uint32_t)((Image.size() + 31) / 32), {});
+		return Text + SrecRecord('7', 0x08000101, {});
+	}
+
+	/* Feed the text in chunks of random size, cut anywhere */
+	uint8_t FeedChunks(const std::string &Text, std::mt19937 &Random, unsigned MaxChunk)
+	{
+		uint8_t Status = RECORD_OK;
+		size_t Position = 0;
+
+		Parsed.clear();
+		Extents = 0;
+		SRV_RECORD_Init(Collect);
+		while (Status == RECORD_OK && Position < Text.size())
+		{
+			size_t Chunk = std::min<size_t>(1 + Random() % MaxChunk, Text.size() - Position);
+
+			Status = SRV_RECORD_Feed((const uint8_t *)&Text[Position], (uint32_t)Chunk);
+			Position += Chunk;
+		}
+		return (Status == RECORD_OK) ? SRV_RECORD_Finish() : Status;
+	}
+
+	uint8_t FeedAll(const std::string &Text)
+	{
+		uint8_t Status;
+
+		Parsed.clear();
+		SRV_RECORD_Init(Collect);
+		Status = SRV_RECORD_Feed((const uint8_t *)Text.data(), (uint32_t)Text.size());
+		return (Status == RECORD_OK) ? SRV_RECORD_Finish() : Status;
+	}
+
+	void TestStreaming(const std::vector<uint8_t> &Image, std::mt19937 &Random)
+	{
+		std::string Hex = ToHex(Image);
+		std::string Srec = ToSrec(Image);
+
+		for (unsigned MaxChunk : {1U, 2U, 3U, 7U, 64U, 4096U})
+		{
+			Check(FeedChunks(Hex, Random, MaxChunk) == RECORD_END && Parsed == Image, "hex in chunks");
+			Check(Extents == (Image.size() + 15) / 16 && SRV_RECORD_GetFormat() == RECORD_FORMAT_HEX &&
+			      SRV_RECORD_GetEntry() == 0x08000101, "hex extents and start address");
+			Check(FeedChunks(Srec, Random, MaxChunk) == RECORD_END && Parsed == Image, "srec in chunks");
+			Check(SRV_RECORD_GetFormat() == RECORD_FORMAT_SREC && SRV_RECORD_GetEntry() == 0x08000101,
+			      "srec start address");
+		}
+
+		/* Lower case digits and LF line ends are accepted as well */
+		std::string Relaxed = Hex;
+		std::transform(Relaxed.begin(), Relaxed.end(), Relaxed.begin(), [](char C) { return (char)std::tolower(C); });
+		Relaxed.erase(std::remove(Relaxed.begin(), Relaxed.end(), '\r'), Relaxed.end());
+		Check(FeedAll(Relaxed) == RECORD_END && Parsed == Image, "lower case hex");
+
+		/* Nothing past the end of file record is looked at */
+		Check(FeedAll(Hex + "garbage") == RECORD_END, "text after the end record");
+		/* Missing end record */
+		Check(FeedAll(Hex.substr(0, Hex.size() - 13)) == RECORD_END && Parsed == Image, "hex without end record");
+
+		Check(Image::FromSRecord(Srec).Bytes() == Image::FromIntelHex(Hex).Bytes() &&
+		      Image::FromSRecord(Srec).BaseAddress() == Origin, "S-record image");
+	}
+
+	void TestErrors()
+	{
+		std::string Good = HexRecord(0x00, 0x0000, {1, 2, 3, 4}) + HexRecord(0x00, 0x0004, {5, 6, 7, 8});
+		std::string Text;
+
+		Text = Good;
+		Text[Text.find("05060708") + 1] = '4';
+		Check(FeedAll(Text) == RECORD_BAD_CHECKSUM && SRV_RECORD_GetLine() == 2, "checksum error and its line");
+		Text = Good;
+		Text[Text.find("0102") + 1] = 'G';
+		Check(FeedAll(Text) == RECORD_BAD_CHAR && SRV_RECORD_GetLine() == 1, "bad digit");
+		Check(FeedAll(Good.substr(0, 15)) == RECORD_BAD_LENGTH, "file ending inside a record");
+		Check(FeedAll(":0400000001020304\r\n") == RECORD_BAD_LENGTH, "record shorter than its count");
+		Check(FeedAll(Good.substr(0, Good.find('\r')) + "00\r\n") == RECORD_BAD_LENGTH, "record longer than its count");
+		Check(FeedAll(HexRecord(0x06, 0, {})) == RECORD_BAD_TYPE, "unknown hex type");
+		Check(FeedAll(HexRecord(0x04, 0, {0x08})) == RECORD_BAD_LENGTH, "short extended address");
+		Check(FeedAll("S4030000FC\r\n") == RECORD_BAD_TYPE, "unknown srec type");
+		Check(FeedAll("S30400000000FB\r\n") == RECORD_BAD_LENGTH, "srec count shorter than its address");
+		Check(FeedAll(Good + SrecRecord('1', 0, {1})) == RECORD_BAD_CHAR, "formats mixed in one file");
+		Check(FeedAll("\r\n\r\nx") == RECORD_BAD_CHAR && SRV_RECORD_GetLine() == 3, "not a record");
+
+		/* An error sticks */
+		SRV_RECORD_Init(Collect);
+		SRV_RECORD_Feed((const uint8_t *)"x", 1);
+		Check(SRV_RECORD_Feed((const uint8_t *)Good.data(), (uint32_t)Good.size()) == RECORD_BAD_CHAR, "sticky error");
+
+		try
+		{
+			Image::FromSRecord(Good);
+			Check(false, "hex refused as S-record");
+		}
+		catch (const std::runtime_error &)
+		{
+		}
+	}
+
+	/* Parse the text of a large image in the chunk size of a file read or a UART DMA ring */
+	void Benchmark(const std::string &Name, const std::string &Text, size_t Chunk)
+	{
+		const int Rounds = 8;
+		auto Start = std::chrono::steady_clock::now();
+		uint8_t Status = RECORD_OK;
+
+		for (int Round = 0; Round < Rounds; Round++)
+		{
+			SRV_RECORD_Init(Discard);
+			for (size_t Position = 0; Position < Text.size(); Position += Chunk)
+			{
+				Status = SRV_RECORD_Feed((const uint8_t *)&Text[Position],
+				                         (uint32_t)std::min(Chunk, Text.size() - Position));
+			}
+		}
+		double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+
+		Check(Status == RECORD_END, "benchmark text parsed");
+		std::printf("%-5s %5zu byte chunks: %7.1f MB/s of text\n", Name.c_str(), Chunk,
+		            Rounds * Text.size() / Seconds / 1e6);
+	}
+}
+
+int main()
+{
+	std::mt19937 Random(40);
+	std::vector<uint8_t> Image(70000);
+	std::vector<uint8_t> Large(4 * 1024 * 1024);
+
+	for (uint8_t &Byte : Image)
+	{
+		Byte = (uint8_t)Random();
+	}
+	TestStreaming(Image, Random);
+	TestErrors();
+
+	for (uint8_t &Byte : Large)
+	{
+		Byte = (uint8_t)Random();
+	}
+	std::string Hex = ToHex(Large);
+	std::string Srec = ToSrec(Large);
+	for (size_t Chunk : {64UL, 4096UL})
+	{
+		Benchmark("hex", Hex, Chunk);
+		Benchmark("srec", Srec, Chunk);
+	}
+	return TestResult();
+}
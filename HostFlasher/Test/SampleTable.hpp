@@ -0,0 +1,56 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: SampleTable.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Reader of the dataToWrite table of Firmware_Sender, the sample image
+ * the tests run on.
+ */
+#ifndef SAMPLE_TABLE_HPP_
+#define SAMPLE_TABLE_HPP_
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/* Session bytes of Firmware_Sender/Core/Src/Application-HEX.c: the image header and the stream */
+inline std::vector<uint8_t> SampleApplication(const char *Path)
+{
+	std::ifstream File(Path);
+	std::stringstream Text;
+	std::vector<uint8_t> Bytes;
+	std::string Content;
+	size_t Position;
+	size_t Size;
+
+	Text << File.rdbuf();
+	Content = Text.str();
+	Position = Content.find("[] = {");
+	/* Records of TIR, TDTR, TDLR and TDHR, the payload is in the last two words */
+	for (unsigned Word = 0; Position != std::string::npos && (Position = Content.find("0x", Position)) != std::string::npos;
+	     Word++)
+	{
+		uint32_t Value = (uint32_t)std::strtoul(Content.c_str() + Position, nullptr, 16);
+
+		for (unsigned i = 0; (Word % 4) >= 2 && i < 4; i++)
+		{
+			Bytes.push_back((uint8_t)(Value >> (8 * i)));
+		}
+		Position += 2;
+	}
+	/* The last frame is padded */
+	Position = Content.find("dataToWriteSize = ");
+	if (Position != std::string::npos)
+	{
+		Size = std::strtoul(Content.c_str() + Position + 18, nullptr, 0);
+		Bytes.resize(std::min(Size, Bytes.size()));
+	}
+	return Bytes;
+}
+
+#endif /* SAMPLE_TABLE_HPP_ */
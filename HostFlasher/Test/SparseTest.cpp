@@ -0,0 +1,90 @@
+/*================================================================
+ * 	File Name: SparseTest.cpp
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Sparse.hpp"
+#include "TestSupport.hpp"
+
+extern "C"
+{
+#include "SRV/SPARSE/SPARSE.h"
+}
+
+namespace
+{
+	bool Expand(const std::vector<uint8_t> &Stream, size_t Size, uint32_t InputStep, uint32_t OutputStep,
+	            std::vector<uint8_t> &Output)
+	{
+		SRV_SPARSE_Init();
+		return DecodeInChunks(SRV_SPARSE_Expand, SPARSE_OK, Stream, Size, InputStep, OutputStep, Output);
+	}
+
+	size_t RoundTrip(const std::vector<uint8_t> &Input, const char *What)
+	{
+		std::vector<uint8_t> Stream = Sparse::Encode(Input);
+		std::vector<uint8_t> Output;
+
+		Check(Expand(Stream, Input.size(), 8, 1024, Output) && Output == Input, What);
+		Check(Expand(Stream, Input.size(), 8, 7, Output) && Output == Input, What);
+		Check(Expand(Stream, Input.size(), 1, 1, Output) && Output == Input, What);
+		return Stream.size();
+	}
+}
+
+int main()
+{
+	std::mt19937 Random(37);
+	std::vector<uint8_t> Noise(5000);
+	std::vector<uint8_t> Gapped(30 * 1024, 0xFF);
+	std::vector<uint8_t> Output(64);
+	const std::vector<uint8_t> Unknown = {0x07, 0x01, 0xAA};
+	const std::vector<uint8_t> Empty = {SPARSE_OP_FILL, 0x00, 0xFF};
+	size_t Size;
+
+	for (uint8_t &Byte : Noise)
+	{
+		Byte = (uint8_t)Random();
+	}
+	/* Vector table, code, an alignment gap, a zeroed table and a block at the end of the slot */
+	for (size_t i = 0; i < 6000; i++)
+	{
+		Gapped[i] = (uint8_t)Random();
+	}
+	std::fill(Gapped.begin() + 9000, Gapped.begin() + 10000, 0x00);
+	for (size_t i = 29 * 1024; i < Gapped.size() - 100; i++)
+	{
+		Gapped[i] = (uint8_t)Random();
+	}
+
+	Size = RoundTrip(Noise, "random data");
+	Check(Size <= Noise.size() + 8, "random data grows by an extent header");
+	Size = RoundTrip(Gapped, "gapped image");
+	Check(Size < 6000 + 1024 + 32, "gaps are not sent");
+	std::printf("gapped image: %zu -> %zu bytes (%.1f%%)\n", Gapped.size(), Size, 100.0 * (double)Size / (double)Gapped.size());
+	RoundTrip(std::vector<uint8_t>(3000, 0xFF), "erased");
+	RoundTrip(std::vector<uint8_t>(15, 0x00), "run shorter than a fill");
+	RoundTrip({0x42}, "single byte");
+
+	/* Two runs of different values next to each other */
+	std::vector<uint8_t> Runs(100, 0x00);
+	std::fill(Runs.begin() + 50, Runs.end(), 0xFF);
+	Check(Sparse::Encode(Runs).size() == 6, "two fills");
+	RoundTrip(Runs, "two fills");
+
+	uint32_t Consumed = (uint32_t)Unknown.size();
+	uint32_t Space = (uint32_t)Output.size();
+	SRV_SPARSE_Init();
+	Check(SRV_SPARSE_Expand(Unknown.data(), &Consumed, Output.data(), &Space) == SPARSE_CORRUPT, "unknown tag");
+	Consumed = (uint32_t)Empty.size();
+	Space = (uint32_t)Output.size();
+	SRV_SPARSE_Init();
+	Check(SRV_SPARSE_Expand(Empty.data(), &Consumed, Output.data(), &Space) == SPARSE_CORRUPT, "empty extent");
+
+	return TestResult();
+}
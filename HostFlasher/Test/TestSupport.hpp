@@ -0,0 +1,69 @@
+/*================================================================
+ *	Project Name: HostFlasher
+ * 	File Name: TestSupport.hpp
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Checks shared by the tests, and the driver that runs one of the
+ * streaming decoders of Firmware_Receiver (SRV/LZSS, SRV/DELTA,
+ * SRV/SPARSE) the way SRV/UPDATER does: the stream fed in frames, the
+ * output drained into small buffers.
+ */
+#ifndef TEST_SUPPORT_HPP_
+#define TEST_SUPPORT_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/* Failed checks of the test */
+inline int Failures = 0;
+
+inline void Check(bool Condition, const char *What)
+{
+	if (!Condition)
+	{
+		std::fprintf(stderr, "FAIL: %s\n", What);
+		Failures++;
+	}
+}
+
+/* Exit status of the test */
+inline int TestResult()
+{
+	return (Failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* Feed the stream to Decode in frames of InputStep bytes and drain it into buffers of OutputStep bytes,
+   the decoder is initialized by the caller. True once Size bytes are out and the whole stream is read. */
+template <typename Decoder, typename Status>
+bool DecodeInChunks(Decoder Decode, Status Ok, const std::vector<uint8_t> &Stream, size_t Size, uint32_t InputStep,
+                    uint32_t OutputStep, std::vector<uint8_t> &Output)
+{
+	size_t Read = 0;
+
+	/* Not a value the decoders write by chance */
+	Output.assign(Size, 0x55);
+	for (size_t Written = 0; Written < Size;)
+	{
+		uint32_t Consumed = (uint32_t)std::min<size_t>(InputStep, Stream.size() - Read);
+		uint32_t Space = (uint32_t)std::min<size_t>(OutputStep, Size - Written);
+
+		if (Decode(Stream.data() + Read, &Consumed, Output.data() + Written, &Space) != Ok)
+		{
+			return false;
+		}
+		if (Consumed == 0 && Space == 0)
+		{
+			return false;
+		}
+		Read += Consumed;
+		Written += Space;
+	}
+	return Read == Stream.size();
+}
+
+#endif /* TEST_SUPPORT_HPP_ */
@@ -0,0 +1,52 @@
+#!/bin/sh
+# Flash the emulated receiver over vcan0 with a random image and compare,
+# then once more with a compressed session, with a delta against that image
+# and with a container of ImagePacker.
+# Skipped (77) when the interface does not exist, create it with:
+#   sudo modprobe vcan && sudo ip link add dev vcan0 type vcan && sudo ip link set up vcan0
+FLASHER="$1"
+EMULATOR="$2"
+WORK="${3:-.}"
+PACKER="$4"
+IFACE=vcan0
+SIZE=6856
+
+[ -d "/sys/class/net/$IFACE" ] || { echo "$IFACE not available, skipped"; exit 77; }
+
+# Half random, half erased, so the compressed run has something to gain
+head -c "$((SIZE / 2))" /dev/urandom > "$WORK/loopback_in.bin"
+head -c "$((SIZE - SIZE / 2))" /dev/zero | tr '\000' '\377' >> "$WORK/loopback_in.bin"
+
+for MODE in "" --compress --sparse; do
+	rm -f "$WORK/loopback_out.bin"
+	"$EMULATOR" -i "$IFACE" -o "$WORK/loopback_out.bin" --drop 2000 --timeout 60 &
+	EMU=$!
+	sleep 0.2
+	"$FLASHER" -i "$IFACE" $MODE "$WORK/loopback_in.bin" || { kill "$EMU" 2>/dev/null; exit 1; }
+	wait "$EMU" || exit 1
+	cmp "$WORK/loopback_in.bin" "$WORK/loopback_out.bin" || exit 1
+done
+
+# A patch release of the same image, linked for slot B next to the running image in
+# slot A and sent as a delta against it
+cp "$WORK/loopback_in.bin" "$WORK/loopback_patch.bin"
+printf 'patched' | dd of="$WORK/loopback_patch.bin" bs=1 seek=1000 conv=notrunc 2>/dev/null
+rm -f "$WORK/loopback_out.bin"
+"$EMULATOR" -i "$IFACE" -o "$WORK/loopback_out.bin" --initial "$WORK/loopback_in.bin" --drop 2000 --timeout 60 &
+EMU=$!
+sleep 0.2
+"$FLASHER" -i "$IFACE" --base 0x08015400 --delta "$WORK/loopback_in.bin" "$WORK/loopback_patch.bin" || { kill "$EMU" 2>/dev/null; exit 1; }
+wait "$EMU" || exit 1
+cmp "$WORK/loopback_patch.bin" "$WORK/loopback_out.bin" || exit 1
+
+# The packed patch release, padded to whole pages
+"$PACKER" --version 2 -o "$WORK/loopback_patch.fwc" "$WORK/loopback_patch.bin" > /dev/null || exit 1
+cp "$WORK/loopback_patch.bin" "$WORK/loopback_padded.bin"
+head -c "$((7 * 1024 - SIZE))" /dev/zero | tr '\000' '\377' >> "$WORK/loopback_padded.bin"
+rm -f "$WORK/loopback_out.bin"
+"$EMULATOR" -i "$IFACE" -o "$WORK/loopback_out.bin" --drop 2000 --timeout 60 &
+EMU=$!
+sleep 0.2
+"$FLASHER" -i "$IFACE" "$WORK/loopback_patch.fwc" || { kill "$EMU" 2>/dev/null; exit 1; }
+wait "$EMU" || exit 1
+cmp "$WORK/loopback_padded.bin" "$WORK/loopback_out.bin" || exit 1
@@ -0,0 +1,251 @@
+/*================================================================
+ *	Project Name: Simulation
+ * 	File Name: SIM.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Discrete event co-simulation of the boards taking part in an update.
+ *
+ * Every node runs its unmodified firmware loop on its own stack. The
+ * firmware only ever waits by polling a peripheral (timer, CAN mailbox,
+ * FPEC busy flag), each such access costs simulated CPU time and hands
+ * control back to the scheduler, which always resumes the node that is
+ * furthest behind and moves the CAN bus up to that point in time. Pending
+ * interrupts of a node are taken when it resumes, unless it masked them
+ * with __disable_irq.
+ */
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+
+typedef struct SIM_Node SIM_Node_t;
+
+/* Interrupt lines of a node */
+#define SIM_IRQ_CAN_RX0             (1UL << 0)
+#define SIM_IRQ_CAN_SCE             (1UL << 1)
+
+/**
+ * @brief Create a node running Main on its own stack.
+ *
+ * @param Name Name used in reports.
+ * @param Main Firmware entry point, the node stops when it returns.
+ * @return SIM_Node_t* The node.
+ */
+SIM_Node_t *SIM_NodeCreate(const char *Name, void (*Main)(void));
+
+/**
+ * @brief Restart a node from its entry point, as after a power cycle.
+ *
+ * @details Its CAN controller is reset and its time keeps running. The flash
+ * model keeps its content.
+ *
+ * @param Node Node to reset.
+ * @return None
+ */
+void SIM_NodeReset(SIM_Node_t *Node);
+
+/**
+ * @brief Check whether the firmware of a node returned.
+ *
+ * @param Node Node to check.
+ * @return uint8_t 1 once the entry point returned.
+ */
+uint8_t SIM_NodeFinished(const SIM_Node_t *Node);
+
+/**
+ * @brief Run the nodes until Watch finished or the simulated time reached UntilNs.
+ *
+ * @param Watch Node whose end stops the run, NULL to wait for all nodes.
+ * @param UntilNs Simulated time limit in ns.
+ * @return uint64_t Simulated time reached, in ns.
+ */
+uint64_t SIM_Run(const SIM_Node_t *Watch, uint64_t UntilNs);
+
+/**
+ * @brief Get the node currently executing.
+ *
+ * @param None
+ * @return SIM_Node_t* Current node, NULL outside of a node.
+ */
+SIM_Node_t *SIM_Current(void);
+
+/**
+ * @brief Get the simulated time of the current node.
+ *
+ * @param None
+ * @return uint64_t Time in ns.
+ */
+uint64_t SIM_Now(void);
+
+/**
+ * @brief Spend CPU time on the current node and let the other nodes catch up.
+ *
+ * @param Ns CPU time in ns.
+ * @return None
+ */
+void SIM_Consume(uint64_t Ns);
+
+/**
+ * @brief Raise an interrupt line of a node.
+ *
+ * @param Node Target node.
+ * @param Irq SIM_IRQ_* line.
+ * @return None
+ */
+void SIM_RaiseIrq(SIM_Node_t *Node, uint32_t Irq);
+
+/**
+ * @brief Get the CAN controller of a node.
+ *
+ * @param Node Node.
+ * @return CAN_TypeDef* Register model of its CAN1.
+ */
+CAN_TypeDef *SIM_NodeCan(SIM_Node_t *Node);
+
+/**
+ * @brief Register the handle whose callbacks serve the CAN interrupts of the current node.
+ *
+ * @param hcan Handle of the node's CAN1.
+ * @return None
+ */
+void SIM_NodeAttachCan(CAN_HandleTypeDef *hcan);
+
+/**
+ * @brief Get the handle registered with SIM_NodeAttachCan.
+ *
+ * @param Node Node.
+ * @return CAN_HandleTypeDef* Handle, NULL if none was registered.
+ */
+CAN_HandleTypeDef *SIM_NodeCanHandle(SIM_Node_t *Node);
+
+/**
+ * @brief Get the index of a node in creation order.
+ *
+ * @param Node Node.
+ * @return uint8_t Index.
+ */
+uint8_t SIM_NodeIndex(const SIM_Node_t *Node);
+
+/**
+ * @brief Get the name of a node.
+ *
+ * @param Node Node.
+ * @return const char* Name given to SIM_NodeCreate.
+ */
+const char *SIM_NodeName(const SIM_Node_t *Node);
+
+/**
+ * @brief Get a node by its index.
+ *
+ * @param Index Index in creation order.
+ * @return SIM_Node_t* Node, NULL past the last node.
+ */
+SIM_Node_t *SIM_NodeAt(uint8_t Index);
+
+/*========================= CAN bus model =========================*/
+
+typedef struct
+{
+	uint64_t Frames;            /* Frames transmitted without error */
+	uint64_t ErrorFrames;       /* Frames destroyed by an injected bit error */
+	uint64_t DroppedFrames;     /* Frames lost by the receivers (injected FIFO loss) */
+	uint64_t Overruns;          /* Frames lost on a full receive FIFO */
+	uint64_t BusyNs;            /* Time the bus was not idle */
+} SIM_CanStats_t;
+
+/**
+ * @brief Configure fault injection on the bus.
+ *
+ * @param ErrorPpm Probability in ppm that a frame is destroyed by a bit error
+ *        (error frame, the transmitter retries automatically).
+ * @param DropPpm Probability in ppm that a correct frame is lost by its
+ *        receivers, as on a FIFO overrun.
+ * @param Seed Seed of the pseudo random generator.
+ * @return None
+ */
+void SIM_CAN_SetFaults(uint32_t ErrorPpm, uint32_t DropPpm, uint32_t Seed);
+
+/**
+ * @brief Serve a CAN interrupt line of a node, called by the scheduler.
+ *
+ * @param Node Interrupted node, it is the current node.
+ * @param Irq SIM_IRQ_CAN_RX0 or SIM_IRQ_CAN_SCE.
+ * @return None
+ */
+void SIM_CAN_Interrupt(SIM_Node_t *Node, uint32_t Irq);
+
+/**
+ * @brief Move the bus up to a point in time, called by the scheduler.
+ *
+ * @param Ns Simulated time in ns.
+ * @return None
+ */
+void SIM_CAN_Advance(uint64_t Ns);
+
+/**
+ * @brief Take the transmit requests a node made by storing TXRQ into a mailbox, called by the scheduler.
+ *
+ * @details Requests made through HAL_CAN_AddTxMessage are taken right away.
+ *
+ * @param Can Register model of the node.
+ * @param Ns Time of the stores, in ns.
+ * @return None
+ */
+void SIM_CAN_TakeRequests(CAN_TypeDef *Can, uint64_t Ns);
+
+/**
+ * @brief Reset the CAN controller of a node.
+ *
+ * @param Can Register model.
+ * @return None
+ */
+void SIM_CAN_Reset(CAN_TypeDef *Can);
+
+/**
+ * @brief Get the bus statistics.
+ *
+ * @param None
+ * @return const SIM_CanStats_t* Statistics since start.
+ */
+const SIM_CanStats_t *SIM_CAN_GetStats(void);
+
+/*========================= Flash model =========================*/
+
+typedef struct
+{
+	uint64_t PageErases;
+	uint64_t HalfWordWrites;
+	uint64_t ProgramErrors;     /* Half-words programmed over a non erased location */
+	uint64_t BusyNs;            /* Time the flash was busy */
+} SIM_FlashStats_t;
+
+/**
+ * @brief Map the simulated flash at its real address, erased.
+ *
+ * @param None
+ * @return None
+ */
+void SIM_FLASH_Init(void);
+
+/**
+ * @brief Get the flash statistics.
+ *
+ * @param None
+ * @return const SIM_FlashStats_t* Statistics since SIM_FLASH_Init.
+ */
+const SIM_FlashStats_t *SIM_FLASH_GetStats(void);
+
+/**
+ * @brief Put content into the flash before the run, as an earlier update left it.
+ *
+ * @param Address Flash address of the first byte.
+ * @param Data Bytes to place.
+ * @param Length Number of bytes.
+ * @return None
+ */
+void SIM_FLASH_Load(uint32_t Address, const uint8_t *Data, uint32_t Length);
+
+#endif /* SIM_H_ */
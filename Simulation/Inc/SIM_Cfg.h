@@ -0,0 +1,36 @@
+/*================================================================
+ *	Project Name: Simulation
+ * 	File Name: SIM_Cfg.h
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+
+#ifndef SIM_CFG_H_
+#define SIM_CFG_H_
+
+/* Core and APB1 clock of both boards (HSI, no PLL). */
+#define SIM_SYSCLK_HZ               8000000UL
+
+/* Simulated CPU time of one HAL call and of one peripheral register access. */
+#define SIM_HAL_CALL_NS             2000ULL
+#define SIM_REGISTER_ACCESS_NS      250ULL
+
+/* Exception entry and exit of an interrupt handler (12 + 12 cycles). */
+#define SIM_IRQ_OVERHEAD_NS         3000ULL
+
+/* One pass of a super loop that has nothing to do. */
+#define SIM_MAIN_LOOP_NS            1000ULL
+
+/* STM32F103 flash timings (datasheet typical values). */
+#define SIM_FLASH_PAGE_ERASE_NS     20000000ULL     /* 20ms per 1KB page */
+#define SIM_FLASH_PROGRAM_NS        52500ULL        /* 52.5us per half-word */
+
+/* Flash of the simulated receiver: 128 pages of 1KB from 0x08000000. */
+#define SIM_FLASH_BASE              0x08000000UL
+#define SIM_FLASH_SIZE              (128UL * 1024UL)
+#define SIM_FLASH_PAGE_SIZE         1024UL
+
+/* Stack of each simulated node. */
+#define SIM_NODE_STACK_SIZE         (256UL * 1024UL)
+#define SIM_MAX_NODES               4U
+
+#endif /* SIM_CFG_H_ */
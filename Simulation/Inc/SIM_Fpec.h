@@ -0,0 +1,35 @@
+/*================================================================
+ *	Project Name: Simulation
+ * 	File Name: SIM_Fpec.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Register model of the flash program and erase controller, used by
+ * FPEC_Private.h when the driver is built with SIMULATION defined.
+ * Register writes take effect on the next access, which is always a
+ * poll of FLASH_SR in the driver, so erase and program operations keep
+ * the controller busy for their datasheet duration.
+ */
+#ifndef SIM_FPEC_H_
+#define SIM_FPEC_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Access the FPEC registers.
+ *
+ * @param None
+ * @return volatile FPEC_t* Register model, after processing the previous writes.
+ */
+volatile FPEC_t *SIM_FPEC_Access(void);
+
+/**
+ * @brief Address a flash half-word for programming.
+ *
+ * @param Address Flash address.
+ * @return volatile uint16_t* Write latch, programmed on the next register access.
+ */
+volatile uint16_t *SIM_FPEC_HalfWord(uint32_t Address);
+
+#endif /* SIM_FPEC_H_ */
@@ -0,0 +1,122 @@
+/*================================================================
+ *	Project Name: Simulation
+ * 	File Name: SIM_Nodes.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Entry points of the two simulated boards. Each one repeats the start
+ * up of its firmware main.c (CAN configuration, filters, interrupts)
+ * against the host HAL and runs the unmodified protocol modules of
+ * Firmware_Receiver and Firmware_Sender. The receiving board runs either
+ * the standalone receiver or an application with SRV/AGENT.
+ */
+#ifndef SIM_NODES_H_
+#define SIM_NODES_H_
+
+#include <stdint.h>
+
+/* Number of CMD_BENCH_RESULT indexes read back by the sender */
+#define SIM_BENCH_RESULTS           4U
+
+typedef struct
+{
+	/* Set before the run */
+	uint32_t BenchSize;                         /* 0 for an image update, else a benchmark payload */
+	uint32_t DeltaBytes;                        /* Else bytes changed by a delta update against SIM_SenderImage */
+	uint32_t SparseGap;                         /* Else erased bytes between the image and its tail, sent as extents */
+
+	/* Filled in by the sender node */
+	const uint8_t *Payload;                     /* Bytes the receiver slot must hold at the end */
+	uint32_t SlotAddress;                       /* Slot of the receiver the payload is programmed into */
+	uint32_t PayloadSize;
+	uint32_t StreamSize;                        /* Bytes sent for an encoded payload */
+	uint8_t Completed;                          /* Every frame was acknowledged */
+	uint32_t ResumeFrame;                       /* Image frames the resume query skipped */
+	uint32_t Retransmissions;
+	uint16_t SmoothedRtt;                       /* TIM1 ticks */
+	uint32_t BenchResult[SIM_BENCH_RESULTS];    /* Receiver measurements, see BENCH.h */
+	uint8_t LinkRead;                           /* The receiver answered CMD_READ_LINK after a benchmark */
+	uint8_t Link[8];                            /* Its answer */
+} SIM_SenderRun_t;
+
+extern SIM_SenderRun_t SIM_SenderRun;
+
+typedef struct
+{
+	uint32_t JobUs;                             /* Set before the run: work of the application between two agent calls */
+	uint64_t LongestCallNs;                     /* Longest call of SRV_AGENT_MainFunction */
+	uint64_t AgentNs;                           /* Time spent in the agent, interrupts included */
+	uint64_t Calls;
+	uint32_t Leaves;                            /* Warm resets into the receiver, kept over them */
+	uint32_t Starts;                            /* Images started by the bootloader right after an update */
+	uint32_t TableRequests;                     /* Mailbox requests made through the bootloader's service table */
+} SIM_AgentRun_t;
+
+extern SIM_AgentRun_t SIM_AgentRun;
+
+/**
+ * @brief Image of the sender without its header, the slot content a delta update starts from.
+ *
+ * @param Length Receives the image size.
+ * @return const uint8_t* First byte of the image.
+ */
+const uint8_t *SIM_SenderImage(uint32_t *Length);
+
+/* Address of slot A, which a delta update finds its base in, and size of each slot of the receiver */
+extern const uint32_t SIM_ReceiverSlotAddress;
+extern const uint32_t SIM_ReceiverSlotSize;
+
+/**
+ * @brief Slot the bootloader of the receiver starts, read from the boot control pages.
+ *
+ * @param None
+ * @return uint32_t First address of the slot, 0 if no slot holds an image.
+ */
+uint32_t SIM_ReceiverActiveSlot(void);
+
+/**
+ * @brief Firmware of the receiver, returns where the target resets into the bootloader.
+ *
+ * @param None
+ * @return None
+ */
+void SIM_ReceiverMain(void);
+
+/**
+ * @brief Application running from slot A with the update agent, returns once the new image is active.
+ *
+ * @param None
+ * @return None
+ */
+void SIM_AgentMain(void);
+
+/**
+ * @brief Place the service table of the bootloader at BOOTAPI_ADDRESS, see SRV/BOOTAPI.
+ *
+ * @param None
+ * @return None
+ */
+void SIM_BootApiLoad(void);
+
+/**
+ * @brief Bootloader of the receiving board with the application in slot A.
+ *
+ * @details Starts the receiver if the boot mailbox asks for it, the
+ * application otherwise, as Custom_Bootloader does after a warm reset.
+ * Returns when the mailbox asks for the image just activated.
+ *
+ * @param None
+ * @return None
+ */
+void SIM_BootMain(void);
+
+/**
+ * @brief Firmware of the sender, returns once the transfer is over.
+ *
+ * @param None
+ * @return None
+ */
+void SIM_SenderMain(void);
+
+#endif /* SIM_NODES_H_ */
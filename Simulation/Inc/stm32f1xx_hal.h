@@ -0,0 +1,330 @@
+/*================================================================
+ *	Project Name: Simulation
+ * 	File Name: stm32f1xx_hal.h
+ * 	Created on: Oct 18, 2026
+ *================================================================
+ *  					File Description
+ *================================================================
+ * Host stand-in for the subset of the STM32F1 HAL and CMSIS used by the
+ * update stack. The bxCAN registers keep their real layout and bit
+ * definitions, the HAL_CAN_* functions of SIM_Can.c operate on them the
+ * way the real driver does. Peripheral instances (CAN1, DWT, timers)
+ * resolve to the node currently executing, see SIM.h.
+ */
+#ifndef STM32F1XX_HAL_H
+#define STM32F1XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*========================= Core =========================*/
+#define __IO            volatile
+#define ENABLE          1U
+#define DISABLE         0U
+
+typedef enum
+{
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef struct
+{
+	__IO uint32_t CTRL;
+	__IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+	__IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+
+DWT_Type *SIM_Dwt(void);
+CoreDebug_Type *SIM_CoreDebug(void);
+void SIM_DisableIrq(void);
+void SIM_EnableIrq(void);
+void SIM_SystemReset(void);
+
+#define DWT                 (SIM_Dwt())
+#define CoreDebug           (SIM_CoreDebug())
+#define __disable_irq()     SIM_DisableIrq()
+#define __enable_irq()      SIM_EnableIrq()
+#define NVIC_SystemReset()  SIM_SystemReset()
+#define __DSB()
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+/*========================= GPIO =========================*/
+typedef struct
+{
+	__IO uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef enum
+{
+	GPIO_PIN_RESET = 0U,
+	GPIO_PIN_SET
+} GPIO_PinState;
+
+GPIO_TypeDef *SIM_Gpio(uint8_t Port);
+
+#define GPIOA               (SIM_Gpio(0))
+#define GPIOB               (SIM_Gpio(1))
+#define GPIOC               (SIM_Gpio(2))
+#define GPIO_PIN_1          ((uint16_t)0x0002)
+#define GPIO_PIN_2          ((uint16_t)0x0004)
+#define GPIO_PIN_8          ((uint16_t)0x0100)
+#define GPIO_PIN_10         ((uint16_t)0x0400)
+#define GPIO_PIN_11         ((uint16_t)0x0800)
+#define GPIO_PIN_12         ((uint16_t)0x1000)
+#define GPIO_PIN_13         ((uint16_t)0x2000)
+#define GPIO_PIN_14         ((uint16_t)0x4000)
+#define GPIO_PIN_15         ((uint16_t)0x8000)
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+/*========================= TIM =========================*/
+typedef struct
+{
+	uint32_t Prescaler;
+	uint32_t Period;
+} TIM_Base_InitTypeDef;
+
+typedef struct
+{
+	TIM_Base_InitTypeDef Init;
+} TIM_HandleTypeDef;
+
+uint32_t SIM_TIM_GetCounter(TIM_HandleTypeDef *htim);
+
+#define __HAL_TIM_GET_COUNTER(HANDLE)   SIM_TIM_GetCounter(HANDLE)
+
+/*========================= bxCAN registers =========================*/
+typedef struct
+{
+	__IO uint32_t TIR;
+	__IO uint32_t TDTR;
+	__IO uint32_t TDLR;
+	__IO uint32_t TDHR;
+} CAN_TxMailBox_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t RIR;
+	__IO uint32_t RDTR;
+	__IO uint32_t RDLR;
+	__IO uint32_t RDHR;
+} CAN_FIFOMailBox_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t FR1;
+	__IO uint32_t FR2;
+} CAN_FilterRegister_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t MCR;
+	__IO uint32_t MSR;
+	__IO uint32_t TSR;
+	__IO uint32_t RF0R;
+	__IO uint32_t RF1R;
+	__IO uint32_t IER;
+	__IO uint32_t ESR;
+	__IO uint32_t BTR;
+	uint32_t RESERVED0[88];
+	CAN_TxMailBox_TypeDef sTxMailBox[3];
+	CAN_FIFOMailBox_TypeDef sFIFOMailBox[2];
+	uint32_t RESERVED1[12];
+	__IO uint32_t FMR;
+	__IO uint32_t FM1R;
+	uint32_t RESERVED2;
+	__IO uint32_t FS1R;
+	uint32_t RESERVED3;
+	__IO uint32_t FFA1R;
+	uint32_t RESERVED4;
+	__IO uint32_t FA1R;
+	uint32_t RESERVED5[8];
+	CAN_FilterRegister_TypeDef sFilterRegister[14];
+} CAN_TypeDef;
+
+CAN_TypeDef *SIM_Can1(void);
+
+#define CAN1                (SIM_Can1())
+
+#define CAN_MCR_INRQ                (1UL << 0)
+#define CAN_MCR_SLEEP               (1UL << 1)
+#define CAN_MCR_TXFP                (1UL << 2)
+#define CAN_MCR_RFLM                (1UL << 3)
+#define CAN_MCR_NART                (1UL << 4)
+#define CAN_MCR_AWUM                (1UL << 5)
+#define CAN_MCR_ABOM                (1UL << 6)
+#define CAN_MCR_TTCM                (1UL << 7)
+
+#define CAN_MSR_INAK                (1UL << 0)
+
+#define CAN_TSR_RQCP0               (1UL << 0)
+#define CAN_TSR_TXOK0               (1UL << 1)
+#define CAN_TSR_ALST0               (1UL << 2)
+#define CAN_TSR_TERR0               (1UL << 3)
+#define CAN_TSR_ABRQ0_Pos           (7U)
+#define CAN_TSR_ABRQ0               (1UL << 7)
+#define CAN_TSR_CODE_Pos            (24U)
+#define CAN_TSR_CODE                (3UL << 24)
+#define CAN_TSR_TME0                (1UL << 26)
+#define CAN_TSR_TME                 (7UL << 26)
+
+#define CAN_RF0R_FMP0               (3UL << 0)
+#define CAN_RF0R_FULL0              (1UL << 3)
+#define CAN_RF0R_FOVR0              (1UL << 4)
+#define CAN_RF0R_RFOM0              (1UL << 5)
+
+#define CAN_TI0R_TXRQ               (1UL << 0)
+#define CAN_TI0R_RTR                (1UL << 1)
+#define CAN_TI0R_IDE                (1UL << 2)
+#define CAN_TI0R_EXID_Pos           (3U)
+#define CAN_TI0R_STID_Pos           (21U)
+#define CAN_TDT0R_DLC               (0xFUL << 0)
+#define CAN_TDT0R_TGT               (1UL << 8)
+#define CAN_TDT0R_TIME_Pos          (16U)
+#define CAN_RI0R_STID_Pos           (21U)
+#define CAN_RI0R_STID               (0x7FFUL << 21)
+#define CAN_RDT0R_DLC               (0xFUL << 0)
+
+#define CAN_ESR_EWGF                (1UL << 0)
+#define CAN_ESR_EPVF                (1UL << 1)
+#define CAN_ESR_BOFF                (1UL << 2)
+#define CAN_ESR_LEC_Pos             (4U)
+#define CAN_ESR_LEC                 (7UL << 4)
+#define CAN_ESR_TEC_Pos             (16U)
+#define CAN_ESR_TEC                 (0xFFUL << 16)
+#define CAN_ESR_REC_Pos             (24U)
+#define CAN_ESR_REC                 (0xFFUL << 24)
+
+/*========================= HAL CAN =========================*/
+#define CAN_ID_STD                  (0x00000000U)
+#define CAN_ID_EXT                  (0x00000004U)
+#define CAN_RTR_DATA                (0x00000000U)
+#define CAN_RTR_REMOTE              (0x00000002U)
+
+#define CAN_RX_FIFO0                (0x00000000U)
+#define CAN_RX_FIFO1                (0x00000001U)
+#define CAN_FILTER_FIFO0            (0x00000000U)
+#define CAN_FILTER_FIFO1            (0x00000001U)
+#define CAN_FILTERMODE_IDMASK       (0x00000000U)
+#define CAN_FILTERMODE_IDLIST       (0x00000001U)
+#define CAN_FILTERSCALE_16BIT       (0x00000000U)
+#define CAN_FILTERSCALE_32BIT       (0x00000001U)
+
+#define CAN_TX_MAILBOX0             (0x00000001U)
+#define CAN_TX_MAILBOX1             (0x00000002U)
+#define CAN_TX_MAILBOX2             (0x00000004U)
+
+#define CAN_MODE_NORMAL             (0x00000000U)
+#define CAN_SJW_1TQ                 (0x00000000U)
+#define CAN_BS1_2TQ                 (0x00010000U)
+#define CAN_BS2_2TQ                 (0x00100000U)
+
+/* Interrupt enable bits, same values as CAN_IER */
+#define CAN_IT_TX_MAILBOX_EMPTY     (1UL << 0)
+#define CAN_IT_RX_FIFO0_MSG_PENDING (1UL << 1)
+#define CAN_IT_RX_FIFO0_FULL        (1UL << 2)
+#define CAN_IT_RX_FIFO0_OVERRUN     (1UL << 3)
+#define CAN_IT_RX_FIFO1_MSG_PENDING (1UL << 4)
+#define CAN_IT_ERROR_WARNING        (1UL << 8)
+#define CAN_IT_ERROR_PASSIVE        (1UL << 9)
+#define CAN_IT_BUSOFF               (1UL << 10)
+#define CAN_IT_LAST_ERROR_CODE      (1UL << 11)
+#define CAN_IT_ERROR                (1UL << 15)
+
+#define HAL_CAN_ERROR_NONE          (0x00000000U)
+#define HAL_CAN_ERROR_EWG           (0x00000001U)
+#define HAL_CAN_ERROR_EPV           (0x00000002U)
+#define HAL_CAN_ERROR_BOF           (0x00000004U)
+#define HAL_CAN_ERROR_STF           (0x00000008U)
+#define HAL_CAN_ERROR_FOR           (0x00000010U)
+#define HAL_CAN_ERROR_ACK           (0x00000020U)
+#define HAL_CAN_ERROR_PARAM         (0x00200000U)
+
+typedef struct
+{
+	uint32_t Prescaler;
+	uint32_t Mode;
+	uint32_t SyncJumpWidth;
+	uint32_t TimeSeg1;
+	uint32_t TimeSeg2;
+	uint32_t TimeTriggeredMode;
+	uint32_t AutoBusOff;
+	uint32_t AutoWakeUp;
+	uint32_t AutoRetransmission;
+	uint32_t ReceiveFifoLocked;
+	uint32_t TransmitFifoPriority;
+} CAN_InitTypeDef;
+
+typedef struct
+{
+	uint32_t FilterIdHigh;
+	uint32_t FilterIdLow;
+	uint32_t FilterMaskIdHigh;
+	uint32_t FilterMaskIdLow;
+	uint32_t FilterFIFOAssignment;
+	uint32_t FilterBank;
+	uint32_t FilterMode;
+	uint32_t FilterScale;
+	uint32_t FilterActivation;
+	uint32_t SlaveStartFilterBank;
+} CAN_FilterTypeDef;
+
+typedef struct
+{
+	uint32_t StdId;
+	uint32_t ExtId;
+	uint32_t IDE;
+	uint32_t RTR;
+	uint32_t DLC;
+	uint32_t TransmitGlobalTime;
+} CAN_TxHeaderTypeDef;
+
+typedef struct
+{
+	uint32_t StdId;
+	uint32_t ExtId;
+	uint32_t IDE;
+	uint32_t RTR;
+	uint32_t DLC;
+	uint32_t Timestamp;
+	uint32_t FilterMatchIndex;
+} CAN_RxHeaderTypeDef;
+
+/* Callbacks are registered in the handle, as with USE_HAL_CAN_REGISTER_CALLBACKS */
+typedef struct __CAN_HandleTypeDef
+{
+	CAN_TypeDef *Instance;
+	CAN_InitTypeDef Init;
+	__IO uint32_t ErrorCode;
+	void (*RxFifo0MsgPendingCallback)(struct __CAN_HandleTypeDef *hcan);
+	void (*ErrorCallback)(struct __CAN_HandleTypeDef *hcan);
+} CAN_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_CAN_Init(CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef HAL_CAN_ConfigFilter(CAN_HandleTypeDef *hcan, CAN_FilterTypeDef *sFilterConfig);
+HAL_StatusTypeDef HAL_CAN_Start(CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef HAL_CAN_ActivateNotification(CAN_HandleTypeDef *hcan, uint32_t ActiveITs);
+HAL_StatusTypeDef HAL_CAN_AddTxMessage(CAN_HandleTypeDef *hcan, CAN_TxHeaderTypeDef *pHeader, uint8_t aData[], uint32_t *pTxMailbox);
+HAL_StatusTypeDef HAL_CAN_AbortTxRequest(CAN_HandleTypeDef *hcan, uint32_t TxMailboxes);
+uint32_t HAL_CAN_GetTxMailboxesFreeLevel(CAN_HandleTypeDef *hcan);
+uint32_t HAL_CAN_IsTxMessagePending(CAN_HandleTypeDef *hcan, uint32_t TxMailboxes);
+uint32_t HAL_CAN_GetTxTimestamp(CAN_HandleTypeDef *hcan, uint32_t TxMailbox);
+HAL_StatusTypeDef HAL_CAN_GetRxMessage(CAN_HandleTypeDef *hcan, uint32_t RxFifo, CAN_RxHeaderTypeDef *pHeader, uint8_t aData[]);
+uint32_t HAL_CAN_GetRxFifoFillLevel(CAN_HandleTypeDef *hcan, uint32_t RxFifo);
+uint32_t HAL_CAN_GetError(CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef HAL_CAN_ResetError(CAN_HandleTypeDef *hcan);
+
+#endif /* STM32F1XX_HAL_H */
@@ -0,0 +1,148 @@
+/*================================================================
+ * 	File Name: AgentNode.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "main.h"
+#include "SRV/AGENT/AGENT.h"
+#include "SRV/BOOTMBX/BOOTMBX.h"
+#include "SRV/BOOTAPI/BOOTAPI.h"
+#include "SRV/BOOTAPI/BOOTAPI_Cfg.h"
+#include "SRV/CRC/CRC.h"
+#include "MCAL/FPEC/FPEC.h"
+#include "SRV/TRACE/TRACE.h"
+#include "SIM.h"
+#include "SIM_Cfg.h"
+#include "SIM_Nodes.h"
+
+/* The application's own handles, the agent shares its CAN peripheral */
+static CAN_HandleTypeDef hcan;
+static CAN_RxHeaderTypeDef RxHeader;
+static uint8_t RxData[8];
+
+SIM_AgentRun_t SIM_AgentRun;
+
+static void AgentRxFifo0MsgPending(CAN_HandleTypeDef *Can)
+{
+	if (HAL_CAN_GetRxMessage(Can, CAN_RX_FIFO0, &RxHeader, RxData) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	/* Frames of the application would be handled here */
+	(void)SRV_AGENT_RxIndication(&RxHeader, RxData);
+}
+
+static void AgentError(CAN_HandleTypeDef *Can)
+{
+	HAL_CAN_ResetError(Can);
+}
+
+/* Mailbox request of the bootloader's service table, counts the calls through it */
+static void BootApiRequest(uint32_t Command)
+{
+	SIM_AgentRun.TableRequests++;
+	SRV_BOOTMBX_Request(Command);
+}
+
+void SIM_BootApiLoad(void)
+{
+	SRV_BOOTAPI_Table_t Table =
+	{
+		BOOTAPI_MAGIC,
+		BOOTAPI_VERSION,
+		MCAL_FPEC_Init,
+		MCAL_FPEC_EraseFlashArea,
+		MCAL_FPEC_FlashWrite,
+		SRV_CRC_Update,
+		SRV_BOOTAPI_CanSend,
+		SRV_BOOTAPI_CanReceive,
+		SIM_ReceiverActiveSlot,
+		BootApiRequest
+	};
+
+	SIM_FLASH_Load(BOOTAPI_ADDRESS, (const uint8_t *)&Table, sizeof(Table));
+}
+
+void SIM_AgentMain(void)
+{
+	uint64_t Start;
+	uint64_t Duration;
+	uint8_t Status;
+	uint8_t Leaving = FALSE;
+
+	hcan.Instance = CAN1;
+	hcan.Init.Prescaler = 16;
+	hcan.Init.Mode = CAN_MODE_NORMAL;
+	hcan.Init.SyncJumpWidth = CAN_SJW_1TQ;
+	hcan.Init.TimeSeg1 = CAN_BS1_2TQ;
+	hcan.Init.TimeSeg2 = CAN_BS2_2TQ;
+	hcan.Init.TimeTriggeredMode = (TRACE_ENABLE == 1) ? ENABLE : DISABLE;
+	hcan.Init.AutoBusOff = ENABLE;
+	hcan.Init.AutoWakeUp = DISABLE;
+	hcan.Init.AutoRetransmission = ENABLE;
+	hcan.Init.ReceiveFifoLocked = DISABLE;
+	hcan.Init.TransmitFifoPriority = ENABLE;
+	hcan.RxFifo0MsgPendingCallback = AgentRxFifo0MsgPending;
+	hcan.ErrorCallback = AgentError;
+	if (HAL_CAN_Init(&hcan) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	/* The application runs from slot A */
+	SRV_AGENT_Init(&hcan, SIM_ReceiverSlotAddress);
+	SRV_TRACE_Init(&hcan);
+
+	if (HAL_CAN_ActivateNotification(&hcan, CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_ERROR_WARNING | CAN_IT_ERROR_PASSIVE |
+	                                        CAN_IT_BUSOFF | CAN_IT_LAST_ERROR_CODE | CAN_IT_ERROR) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	HAL_CAN_Start(&hcan);
+
+	/* The application's job, then one step of the agent; it would reset once the new image is active */
+	SIM_AgentRun.LongestCallNs = 0;
+	SIM_AgentRun.AgentNs = 0;
+	SIM_AgentRun.Calls = 0;
+	do
+	{
+		SIM_Consume(SIM_MAIN_LOOP_NS + (uint64_t)SIM_AgentRun.JobUs * 1000ULL);
+		Start = SIM_Now();
+		Status = SRV_AGENT_MainFunction();
+		Duration = SIM_Now() - Start;
+		SIM_AgentRun.AgentNs += Duration;
+		SIM_AgentRun.Calls++;
+		if (Duration > SIM_AgentRun.LongestCallNs)
+		{
+			SIM_AgentRun.LongestCallNs = Duration;
+		}
+		if (Status == AGENT_LEAVE)
+		{
+			/* Called again on every pass until the answer is out */
+			SIM_AgentRun.Leaves += Leaving ? 0U : 1U;
+			Leaving = TRUE;
+			SRV_AGENT_EnterUpdater();
+		}
+	} while (Status != AGENT_READY);
+}
+
+void SIM_BootMain(void)
+{
+	uint32_t Command = SRV_BOOTMBX_Take();
+
+	if (Command == BOOTMBX_CMD_START)
+	{
+		/* The slot just activated is started without the menu, the run ends with it */
+		SIM_AgentRun.Starts++;
+		return;
+	}
+	if (Command == BOOTMBX_CMD_UPDATE)
+	{
+		SIM_ReceiverMain();
+	}
+	else
+	{
+		SIM_AgentMain();
+	}
+	/* Both firmwares end an update with this request */
+	SRV_BOOTMBX_Request(BOOTMBX_CMD_START);
+}
@@ -0,0 +1,105 @@
+/*================================================================
+ * 	File Name: ReceiverNode.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include "main.h"
+#include "MCAL/FPEC/FPEC.h"
+#include "SRV/UPDATER/UPDATER.h"
+#include "SRV/TRACE/TRACE.h"
+#include "SRV/BOOTCTL/BOOTCTL.h"
+#include "SIM.h"
+#include "SIM_Cfg.h"
+#include "SIM_Nodes.h"
+
+/* Same names as in Firmware_Receiver/Core/Src/main.c, each node has its own copy */
+static CAN_HandleTypeDef hcan;
+static CAN_FilterTypeDef FilterConfig;
+static CAN_RxHeaderTypeDef RxHeader;
+static uint8_t RxData[8];
+
+const uint32_t SIM_ReceiverSlotAddress = NEW_FIRMWARE_START_ADDRESS;
+const uint32_t SIM_ReceiverSlotSize = NEW_FIRMWARE_SLOT_SIZE;
+
+uint32_t SIM_ReceiverActiveSlot(void)
+{
+	uint8_t Slot;
+
+	/* As the bootloader sees it after the reset */
+	Slot = SRV_BOOTCTL_GetActiveSlot();
+	return (Slot == BOOTCTL_SLOT_NONE) ? 0U : SRV_BOOTCTL_SlotAddress(Slot);
+}
+
+static void ReceiverRxFifo0MsgPending(CAN_HandleTypeDef *Can)
+{
+	if (HAL_CAN_GetRxMessage(Can, CAN_RX_FIFO0, &RxHeader, RxData) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	SRV_UPDATER_RxIndication(&RxHeader, RxData);
+}
+
+static void ReceiverError(CAN_HandleTypeDef *Can)
+{
+	(void)Can;
+	SRV_UPDATER_ErrorIndication();
+}
+
+void SIM_ReceiverMain(void)
+{
+	hcan.Instance = CAN1;
+	hcan.Init.Prescaler = 16;
+	hcan.Init.Mode = CAN_MODE_NORMAL;
+	hcan.Init.SyncJumpWidth = CAN_SJW_1TQ;
+	hcan.Init.TimeSeg1 = CAN_BS1_2TQ;
+	hcan.Init.TimeSeg2 = CAN_BS2_2TQ;
+	hcan.Init.TimeTriggeredMode = (TRACE_ENABLE == 1) ? ENABLE : DISABLE;
+	hcan.Init.AutoBusOff = ENABLE;
+	hcan.Init.AutoWakeUp = DISABLE;
+	hcan.Init.AutoRetransmission = ENABLE;
+	hcan.Init.ReceiveFifoLocked = DISABLE;
+	hcan.Init.TransmitFifoPriority = ENABLE;
+	hcan.RxFifo0MsgPendingCallback = ReceiverRxFifo0MsgPending;
+	hcan.ErrorCallback = ReceiverError;
+	if (HAL_CAN_Init(&hcan) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	MCAL_FPEC_Init();
+
+	SRV_UPDATER_Init(&hcan);
+	SRV_TRACE_Init(&hcan);
+
+	FilterConfig.FilterActivation = ENABLE;
+	FilterConfig.FilterFIFOAssignment = CAN_FILTER_FIFO0;
+	FilterConfig.FilterBank = 0;
+	FilterConfig.FilterMode = CAN_FILTERMODE_IDMASK;
+	FilterConfig.FilterScale = CAN_FILTERSCALE_32BIT;
+	FilterConfig.FilterIdHigh = (DATA_FRAME_ID << 5);
+	FilterConfig.FilterIdLow = 0x0000;
+	FilterConfig.FilterMaskIdHigh = ((0x7FF & ~DATA_FRAME_SEQ_MASK) << 5);
+	FilterConfig.FilterMaskIdLow = 0x0000;
+	if (HAL_CAN_ConfigFilter(&hcan, &FilterConfig) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	FilterConfig.FilterBank = 1;
+	FilterConfig.FilterIdHigh = (CMD_FRAME_ID << 5);
+	FilterConfig.FilterMaskIdHigh = (0x7FF << 5);
+	if (HAL_CAN_ConfigFilter(&hcan, &FilterConfig) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	if (HAL_CAN_ActivateNotification(&hcan, CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_ERROR_WARNING | CAN_IT_ERROR_PASSIVE |
+	                                        CAN_IT_BUSOFF | CAN_IT_LAST_ERROR_CODE | CAN_IT_ERROR) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	HAL_CAN_Start(&hcan);
+
+	/* The firmware resets into the bootloader here, which ends the node */
+	while (SRV_UPDATER_MainFunction() != TRUE)
+	{
+		SIM_Consume(SIM_MAIN_LOOP_NS);
+	}
+}
@@ -0,0 +1,945 @@
+/*================================================================
+ * 	File Name: SIM_Can.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <string.h>
+#include "SIM.h"
+#include "SIM_Cfg.h"
+
+#define SIM_CAN_FIFO_DEPTH          3U
+#define SIM_CAN_MAILBOXES           3U
+#define SIM_CAN_FILTER_BANKS        14U
+
+/* Error frame: error flag, superposed flags of the other nodes, delimiter and intermission */
+#define SIM_CAN_ERROR_FRAME_BITS    (6U + 6U + 8U + 3U)
+/* Bus-off recovery: 128 occurrences of 11 recessive bits */
+#define SIM_CAN_BUSOFF_BITS         (128U * 11U)
+
+/* Last error codes of CAN_ESR */
+#define SIM_CAN_LEC_STUFF           1U
+#define SIM_CAN_LEC_ACK             3U
+#define SIM_CAN_LEC_BIT_DOMINANT    5U
+
+/* State of a controller that is not visible in its registers */
+typedef struct
+{
+	uint64_t RequestNs[SIM_CAN_MAILBOXES];      /* Time TXRQ was set */
+	uint64_t RequestOrder[SIM_CAN_MAILBOXES];   /* Order of the requests, for TXFP */
+	uint8_t AbortPending[SIM_CAN_MAILBOXES];    /* Abort requested while on the bus */
+	CAN_FIFOMailBox_TypeDef Fifo[2][SIM_CAN_FIFO_DEPTH];
+	uint8_t FifoHead[2];
+	uint64_t BusOffUntilNs;
+	uint32_t LastEsrFlags;
+} SIM_CanController_t;
+
+static SIM_CanController_t Controller[SIM_MAX_NODES];
+
+static struct
+{
+	uint8_t Busy;
+	uint64_t StartNs;
+	uint64_t EndNs;
+	uint64_t IdleNs;            /* Earliest start of the next frame */
+	SIM_Node_t *Transmitter;
+	uint8_t Mailbox;
+	uint8_t Error;
+} Bus;
+
+static SIM_CanStats_t Stats;
+static uint64_t RequestCounter = 0;
+static uint32_t ErrorPpm = 0;
+static uint32_t DropPpm = 0;
+static uint32_t RandomState = 1;
+
+static uint32_t SIM_CAN_Random(void)
+{
+	/* xorshift32, reproducible for a given seed */
+	RandomState ^= RandomState << 13;
+	RandomState ^= RandomState >> 17;
+	RandomState ^= RandomState << 5;
+	return RandomState;
+}
+
+static uint8_t SIM_CAN_Chance(uint32_t Ppm)
+{
+	return (Ppm != 0U) && ((SIM_CAN_Random() % 1000000U) < Ppm);
+}
+
+static SIM_Node_t *SIM_CAN_Owner(const CAN_TypeDef *Can)
+{
+	SIM_Node_t *Node;
+
+	for (uint8_t i = 0; (Node = SIM_NodeAt(i)) != NULL; i++)
+	{
+		if (SIM_NodeCan(Node) == Can)
+		{
+			return Node;
+		}
+	}
+	return NULL;
+}
+
+static SIM_CanController_t *SIM_CAN_State(const CAN_TypeDef *Can)
+{
+	return &Controller[SIM_NodeIndex(SIM_CAN_Owner(Can))];
+}
+
+/* Nominal bit time configured in CAN_BTR */
+static uint64_t SIM_CAN_BitNs(const CAN_TypeDef *Can)
+{
+	uint32_t Brp = (Can->BTR & 0x3FFU) + 1U;
+	uint32_t Ts1 = ((Can->BTR >> 16) & 0xFU) + 1U;
+	uint32_t Ts2 = ((Can->BTR >> 20) & 0x7U) + 1U;
+
+	return ((uint64_t)Brp * (1U + Ts1 + Ts2) * 1000000000ULL) / SIM_SYSCLK_HZ;
+}
+
+static uint8_t SIM_CAN_IsActive(const CAN_TypeDef *Can)
+{
+	return ((Can->MCR & CAN_MCR_INRQ) == 0U) && ((Can->ESR & CAN_ESR_BOFF) == 0U);
+}
+
+/* Length of a frame on the wire, stuff bits and intermission included */
+static uint32_t SIM_CAN_FrameBits(const CAN_TxMailBox_TypeDef *Mailbox)
+{
+	uint8_t Bits[160];
+	uint32_t Count = 0;
+	uint32_t Dlc = Mailbox->TDTR & CAN_TDT0R_DLC;
+	uint32_t Rtr = (Mailbox->TIR & CAN_TI0R_RTR) != 0U;
+	uint16_t Crc = 0;
+	uint32_t Stuffed = 0;
+	uint32_t Run = 0;
+	uint8_t Last = 2;
+
+	if (Dlc > 8U)
+	{
+		Dlc = 8U;
+	}
+
+	Bits[Count++] = 0; /* SOF */
+	if ((Mailbox->TIR & CAN_TI0R_IDE) == 0U)
+	{
+		uint32_t StdId = Mailbox->TIR >> CAN_TI0R_STID_Pos;
+		for (int8_t i = 10; i >= 0; i--)
+		{
+			Bits[Count++] = (StdId >> i) & 1U;
+		}
+		Bits[Count++] = (uint8_t)Rtr;
+		Bits[Count++] = 0; /* IDE */
+		Bits[Count++] = 0; /* r0 */
+	}
+	else
+	{
+		uint32_t ExtId = Mailbox->TIR >> CAN_TI0R_EXID_Pos;
+		for (int8_t i = 28; i >= 18; i--)
+		{
+			Bits[Count++] = (ExtId >> i) & 1U;
+		}
+		Bits[Count++] = 1; /* SRR */
+		Bits[Count++] = 1; /* IDE */
+		for (int8_t i = 17; i >= 0; i--)
+		{
+			Bits[Count++] = (ExtId >> i) & 1U;
+		}
+		Bits[Count++] = (uint8_t)Rtr;
+		Bits[Count++] = 0; /* r1 */
+		Bits[Count++] = 0; /* r0 */
+	}
+	for (int8_t i = 3; i >= 0; i--)
+	{
+		Bits[Count++] = (Dlc >> i) & 1U;
+	}
+	if (!Rtr)
+	{
+		for (uint32_t Byte = 0; Byte < Dlc; Byte++)
+		{
+			uint32_t Word = (Byte < 4U) ? Mailbox->TDLR : Mailbox->TDHR;
+			uint8_t Value = (uint8_t)(Word >> (8U * (Byte % 4U)));
+			for (int8_t i = 7; i >= 0; i--)
+			{
+				Bits[Count++] = (Value >> i) & 1U;
+			}
+		}
+	}
+
+	/* CRC-15 over SOF to the end of the data field */
+	for (uint32_t i = 0; i < Count; i++)
+	{
+		uint8_t Next = Bits[i] ^ ((Crc >> 14) & 1U);
+		Crc = (uint16_t)((Crc << 1) & 0x7FFFU);
+		if (Next)
+		{
+			Crc ^= 0x4599U;
+		}
+	}
+	for (int8_t i = 14; i >= 0; i--)
+	{
+		Bits[Count++] = (Crc >> i) & 1U;
+	}
+
+	/* A stuff bit follows every 5 equal bits from SOF to the end of the CRC */
+	for (uint32_t i = 0; i < Count; i++)
+	{
+		if (Bits[i] == Last)
+		{
+			Run++;
+		}
+		else
+		{
+			Last = Bits[i];
+			Run = 1;
+		}
+		if (Run == 5U)
+		{
+			Stuffed++;
+			Last = !Last;
+			Run = 1;
+		}
+	}
+
+	/* CRC delimiter, ACK slot and delimiter, EOF, intermission */
+	return Count + Stuffed + 1U + 2U + 7U + 3U;
+}
+
+static void SIM_CAN_UpdateErrorState(SIM_Node_t *Node, uint32_t Lec)
+{
+	CAN_TypeDef *Can = SIM_NodeCan(Node);
+	SIM_CanController_t *State = &Controller[SIM_NodeIndex(Node)];
+	uint32_t Tec = (Can->ESR & CAN_ESR_TEC) >> CAN_ESR_TEC_Pos;
+	uint32_t Rec = (Can->ESR & CAN_ESR_REC) >> CAN_ESR_REC_Pos;
+	uint32_t Flags = Can->ESR & (CAN_ESR_BOFF);
+	uint32_t Raised;
+
+	if (Tec >= 96U || Rec >= 96U)
+	{
+		Flags |= CAN_ESR_EWGF;
+	}
+	if (Tec > 127U || Rec > 127U)
+	{
+		Flags |= CAN_ESR_EPVF;
+	}
+
+	Can->ESR = (Can->ESR & ~(CAN_ESR_EWGF | CAN_ESR_EPVF | CAN_ESR_LEC)) | Flags | (Lec << CAN_ESR_LEC_Pos);
+
+	/* The status change interrupt is raised on a new error state or on a bus error */
+	Raised = Flags & ~State->LastEsrFlags;
+	State->LastEsrFlags = Flags;
+	if ((Can->IER & CAN_IT_ERROR) != 0U &&
+		(((Raised & CAN_ESR_EWGF) && (Can->IER & CAN_IT_ERROR_WARNING)) ||
+		 ((Raised & CAN_ESR_EPVF) && (Can->IER & CAN_IT_ERROR_PASSIVE)) ||
+		 ((Raised & CAN_ESR_BOFF) && (Can->IER & CAN_IT_BUSOFF)) ||
+		 (Lec != 0U && (Can->IER & CAN_IT_LAST_ERROR_CODE))))
+	{
+		SIM_RaiseIrq(Node, SIM_IRQ_CAN_SCE);
+	}
+}
+
+static void SIM_CAN_SetCounters(CAN_TypeDef *Can, uint32_t Tec, uint32_t Rec)
+{
+	Can->ESR = (Can->ESR & ~(CAN_ESR_TEC | CAN_ESR_REC)) |
+	           ((Tec & 0xFFU) << CAN_ESR_TEC_Pos) | ((Rec & 0xFFU) << CAN_ESR_REC_Pos);
+}
+
+/* CODE: number of the first empty mailbox, if any */
+static void SIM_CAN_UpdateCode(CAN_TypeDef *Can)
+{
+	for (uint32_t Index = 0; Index < SIM_CAN_MAILBOXES; Index++)
+	{
+		if ((Can->TSR & (CAN_TSR_TME0 << Index)) != 0U)
+		{
+			Can->TSR = (Can->TSR & ~CAN_TSR_CODE) | (Index << CAN_TSR_CODE_Pos);
+			break;
+		}
+	}
+}
+
+static void SIM_CAN_MailboxDone(CAN_TypeDef *Can, uint8_t Mailbox, uint32_t Status)
+{
+	SIM_CanController_t *State = SIM_CAN_State(Can);
+
+	Can->sTxMailBox[Mailbox].TIR &= ~CAN_TI0R_TXRQ;
+	Can->TSR |= ((CAN_TSR_RQCP0 | Status) << (8U * Mailbox)) | (CAN_TSR_TME0 << Mailbox);
+	SIM_CAN_UpdateCode(Can);
+	State->AbortPending[Mailbox] = 0;
+}
+
+/* The mailbox was requested: it is no longer empty and the status of its previous request is cleared */
+static void SIM_CAN_Request(CAN_TypeDef *Can, uint8_t Mailbox, uint64_t Ns)
+{
+	SIM_CanController_t *State = SIM_CAN_State(Can);
+
+	Can->TSR &= ~(((CAN_TSR_RQCP0 | CAN_TSR_TXOK0 | CAN_TSR_ALST0 | CAN_TSR_TERR0) << (8U * Mailbox)) |
+	              (CAN_TSR_TME0 << Mailbox));
+	SIM_CAN_UpdateCode(Can);
+	State->RequestNs[Mailbox] = Ns;
+	State->RequestOrder[Mailbox] = ++RequestCounter;
+	State->AbortPending[Mailbox] = 0;
+}
+
+static uint8_t SIM_CAN_FilterMatch(const CAN_TypeDef *Can, uint32_t Rir, uint32_t *Fifo, uint32_t *Index)
+{
+	uint32_t Id16 = ((Rir >> 21) << 5) | (((Rir >> 1) & 1U) << 4) | (((Rir >> 2) & 1U) << 3) | ((Rir >> 18) & 7U);
+	uint32_t Number = 0;
+
+	Rir &= ~CAN_TI0R_TXRQ;
+	for (uint32_t Bank = 0; Bank < SIM_CAN_FILTER_BANKS; Bank++)
+	{
+		uint32_t Bit = 1UL << Bank;
+		uint32_t Fr1 = Can->sFilterRegister[Bank].FR1;
+		uint32_t Fr2 = Can->sFilterRegister[Bank].FR2;
+		uint8_t List = (Can->FM1R & Bit) != 0U;
+		uint8_t Wide = (Can->FS1R & Bit) != 0U;
+		uint8_t Match = 0;
+
+		if ((Can->FA1R & Bit) == 0U)
+		{
+			Number += Wide ? (List ? 2U : 1U) : (List ? 4U : 2U);
+			continue;
+		}
+		if (Wide && !List)
+		{
+			Match = (((Rir ^ Fr1) & Fr2) == 0U);
+		}
+		else if (Wide)
+		{
+			Match = (Rir == (Fr1 & ~1U)) || (Rir == (Fr2 & ~1U));
+		}
+		else if (!List)
+		{
+			Match = (((Id16 ^ Fr1) & (Fr1 >> 16) & 0xFFFFU) == 0U) ||
+			        (((Id16 ^ Fr2) & (Fr2 >> 16) & 0xFFFFU) == 0U);
+		}
+		else
+		{
+			Match = (Id16 == (Fr1 & 0xFFFFU)) || (Id16 == (Fr1 >> 16)) ||
+			        (Id16 == (Fr2 & 0xFFFFU)) || (Id16 == (Fr2 >> 16));
+		}
+		if (Match)
+		{
+			*Fifo = ((Can->FFA1R & Bit) != 0U) ? 1U : 0U;
+			*Index = Number;
+			return 1;
+		}
+		Number += Wide ? (List ? 2U : 1U) : (List ? 4U : 2U);
+	}
+	return 0;
+}
+
+static void SIM_CAN_Deliver(SIM_Node_t *Node, const CAN_TxMailBox_TypeDef *Frame, uint64_t SofNs)
+{
+	CAN_TypeDef *Can = SIM_NodeCan(Node);
+	SIM_CanController_t *State = &Controller[SIM_NodeIndex(Node)];
+	__IO uint32_t *Rfr;
+	uint32_t Fifo;
+	uint32_t Index;
+	uint32_t Level;
+	CAN_FIFOMailBox_TypeDef *Entry;
+
+	if (!SIM_CAN_FilterMatch(Can, Frame->TIR, &Fifo, &Index))
+	{
+		return;
+	}
+
+	Rfr = (Fifo == 0U) ? &Can->RF0R : &Can->RF1R;
+	Level = *Rfr & CAN_RF0R_FMP0;
+	if (Level >= SIM_CAN_FIFO_DEPTH)
+	{
+		/* Without FIFO lock the newest frame overwrites the last one */
+		*Rfr |= CAN_RF0R_FOVR0;
+		Stats.Overruns++;
+		if ((Can->MCR & CAN_MCR_RFLM) != 0U)
+		{
+			return;
+		}
+		Level--;
+	}
+
+	Entry = &State->Fifo[Fifo][(State->FifoHead[Fifo] + Level) % SIM_CAN_FIFO_DEPTH];
+	Entry->RIR = Frame->TIR & ~CAN_TI0R_TXRQ;
+	Entry->RDTR = (Frame->TDTR & CAN_TDT0R_DLC) | (Index << 8) |
+	              ((uint32_t)((SofNs / SIM_CAN_BitNs(Can)) & 0xFFFFU) << 16);
+	Entry->RDLR = Frame->TDLR;
+	Entry->RDHR = Frame->TDHR;
+	Level++;
+	*Rfr = (*Rfr & ~(CAN_RF0R_FMP0 | CAN_RF0R_FULL0)) | Level | ((Level == SIM_CAN_FIFO_DEPTH) ? CAN_RF0R_FULL0 : 0U);
+	Can->sFIFOMailBox[Fifo] = State->Fifo[Fifo][State->FifoHead[Fifo]];
+
+	if (Fifo == 0U && (Can->IER & CAN_IT_RX_FIFO0_MSG_PENDING) != 0U)
+	{
+		SIM_RaiseIrq(Node, SIM_IRQ_CAN_RX0);
+	}
+}
+
+/* End of the frame on the bus: acknowledge, deliver and account the error counters */
+static void SIM_CAN_Complete(void)
+{
+	SIM_Node_t *Tx = Bus.Transmitter;
+	CAN_TypeDef *TxCan = SIM_NodeCan(Tx);
+	CAN_TxMailBox_TypeDef *Frame = &TxCan->sTxMailBox[Bus.Mailbox];
+	SIM_CanController_t *TxState = &Controller[SIM_NodeIndex(Tx)];
+	uint32_t Tec = (TxCan->ESR & CAN_ESR_TEC) >> CAN_ESR_TEC_Pos;
+	uint8_t Acked = 0;
+	uint8_t Dropped = SIM_CAN_Chance(DropPpm);
+	SIM_Node_t *Node;
+
+	Stats.BusyNs += Bus.EndNs - Bus.StartNs;
+
+	if (!Bus.Error)
+	{
+		for (uint8_t i = 0; (Node = SIM_NodeAt(i)) != NULL; i++)
+		{
+			CAN_TypeDef *Can = SIM_NodeCan(Node);
+			uint32_t Rec = (Can->ESR & CAN_ESR_REC) >> CAN_ESR_REC_Pos;
+
+			if (Node == Tx || !SIM_CAN_IsActive(Can))
+			{
+				continue;
+			}
+			Acked = 1;
+			if (Rec > 0U)
+			{
+				SIM_CAN_SetCounters(Can, (Can->ESR & CAN_ESR_TEC) >> CAN_ESR_TEC_Pos, Rec - 1U);
+			}
+			if (!Dropped)
+			{
+				SIM_CAN_Deliver(Node, Frame, Bus.StartNs);
+			}
+		}
+	}
+
+	if (!Bus.Error && Acked)
+	{
+		Stats.Frames++;
+		if (Dropped)
+		{
+			Stats.DroppedFrames++;
+		}
+		if ((TxCan->MCR & CAN_MCR_TTCM) != 0U && (Frame->TDTR & CAN_TDT0R_TGT) == 0U)
+		{
+			Frame->TDTR = (Frame->TDTR & 0xFFFFU) |
+			              ((uint32_t)((Bus.StartNs / SIM_CAN_BitNs(TxCan)) & 0xFFFFU) << CAN_TDT0R_TIME_Pos);
+		}
+		SIM_CAN_SetCounters(TxCan, (Tec > 0U) ? (Tec - 1U) : 0U, (TxCan->ESR & CAN_ESR_REC) >> CAN_ESR_REC_Pos);
+		SIM_CAN_MailboxDone(TxCan, Bus.Mailbox, CAN_TSR_TXOK0);
+		SIM_CAN_UpdateErrorState(Tx, 0);
+		return;
+	}
+
+	if (Bus.Error)
+	{
+		Stats.ErrorFrames++;
+		/* Receivers saw the error too */
+		for (uint8_t i = 0; (Node = SIM_NodeAt(i)) != NULL; i++)
+		{
+			CAN_TypeDef *Can = SIM_NodeCan(Node);
+			uint32_t Rec = (Can->ESR & CAN_ESR_REC) >> CAN_ESR_REC_Pos;
+
+			if (Node != Tx && SIM_CAN_IsActive(Can))
+			{
+				SIM_CAN_SetCounters(Can, (Can->ESR & CAN_ESR_TEC) >> CAN_ESR_TEC_Pos, (Rec < 127U) ? (Rec + 1U) : Rec);
+				SIM_CAN_UpdateErrorState(Node, SIM_CAN_LEC_STUFF);
+			}
+		}
+		Tec += 8U;
+	}
+	else if ((TxCan->ESR & CAN_ESR_EPVF) == 0U)
+	{
+		/* Nobody acknowledged, an error passive transmitter keeps its counter */
+		Tec += 8U;
+	}
+
+	if (Tec > 255U)
+	{
+		/* Bus-off: the pending requests wait for the recovery */
+		TxCan->ESR |= CAN_ESR_BOFF;
+		TxState->BusOffUntilNs = Bus.EndNs + (SIM_CAN_BUSOFF_BITS * SIM_CAN_BitNs(TxCan));
+		Tec = 255U;
+	}
+	SIM_CAN_SetCounters(TxCan, Tec, (TxCan->ESR & CAN_ESR_REC) >> CAN_ESR_REC_Pos);
+
+	if ((TxCan->MCR & CAN_MCR_NART) != 0U || TxState->AbortPending[Bus.Mailbox])
+	{
+		SIM_CAN_MailboxDone(TxCan, Bus.Mailbox, CAN_TSR_TERR0);
+	}
+	SIM_CAN_UpdateErrorState(Tx, Bus.Error ? SIM_CAN_LEC_BIT_DOMINANT : SIM_CAN_LEC_ACK);
+}
+
+/* Pending request of a controller that takes part in the next arbitration */
+static int8_t SIM_CAN_Candidate(SIM_Node_t *Node, uint64_t *RequestNs)
+{
+	CAN_TypeDef *Can = SIM_NodeCan(Node);
+	SIM_CanController_t *State = &Controller[SIM_NodeIndex(Node)];
+	int8_t Best = -1;
+
+	for (uint8_t Mailbox = 0; Mailbox < SIM_CAN_MAILBOXES; Mailbox++)
+	{
+		if ((Can->sTxMailBox[Mailbox].TIR & CAN_TI0R_TXRQ) == 0U)
+		{
+			continue;
+		}
+		if (Best < 0)
+		{
+			Best = (int8_t)Mailbox;
+		}
+		else if ((Can->MCR & CAN_MCR_TXFP) != 0U)
+		{
+			/* Transmit FIFO priority: oldest request first */
+			if (State->RequestOrder[Mailbox] < State->RequestOrder[Best])
+			{
+				Best = (int8_t)Mailbox;
+			}
+		}
+		else if ((Can->sTxMailBox[Mailbox].TIR >> 1) < (Can->sTxMailBox[Best].TIR >> 1))
+		{
+			/* Identifier priority, lowest mailbox number on a tie */
+			Best = (int8_t)Mailbox;
+		}
+	}
+	if (Best >= 0)
+	{
+		*RequestNs = State->RequestNs[Best];
+	}
+	return Best;
+}
+
+/* Arbitration value: identifier bits as they appear on the bus, the lowest wins */
+static uint64_t SIM_CAN_Priority(const CAN_TxMailBox_TypeDef *Mailbox)
+{
+	uint32_t Tir = Mailbox->TIR;
+
+	if ((Tir & CAN_TI0R_IDE) == 0U)
+	{
+		/* Base identifier, RTR, then the dominant IDE of a standard frame */
+		return ((uint64_t)(Tir >> CAN_TI0R_STID_Pos) << 21) | ((uint64_t)((Tir >> 1) & 1U) << 20);
+	}
+	/* Base identifier, recessive SRR and IDE, extension, RTR */
+	return ((uint64_t)(Tir >> 21) << 21) | (3ULL << 19) | ((uint64_t)((Tir >> 3) & 0x3FFFFU) << 1) | ((Tir >> 1) & 1U);
+}
+
+void SIM_CAN_Advance(uint64_t Ns)
+{
+	SIM_Node_t *Node;
+	SIM_Node_t *Winner;
+	int8_t WinnerMailbox;
+	uint64_t Start;
+	uint64_t RequestNs;
+	uint64_t BitNs;
+	uint32_t Bits;
+
+	while (1)
+	{
+		if (Bus.Busy)
+		{
+			if (Bus.EndNs > Ns)
+			{
+				return;
+			}
+			SIM_CAN_Complete();
+			Bus.Busy = 0;
+			Bus.IdleNs = Bus.EndNs;
+			continue;
+		}
+
+		/* Controllers that finished their bus-off recovery */
+		for (uint8_t i = 0; (Node = SIM_NodeAt(i)) != NULL; i++)
+		{
+			CAN_TypeDef *Can = SIM_NodeCan(Node);
+			SIM_CanController_t *State = &Controller[i];
+
+			if ((Can->ESR & CAN_ESR_BOFF) != 0U && (Can->MCR & CAN_MCR_ABOM) != 0U && State->BusOffUntilNs <= Ns)
+			{
+				Can->ESR &= ~(CAN_ESR_BOFF | CAN_ESR_TEC | CAN_ESR_REC);
+				SIM_CAN_UpdateErrorState(Node, 0);
+			}
+		}
+
+		/* The next frame starts with the earliest request once the bus is idle */
+		Start = UINT64_MAX;
+		for (uint8_t i = 0; (Node = SIM_NodeAt(i)) != NULL; i++)
+		{
+			if (SIM_CAN_IsActive(SIM_NodeCan(Node)) && SIM_CAN_Candidate(Node, &RequestNs) >= 0 && RequestNs < Start)
+			{
+				Start = RequestNs;
+			}
+		}
+		if (Start == UINT64_MAX)
+		{
+			return;
+		}
+		if (Start < Bus.IdleNs)
+		{
+			Start = Bus.IdleNs;
+		}
+		if (Start > Ns)
+		{
+			return;
+		}
+
+		/* Arbitration among the requests made before the start of frame */
+		Winner = NULL;
+		WinnerMailbox = -1;
+		for (uint8_t i = 0; (Node = SIM_NodeAt(i)) != NULL; i++)
+		{
+			CAN_TypeDef *Can = SIM_NodeCan(Node);
+			int8_t Mailbox;
+
+			if (!SIM_CAN_IsActive(Can))
+			{
+				continue;
+			}
+			Mailbox = SIM_CAN_Candidate(Node, &RequestNs);
+			if (Mailbox < 0 || RequestNs > Start)
+			{
+				continue;
+			}
+			if (Winner == NULL || SIM_CAN_Priority(&Can->sTxMailBox[Mailbox]) <
+			                      SIM_CAN_Priority(&SIM_NodeCan(Winner)->sTxMailBox[WinnerMailbox]))
+			{
+				Winner = Node;
+				WinnerMailbox = Mailbox;
+			}
+		}
+
+		BitNs = SIM_CAN_BitNs(SIM_NodeCan(Winner));
+		Bits = SIM_CAN_FrameBits(&SIM_NodeCan(Winner)->sTxMailBox[WinnerMailbox]);
+		Bus.Busy = 1;
+		Bus.Transmitter = Winner;
+		Bus.Mailbox = (uint8_t)WinnerMailbox;
+		Bus.StartNs = Start;
+		Bus.Error = SIM_CAN_Chance(ErrorPpm);
+		if (Bus.Error)
+		{
+			/* Destroyed at a random bit after the arbitration field */
+			Bits = 14U + (SIM_CAN_Random() % (Bits - 14U - 10U)) + SIM_CAN_ERROR_FRAME_BITS;
+		}
+		Bus.EndNs = Start + (Bits * BitNs);
+	}
+}
+
+void SIM_CAN_TakeRequests(CAN_TypeDef *Can, uint64_t Ns)
+{
+	for (uint8_t Index = 0; Index < SIM_CAN_MAILBOXES; Index++)
+	{
+		/* TXRQ stored into an empty mailbox */
+		if ((Can->sTxMailBox[Index].TIR & CAN_TI0R_TXRQ) != 0U && (Can->TSR & (CAN_TSR_TME0 << Index)) != 0U)
+		{
+			SIM_CAN_Request(Can, Index, Ns);
+		}
+	}
+}
+
+void SIM_CAN_Reset(CAN_TypeDef *Can)
+{
+	SIM_Node_t *Owner = SIM_CAN_Owner(Can);
+
+	/* A frame of the controller that is on the bus is cut short */
+	if (Bus.Busy && Bus.Transmitter == Owner)
+	{
+		Bus.Error = 1;
+	}
+	memset((void *)Can, 0, sizeof(*Can));
+	Can->MCR = CAN_MCR_INRQ | CAN_MCR_SLEEP;
+	Can->MSR = CAN_MSR_INAK;
+	Can->TSR = CAN_TSR_TME;
+	if (Owner != NULL)
+	{
+		memset(&Controller[SIM_NodeIndex(Owner)], 0, sizeof(SIM_CanController_t));
+	}
+}
+
+void SIM_CAN_SetFaults(uint32_t Error, uint32_t Drop, uint32_t Seed)
+{
+	ErrorPpm = Error;
+	DropPpm = Drop;
+	RandomState = (Seed != 0U) ? Seed : 1U;
+}
+
+const SIM_CanStats_t *SIM_CAN_GetStats(void)
+{
+	return &Stats;
+}
+
+void SIM_CAN_Interrupt(SIM_Node_t *Node, uint32_t Irq)
+{
+	CAN_HandleTypeDef *hcan = SIM_NodeCanHandle(Node);
+	CAN_TypeDef *Can = SIM_NodeCan(Node);
+	uint32_t Esr;
+
+	if (hcan == NULL)
+	{
+		return;
+	}
+
+	if (Irq == SIM_IRQ_CAN_RX0)
+	{
+		if ((Can->RF0R & CAN_RF0R_FMP0) != 0U && hcan->RxFifo0MsgPendingCallback != NULL)
+		{
+			hcan->RxFifo0MsgPendingCallback(hcan);
+		}
+		/* The line stays asserted while frames are pending */
+		if ((Can->RF0R & CAN_RF0R_FMP0) != 0U && (Can->IER & CAN_IT_RX_FIFO0_MSG_PENDING) != 0U)
+		{
+			SIM_RaiseIrq(Node, SIM_IRQ_CAN_RX0);
+		}
+	}
+	else if (Irq == SIM_IRQ_CAN_SCE)
+	{
+		Esr = Can->ESR;
+		if ((Esr & CAN_ESR_EWGF) && (Can->IER & CAN_IT_ERROR_WARNING))
+		{
+			hcan->ErrorCode |= HAL_CAN_ERROR_EWG;
+		}
+		if ((Esr & CAN_ESR_EPVF) && (Can->IER & CAN_IT_ERROR_PASSIVE))
+		{
+			hcan->ErrorCode |= HAL_CAN_ERROR_EPV;
+		}
+		if ((Esr & CAN_ESR_BOFF) && (Can->IER & CAN_IT_BUSOFF))
+		{
+			hcan->ErrorCode |= HAL_CAN_ERROR_BOF;
+		}
+		if ((Can->IER & CAN_IT_LAST_ERROR_CODE) != 0U)
+		{
+			switch ((Esr & CAN_ESR_LEC) >> CAN_ESR_LEC_Pos)
+			{
+			case SIM_CAN_LEC_STUFF:
+				hcan->ErrorCode |= HAL_CAN_ERROR_STF;
+				break;
+			case SIM_CAN_LEC_ACK:
+				hcan->ErrorCode |= HAL_CAN_ERROR_ACK;
+				break;
+			case 0:
+				break;
+			default:
+				hcan->ErrorCode |= HAL_CAN_ERROR_STF;
+				break;
+			}
+			Can->ESR &= ~CAN_ESR_LEC;
+		}
+		if (hcan->ErrorCode != HAL_CAN_ERROR_NONE && hcan->ErrorCallback != NULL)
+		{
+			hcan->ErrorCallback(hcan);
+		}
+	}
+}
+
+/*========================= HAL CAN driver =========================*/
+
+HAL_StatusTypeDef HAL_CAN_Init(CAN_HandleTypeDef *hcan)
+{
+	CAN_TypeDef *Can = hcan->Instance;
+
+	SIM_Consume(SIM_HAL_CALL_NS);
+	SIM_CAN_Reset(Can);
+	SIM_NodeAttachCan(hcan);
+
+	Can->MCR = CAN_MCR_INRQ;
+	Can->MCR |= (hcan->Init.TimeTriggeredMode == ENABLE) ? CAN_MCR_TTCM : 0U;
+	Can->MCR |= (hcan->Init.AutoBusOff == ENABLE) ? CAN_MCR_ABOM : 0U;
+	Can->MCR |= (hcan->Init.AutoWakeUp == ENABLE) ? CAN_MCR_AWUM : 0U;
+	Can->MCR |= (hcan->Init.AutoRetransmission == ENABLE) ? 0U : CAN_MCR_NART;
+	Can->MCR |= (hcan->Init.ReceiveFifoLocked == ENABLE) ? CAN_MCR_RFLM : 0U;
+	Can->MCR |= (hcan->Init.TransmitFifoPriority == ENABLE) ? CAN_MCR_TXFP : 0U;
+	Can->BTR = hcan->Init.Mode | hcan->Init.SyncJumpWidth | hcan->Init.TimeSeg1 |
+	           hcan->Init.TimeSeg2 | (hcan->Init.Prescaler - 1U);
+	hcan->ErrorCode = HAL_CAN_ERROR_NONE;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_ConfigFilter(CAN_HandleTypeDef *hcan, CAN_FilterTypeDef *sFilterConfig)
+{
+	CAN_TypeDef *Can = hcan->Instance;
+	uint32_t Bit = 1UL << (sFilterConfig->FilterBank & 0x1FU);
+
+	SIM_Consume(SIM_HAL_CALL_NS);
+	if (sFilterConfig->FilterBank >= SIM_CAN_FILTER_BANKS)
+	{
+		hcan->ErrorCode |= HAL_CAN_ERROR_PARAM;
+		return HAL_ERROR;
+	}
+
+	Can->FA1R &= ~Bit;
+	if (sFilterConfig->FilterScale == CAN_FILTERSCALE_16BIT)
+	{
+		Can->FS1R &= ~Bit;
+		Can->sFilterRegister[sFilterConfig->FilterBank].FR1 =
+			((0xFFFFU & sFilterConfig->FilterMaskIdLow) << 16) | (0xFFFFU & sFilterConfig->FilterIdLow);
+		Can->sFilterRegister[sFilterConfig->FilterBank].FR2 =
+			((0xFFFFU & sFilterConfig->FilterMaskIdHigh) << 16) | (0xFFFFU & sFilterConfig->FilterIdHigh);
+	}
+	else
+	{
+		Can->FS1R |= Bit;
+		Can->sFilterRegister[sFilterConfig->FilterBank].FR1 =
+			((0xFFFFU & sFilterConfig->FilterIdHigh) << 16) | (0xFFFFU & sFilterConfig->FilterIdLow);
+		Can->sFilterRegister[sFilterConfig->FilterBank].FR2 =
+			((0xFFFFU & sFilterConfig->FilterMaskIdHigh) << 16) | (0xFFFFU & sFilterConfig->FilterMaskIdLow);
+	}
+	Can->FM1R = (sFilterConfig->FilterMode == CAN_FILTERMODE_IDMASK) ? (Can->FM1R & ~Bit) : (Can->FM1R | Bit);
+	Can->FFA1R = (sFilterConfig->FilterFIFOAssignment == CAN_FILTER_FIFO0) ? (Can->FFA1R & ~Bit) : (Can->FFA1R | Bit);
+	if (sFilterConfig->FilterActivation == ENABLE)
+	{
+		Can->FA1R |= Bit;
+	}
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_Start(CAN_HandleTypeDef *hcan)
+{
+	SIM_Consume(SIM_HAL_CALL_NS);
+	hcan->Instance->MCR &= ~(CAN_MCR_INRQ | CAN_MCR_SLEEP);
+	hcan->Instance->MSR &= ~CAN_MSR_INAK;
+	hcan->ErrorCode = HAL_CAN_ERROR_NONE;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_ActivateNotification(CAN_HandleTypeDef *hcan, uint32_t ActiveITs)
+{
+	SIM_Consume(SIM_HAL_CALL_NS);
+	hcan->Instance->IER |= ActiveITs;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_AddTxMessage(CAN_HandleTypeDef *hcan, CAN_TxHeaderTypeDef *pHeader, uint8_t aData[], uint32_t *pTxMailbox)
+{
+	CAN_TypeDef *Can = hcan->Instance;
+	CAN_TxMailBox_TypeDef *Mailbox;
+	uint8_t Index;
+
+	SIM_Consume(SIM_HAL_CALL_NS);
+	for (Index = 0; Index < SIM_CAN_MAILBOXES; Index++)
+	{
+		if ((Can->TSR & (CAN_TSR_TME0 << Index)) != 0U)
+		{
+			break;
+		}
+	}
+	if (Index == SIM_CAN_MAILBOXES)
+	{
+		hcan->ErrorCode |= HAL_CAN_ERROR_PARAM;
+		return HAL_ERROR;
+	}
+
+	Mailbox = &Can->sTxMailBox[Index];
+	if (pHeader->IDE == CAN_ID_STD)
+	{
+		Mailbox->TIR = (pHeader->StdId << CAN_TI0R_STID_Pos) | pHeader->RTR;
+	}
+	else
+	{
+		Mailbox->TIR = (pHeader->ExtId << CAN_TI0R_EXID_Pos) | pHeader->IDE | pHeader->RTR;
+	}
+	Mailbox->TDTR = pHeader->DLC & CAN_TDT0R_DLC;
+	Mailbox->TDLR = ((uint32_t)aData[3] << 24) | ((uint32_t)aData[2] << 16) | ((uint32_t)aData[1] << 8) | aData[0];
+	Mailbox->TDHR = ((uint32_t)aData[7] << 24) | ((uint32_t)aData[6] << 16) | ((uint32_t)aData[5] << 8) | aData[4];
+
+	SIM_CAN_Request(Can, Index, SIM_Now());
+	Mailbox->TIR |= CAN_TI0R_TXRQ;
+
+	*pTxMailbox = 1UL << Index;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_AbortTxRequest(CAN_HandleTypeDef *hcan, uint32_t TxMailboxes)
+{
+	CAN_TypeDef *Can = hcan->Instance;
+	SIM_CanController_t *State = SIM_CAN_State(Can);
+
+	SIM_Consume(SIM_HAL_CALL_NS);
+	for (uint8_t Index = 0; Index < SIM_CAN_MAILBOXES; Index++)
+	{
+		if ((TxMailboxes & (1UL << Index)) == 0U || (Can->sTxMailBox[Index].TIR & CAN_TI0R_TXRQ) == 0U)
+		{
+			continue;
+		}
+		if (Bus.Busy && Bus.Transmitter == SIM_CAN_Owner(Can) && Bus.Mailbox == Index)
+		{
+			/* A frame on the bus completes, it is only dropped if it fails */
+			State->AbortPending[Index] = 1;
+		}
+		else
+		{
+			SIM_CAN_MailboxDone(Can, Index, 0);
+		}
+	}
+	return HAL_OK;
+}
+
+uint32_t HAL_CAN_GetTxMailboxesFreeLevel(CAN_HandleTypeDef *hcan)
+{
+	uint32_t Tsr;
+
+	SIM_Consume(SIM_HAL_CALL_NS);
+	Tsr = hcan->Instance->TSR;
+	return ((Tsr >> 26) & 1U) + ((Tsr >> 27) & 1U) + ((Tsr >> 28) & 1U);
+}
+
+uint32_t HAL_CAN_IsTxMessagePending(CAN_HandleTypeDef *hcan, uint32_t TxMailboxes)
+{
+	SIM_Consume(SIM_HAL_CALL_NS);
+	return (hcan->Instance->TSR & (TxMailboxes << 26)) != (TxMailboxes << 26);
+}
+
+uint32_t HAL_CAN_GetTxTimestamp(CAN_HandleTypeDef *hcan, uint32_t TxMailbox)
+{
+	uint8_t Index = (TxMailbox == CAN_TX_MAILBOX0) ? 0U : ((TxMailbox == CAN_TX_MAILBOX1) ? 1U : 2U);
+
+	SIM_Consume(SIM_HAL_CALL_NS);
+	return hcan->Instance->sTxMailBox[Index].TDTR >> CAN_TDT0R_TIME_Pos;
+}
+
+HAL_StatusTypeDef HAL_CAN_GetRxMessage(CAN_HandleTypeDef *hcan, uint32_t RxFifo, CAN_RxHeaderTypeDef *pHeader, uint8_t aData[])
+{
+	CAN_TypeDef *Can = hcan->Instance;
+	SIM_CanController_t *State = SIM_CAN_State(Can);
+	__IO uint32_t *Rfr = (RxFifo == CAN_RX_FIFO0) ? &Can->RF0R : &Can->RF1R;
+	CAN_FIFOMailBox_TypeDef *Head = &Can->sFIFOMailBox[RxFifo];
+	uint32_t Level;
+
+	SIM_Consume(SIM_HAL_CALL_NS);
+	Level = *Rfr & CAN_RF0R_FMP0;
+	if (Level == 0U)
+	{
+		hcan->ErrorCode |= HAL_CAN_ERROR_PARAM;
+		return HAL_ERROR;
+	}
+
+	pHeader->IDE = Head->RIR & CAN_TI0R_IDE;
+	pHeader->StdId = Head->RIR >> CAN_TI0R_STID_Pos;
+	pHeader->ExtId = Head->RIR >> CAN_TI0R_EXID_Pos;
+	pHeader->RTR = Head->RIR & CAN_TI0R_RTR;
+	pHeader->DLC = Head->RDTR & CAN_TDT0R_DLC;
+	pHeader->FilterMatchIndex = (Head->RDTR >> 8) & 0xFFU;
+	pHeader->Timestamp = Head->RDTR >> 16;
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		aData[i] = (uint8_t)(Head->RDLR >> (8U * i));
+		aData[i + 4] = (uint8_t)(Head->RDHR >> (8U * i));
+	}
+
+	/* Release the output mailbox (RFOM) */
+	State->FifoHead[RxFifo] = (State->FifoHead[RxFifo] + 1U) % SIM_CAN_FIFO_DEPTH;
+	Level--;
+	*Rfr = (*Rfr & ~(CAN_RF0R_FMP0 | CAN_RF0R_FULL0)) | Level;
+	if (Level != 0U)
+	{
+		*Head = State->Fifo[RxFifo][State->FifoHead[RxFifo]];
+	}
+	return HAL_OK;
+}
+
+uint32_t HAL_CAN_GetRxFifoFillLevel(CAN_HandleTypeDef *hcan, uint32_t RxFifo)
+{
+	SIM_Consume(SIM_HAL_CALL_NS);
+	return ((RxFifo == CAN_RX_FIFO0) ? hcan->Instance->RF0R : hcan->Instance->RF1R) & CAN_RF0R_FMP0;
+}
+
+uint32_t HAL_CAN_GetError(CAN_HandleTypeDef *hcan)
+{
+	return hcan->ErrorCode;
+}
+
+HAL_StatusTypeDef HAL_CAN_ResetError(CAN_HandleTypeDef *hcan)
+{
+	hcan->ErrorCode = HAL_CAN_ERROR_NONE;
+	return HAL_OK;
+}
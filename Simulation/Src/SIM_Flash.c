@@ -0,0 +1,190 @@
+/*================================================================
+ * 	File Name: SIM_Flash.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "SIM.h"
+#include "SIM_Cfg.h"
+#include "MCAL/FPEC/FPEC.h"
+#include "MCAL/FPEC/FPEC_Private.h"
+
+#define SIM_FLASH_OP_NONE       0U
+#define SIM_FLASH_OP_ERASE      1U
+#define SIM_FLASH_OP_PROGRAM    2U
+
+static volatile FPEC_t Registers;
+static uint8_t *Flash = NULL;
+static SIM_FlashStats_t Stats;
+
+static uint32_t LastKey = 0;
+static uint8_t Operation = SIM_FLASH_OP_NONE;
+static uint32_t OperationAddress = 0;
+static uint16_t OperationData = 0;
+static uint64_t BusyUntilNs = 0;
+
+static volatile uint16_t Latch = 0xFFFF;
+static uint32_t LatchAddress = 0;
+static uint8_t LatchPending = 0;
+
+static void SIM_FLASH_Unprotect(uint8_t Writable)
+{
+	if (mprotect(Flash, SIM_FLASH_SIZE, Writable ? (PROT_READ | PROT_WRITE) : PROT_READ) != 0)
+	{
+		perror("sim: mprotect");
+		exit(EXIT_FAILURE);
+	}
+}
+
+/* Apply the operation in progress, the controller becomes ready */
+static void SIM_FLASH_Finish(void)
+{
+	uint32_t Offset = OperationAddress - SIM_FLASH_BASE;
+
+	SIM_FLASH_Unprotect(1);
+	if (Operation == SIM_FLASH_OP_ERASE)
+	{
+		memset(&Flash[Offset & ~(SIM_FLASH_PAGE_SIZE - 1U)], 0xFF, SIM_FLASH_PAGE_SIZE);
+	}
+	else if (Operation == SIM_FLASH_OP_PROGRAM)
+	{
+		memcpy(&Flash[Offset], (const void *)&OperationData, sizeof(uint16_t));
+	}
+	SIM_FLASH_Unprotect(0);
+
+	Operation = SIM_FLASH_OP_NONE;
+	Registers.FLASH_SR &= ~(1UL << BSY);
+	Registers.FLASH_SR |= (1UL << EOP);
+}
+
+static uint8_t SIM_FLASH_InRange(uint32_t Address)
+{
+	return (Address >= SIM_FLASH_BASE) && (Address < (SIM_FLASH_BASE + SIM_FLASH_SIZE));
+}
+
+static void SIM_FLASH_Begin(uint8_t Op, uint32_t Address, uint64_t DurationNs)
+{
+	Operation = Op;
+	OperationAddress = Address;
+	BusyUntilNs = SIM_Now() + DurationNs;
+	Stats.BusyNs += DurationNs;
+	Registers.FLASH_SR = (Registers.FLASH_SR & ~(1UL << EOP)) | (1UL << BSY);
+}
+
+/* Act on what the driver wrote since its previous access */
+static void SIM_FLASH_Process(void)
+{
+	uint16_t Current;
+
+	/* Unlock sequence */
+	if (Registers.FLASH_KEYR != LastKey)
+	{
+		if (LastKey == FPEC_KEY_1 && Registers.FLASH_KEYR == FPEC_KEY_2)
+		{
+			Registers.FLASH_CR &= ~(1UL << LOCK);
+		}
+		LastKey = Registers.FLASH_KEYR;
+	}
+
+	if ((Registers.FLASH_SR & (1UL << BSY)) != 0U)
+	{
+		/* Code runs from flash: the CPU stalls on its next fetch until the operation is over */
+		if (BusyUntilNs > SIM_Now())
+		{
+			SIM_Consume(BusyUntilNs - SIM_Now());
+		}
+		SIM_FLASH_Finish();
+	}
+
+	if ((Registers.FLASH_CR & (1UL << LOCK)) != 0U)
+	{
+		Registers.FLASH_CR = (1UL << LOCK);
+		LatchPending = 0;
+		return;
+	}
+
+	if ((Registers.FLASH_CR & (1UL << STRT)) != 0U && (Registers.FLASH_CR & (1UL << PER)) != 0U)
+	{
+		Registers.FLASH_CR &= ~(1UL << STRT);
+		if (SIM_FLASH_InRange(Registers.FLASH_AR))
+		{
+			Stats.PageErases++;
+			SIM_FLASH_Begin(SIM_FLASH_OP_ERASE, Registers.FLASH_AR, SIM_FLASH_PAGE_ERASE_NS);
+		}
+	}
+	else if (LatchPending)
+	{
+		LatchPending = 0;
+		if ((Registers.FLASH_CR & (1UL << PG)) == 0U || !SIM_FLASH_InRange(LatchAddress) || (LatchAddress & 1U) != 0U)
+		{
+			/* A hard fault on the target, the program is aborted here */
+			fprintf(stderr, "sim: flash write at 0x%08X outside programming mode\n", (unsigned)LatchAddress);
+			exit(EXIT_FAILURE);
+		}
+		memcpy(&Current, &Flash[LatchAddress - SIM_FLASH_BASE], sizeof(Current));
+		if (Current != 0xFFFFU && Latch != 0U)
+		{
+			/* The location is not erased: nothing is programmed */
+			Stats.ProgramErrors++;
+			Registers.FLASH_SR |= (1UL << PGERR);
+			return;
+		}
+		Stats.HalfWordWrites++;
+		OperationData = Latch;
+		SIM_FLASH_Begin(SIM_FLASH_OP_PROGRAM, LatchAddress, SIM_FLASH_PROGRAM_NS);
+	}
+}
+
+volatile FPEC_t *SIM_FPEC_Access(void)
+{
+	SIM_Consume(SIM_REGISTER_ACCESS_NS);
+	SIM_FLASH_Process();
+	return &Registers;
+}
+
+volatile uint16_t *SIM_FPEC_HalfWord(uint32_t Address)
+{
+	SIM_Consume(SIM_REGISTER_ACCESS_NS);
+	SIM_FLASH_Process();
+	LatchAddress = Address;
+	LatchPending = 1;
+	return &Latch;
+}
+
+void SIM_FLASH_Init(void)
+{
+	/* The firmware reads the flash through its real addresses */
+	Flash = mmap((void *)SIM_FLASH_BASE, SIM_FLASH_SIZE, PROT_READ | PROT_WRITE,
+	             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+	if (Flash != (uint8_t *)SIM_FLASH_BASE)
+	{
+		fprintf(stderr, "sim: cannot map the flash at 0x%08lX\n", SIM_FLASH_BASE);
+		exit(EXIT_FAILURE);
+	}
+	memset(Flash, 0xFF, SIM_FLASH_SIZE);
+	SIM_FLASH_Unprotect(0);
+
+	memset((void *)&Registers, 0, sizeof(Registers));
+	Registers.FLASH_CR = (1UL << LOCK);
+	memset(&Stats, 0, sizeof(Stats));
+}
+
+void SIM_FLASH_Load(uint32_t Address, const uint8_t *Data, uint32_t Length)
+{
+	if (!SIM_FLASH_InRange(Address) || !SIM_FLASH_InRange(Address + Length - 1U))
+	{
+		fprintf(stderr, "sim: 0x%08lX is outside the flash\n", (unsigned long)Address);
+		exit(EXIT_FAILURE);
+	}
+	SIM_FLASH_Unprotect(1);
+	memcpy(&Flash[Address - SIM_FLASH_BASE], Data, Length);
+	SIM_FLASH_Unprotect(0);
+}
+
+const SIM_FlashStats_t *SIM_FLASH_GetStats(void)
+{
+	return &Stats;
+}
@@ -0,0 +1,59 @@
+/*================================================================
+ * 	File Name: SIM_Hal.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "SIM.h"
+#include "SIM_Cfg.h"
+
+uint32_t HAL_GetTick(void)
+{
+	SIM_Consume(SIM_HAL_CALL_NS);
+	return (uint32_t)(SIM_Now() / 1000000ULL);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+	uint64_t Until = SIM_Now() + ((uint64_t)Delay * 1000000ULL);
+
+	while (SIM_Now() < Until)
+	{
+		SIM_Consume(SIM_HAL_CALL_NS);
+	}
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	if (PinState != GPIO_PIN_RESET)
+	{
+		GPIOx->ODR |= GPIO_Pin;
+	}
+	else
+	{
+		GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+	}
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+	SIM_Consume(SIM_REGISTER_ACCESS_NS);
+	return ((GPIOx->ODR & GPIO_Pin) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+uint32_t SIM_TIM_GetCounter(TIM_HandleTypeDef *htim)
+{
+	uint64_t TickNs = ((uint64_t)(htim->Init.Prescaler + 1U) * 1000000000ULL) / SIM_SYSCLK_HZ;
+
+	SIM_Consume(SIM_REGISTER_ACCESS_NS);
+	return (uint32_t)((SIM_Now() / TickNs) % ((uint64_t)htim->Init.Period + 1U));
+}
+
+void Error_Handler(void)
+{
+	SIM_Node_t *Node = SIM_Current();
+
+	fprintf(stderr, "sim: Error_Handler on %s at %.6f s\n",
+	        (Node != NULL) ? SIM_NodeName(Node) : "host", (double)SIM_Now() / 1e9);
+	exit(EXIT_FAILURE);
+}
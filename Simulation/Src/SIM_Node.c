@@ -0,0 +1,268 @@
+/*================================================================
+ * 	File Name: SIM_Node.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "SIM.h"
+#include "SIM_Cfg.h"
+
+struct SIM_Node
+{
+	const char *Name;
+	void (*Main)(void);
+	ucontext_t Context;
+	uint8_t *Stack;
+	uint64_t Now;               /* Local time in ns */
+	uint8_t Index;
+	uint8_t Finished;
+	uint8_t ResetRequested;
+	uint8_t IrqMasked;          /* PRIMASK */
+	uint8_t InIrq;
+	uint32_t PendingIrq;
+	CAN_TypeDef Can;
+	CAN_HandleTypeDef *CanHandle;
+	DWT_Type DwtRegisters;
+	CoreDebug_Type CoreDebugRegisters;
+	GPIO_TypeDef Gpio[3];
+};
+
+static SIM_Node_t Nodes[SIM_MAX_NODES];
+static uint8_t NodeCount = 0;
+static SIM_Node_t *Current = NULL;
+static ucontext_t SchedulerContext;
+
+static void SIM_NodeEntry(void)
+{
+	Current->Main();
+	Current->Finished = 1;
+	/* uc_link returns to the scheduler */
+}
+
+static void SIM_NodeStart(SIM_Node_t *Node)
+{
+	Node->Finished = 0;
+	Node->ResetRequested = 0;
+	Node->IrqMasked = 0;
+	Node->InIrq = 0;
+	Node->PendingIrq = 0;
+	Node->CanHandle = NULL;
+	memset(&Node->DwtRegisters, 0, sizeof(Node->DwtRegisters));
+	memset(&Node->CoreDebugRegisters, 0, sizeof(Node->CoreDebugRegisters));
+	memset(Node->Gpio, 0, sizeof(Node->Gpio));
+	SIM_CAN_Reset(&Node->Can);
+
+	getcontext(&Node->Context);
+	Node->Context.uc_stack.ss_sp = Node->Stack;
+	Node->Context.uc_stack.ss_size = SIM_NODE_STACK_SIZE;
+	Node->Context.uc_link = &SchedulerContext;
+	makecontext(&Node->Context, SIM_NodeEntry, 0);
+}
+
+/* Take the pending interrupts of the current node, highest priority (lowest line) first */
+static void SIM_TakeIrqs(void)
+{
+	SIM_Node_t *Node = Current;
+	uint32_t Irq;
+
+	while (Node->PendingIrq != 0U && !Node->IrqMasked && !Node->InIrq)
+	{
+		Irq = Node->PendingIrq & (~Node->PendingIrq + 1U);
+		Node->PendingIrq &= ~Irq;
+		Node->InIrq = 1;
+		Node->Now += SIM_IRQ_OVERHEAD_NS;
+		SIM_CAN_Interrupt(Node, Irq);
+		Node->InIrq = 0;
+	}
+}
+
+SIM_Node_t *SIM_NodeCreate(const char *Name, void (*Main)(void))
+{
+	SIM_Node_t *Node;
+
+	if (NodeCount >= SIM_MAX_NODES)
+	{
+		fprintf(stderr, "sim: too many nodes\n");
+		exit(EXIT_FAILURE);
+	}
+	Node = &Nodes[NodeCount];
+	Node->Name = Name;
+	Node->Main = Main;
+	Node->Index = NodeCount;
+	Node->Now = 0;
+	Node->Stack = malloc(SIM_NODE_STACK_SIZE);
+	if (Node->Stack == NULL)
+	{
+		fprintf(stderr, "sim: out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+	NodeCount++;
+	SIM_NodeStart(Node);
+	return Node;
+}
+
+void SIM_NodeReset(SIM_Node_t *Node)
+{
+	if (Node == Current)
+	{
+		/* Never returns, the scheduler restarts the node from its entry point */
+		Node->ResetRequested = 1;
+		swapcontext(&Node->Context, &SchedulerContext);
+	}
+	SIM_NodeStart(Node);
+}
+
+uint8_t SIM_NodeFinished(const SIM_Node_t *Node)
+{
+	return Node->Finished;
+}
+
+uint64_t SIM_Run(const SIM_Node_t *Watch, uint64_t UntilNs)
+{
+	SIM_Node_t *Next;
+	uint64_t Reached = 0;
+
+	while (1)
+	{
+		if (Watch != NULL && Watch->Finished)
+		{
+			break;
+		}
+
+		/* Resume the node that is furthest behind, the others wait for it */
+		Next = NULL;
+		for (uint8_t i = 0; i < NodeCount; i++)
+		{
+			if (!Nodes[i].Finished && (Next == NULL || Nodes[i].Now < Next->Now))
+			{
+				Next = &Nodes[i];
+			}
+		}
+		if (Next == NULL || Next->Now >= UntilNs)
+		{
+			break;
+		}
+		Reached = Next->Now;
+
+		SIM_CAN_Advance(Next->Now);
+		Current = Next;
+		swapcontext(&SchedulerContext, &Next->Context);
+		Current = NULL;
+
+		if (Next->ResetRequested)
+		{
+			SIM_NodeStart(Next);
+		}
+	}
+
+	for (uint8_t i = 0; i < NodeCount; i++)
+	{
+		if (Nodes[i].Now > Reached)
+		{
+			Reached = Nodes[i].Now;
+		}
+	}
+	return Reached;
+}
+
+SIM_Node_t *SIM_Current(void)
+{
+	return Current;
+}
+
+uint64_t SIM_Now(void)
+{
+	return (Current != NULL) ? Current->Now : 0U;
+}
+
+void SIM_Consume(uint64_t Ns)
+{
+	if (Current == NULL)
+	{
+		return;
+	}
+	SIM_CAN_TakeRequests(&Current->Can, Current->Now);
+	Current->Now += Ns;
+	swapcontext(&Current->Context, &SchedulerContext);
+	SIM_TakeIrqs();
+}
+
+void SIM_RaiseIrq(SIM_Node_t *Node, uint32_t Irq)
+{
+	Node->PendingIrq |= Irq;
+}
+
+CAN_TypeDef *SIM_NodeCan(SIM_Node_t *Node)
+{
+	return &Node->Can;
+}
+
+void SIM_NodeAttachCan(CAN_HandleTypeDef *hcan)
+{
+	Current->CanHandle = hcan;
+}
+
+CAN_HandleTypeDef *SIM_NodeCanHandle(SIM_Node_t *Node)
+{
+	return Node->CanHandle;
+}
+
+uint8_t SIM_NodeIndex(const SIM_Node_t *Node)
+{
+	return Node->Index;
+}
+
+SIM_Node_t *SIM_NodeAt(uint8_t Index)
+{
+	return (Index < NodeCount) ? &Nodes[Index] : NULL;
+}
+
+/*========================= Core peripherals =========================*/
+
+DWT_Type *SIM_Dwt(void)
+{
+	/* The cycle counter follows the local time while it is enabled */
+	if ((Current->DwtRegisters.CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0U)
+	{
+		Current->DwtRegisters.CYCCNT = (uint32_t)((Current->Now * (SIM_SYSCLK_HZ / 1000000ULL)) / 1000ULL);
+	}
+	return &Current->DwtRegisters;
+}
+
+CoreDebug_Type *SIM_CoreDebug(void)
+{
+	return &Current->CoreDebugRegisters;
+}
+
+void SIM_DisableIrq(void)
+{
+	Current->IrqMasked = 1;
+}
+
+void SIM_EnableIrq(void)
+{
+	Current->IrqMasked = 0;
+	SIM_TakeIrqs();
+}
+
+void SIM_SystemReset(void)
+{
+	SIM_NodeReset(Current);
+}
+
+GPIO_TypeDef *SIM_Gpio(uint8_t Port)
+{
+	return &Current->Gpio[Port];
+}
+
+const char *SIM_NodeName(const SIM_Node_t *Node)
+{
+	return Node->Name;
+}
+
+CAN_TypeDef *SIM_Can1(void)
+{
+	return &Current->Can;
+}
@@ -0,0 +1,347 @@
+/*================================================================
+ * 	File Name: SenderNode.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <string.h>
+
+#include "main.h"
+#include "SRV/TRANSFER/TRANSFER.h"
+#include "SRV/RTO/RTO.h"
+#include "SIM.h"
+#include "SIM_Nodes.h"
+#include "CRC/CRC.h"
+#include "IMAGE/IMAGE.h"
+
+/* Size of the receiver slot, the largest image or benchmark payload */
+#define SENDER_SLOT_SIZE            (30UL * 1024UL)
+/* Load address of the full images, slot A of the receiver */
+#define SENDER_SLOT_ADDRESS         0x0800DC00UL
+/* Load address of a delta update, slot B next to the image in slot A it is made against */
+#define SENDER_SLOT_B_ADDRESS       0x08015400UL
+
+/* The bytes a delta update changes start here */
+#define SENDER_PATCH_OFFSET         3000UL
+/* Operation tags of SRV/DELTA */
+#define SENDER_DELTA_COPY           0x01U
+#define SENDER_DELTA_INSERT         0x02U
+/* Extent tags of SRV/SPARSE and the shortest run sent as a fill, as in HostFlasher */
+#define SENDER_SPARSE_DATA          0x01U
+#define SENDER_SPARSE_FILL          0x02U
+#define SENDER_SPARSE_MIN_FILL      16UL
+/* Block at the end of a sparse image, after its erased gap */
+#define SENDER_TAIL_SIZE            1024UL
+
+/* Same names as in Firmware_Sender/Core/Src/main.c, each node has its own copy */
+static TIM_HandleTypeDef htim1;
+static CAN_HandleTypeDef hcan;
+static CAN_FilterTypeDef FilterConfig;
+static CAN_RxHeaderTypeDef RxHeader;
+static uint8_t RxData[8];
+
+static uint8_t BenchPayload[SENDER_SLOT_SIZE];
+static uint8_t SampleImage[SENDER_SLOT_SIZE];                         /* Image of dataToWrite */
+static uint8_t BuiltImage[SENDER_SLOT_SIZE];                          /* Image of a delta or sparse update */
+static uint8_t EncodedStream[IMAGE_HEADER_SIZE + SENDER_SLOT_SIZE];   /* Header and stream */
+
+SIM_SenderRun_t SIM_SenderRun;
+
+static void SenderRxFifo0MsgPending(CAN_HandleTypeDef *Can)
+{
+	if (HAL_CAN_GetRxMessage(Can, CAN_RX_FIFO0, &RxHeader, RxData) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	SRV_TRANSFER_RxIndication(&RxHeader, RxData);
+}
+
+static void SenderError(CAN_HandleTypeDef *Can)
+{
+	HAL_CAN_ResetError(Can);
+}
+
+
+static uint8_t BenchByte(uint32_t Offset)
+{
+	return BenchPayload[Offset];
+}
+
+const uint8_t *SIM_SenderImage(uint32_t *Length)
+{
+	/* The payload words of the frame records, past the header */
+	for (uint32_t Offset = 0; Offset < dataToWriteSize - IMAGE_HEADER_SIZE; Offset++)
+	{
+		uint32_t Frame = (IMAGE_HEADER_SIZE + Offset) / CHUNK_SIZE;
+		uint32_t Byte = (IMAGE_HEADER_SIZE + Offset) % CHUNK_SIZE;
+		uint32_t Word = (Byte < 4U) ? dataToWrite[Frame].TDLR : dataToWrite[Frame].TDHR;
+
+		SampleImage[Offset] = (uint8_t)(Word >> (8U * (Byte % 4U)));
+	}
+	*Length = dataToWriteSize - IMAGE_HEADER_SIZE;
+	return SampleImage;
+}
+
+static uint8_t EncodedByte(uint32_t Offset)
+{
+	return EncodedStream[Offset];
+}
+
+static uint32_t PutNumber(uint32_t Size, uint32_t Value)
+{
+	do
+	{
+		EncodedStream[Size++] = (uint8_t)((Value & 0x7FU) | ((Value > 0x7FU) ? 0x80U : 0U));
+		Value >>= 7;
+	} while (Value != 0U);
+	return Size;
+}
+
+/* A patch release as the host tools would encode it: copy, insert the changed bytes, copy the rest */
+static void RunDelta(void)
+{
+	SRV_IMAGE_Header_t Header = {0};
+	uint32_t Length;
+	const uint8_t *Base = SIM_SenderImage(&Length);
+	uint32_t Changed = SIM_SenderRun.DeltaBytes;
+	uint32_t Size = IMAGE_HEADER_SIZE;
+	uint32_t FirstFrame;
+
+	if (Changed > (Length - SENDER_PATCH_OFFSET))
+	{
+		Changed = Length - SENDER_PATCH_OFFSET;
+	}
+	memcpy(BuiltImage, Base, Length);
+	for (uint32_t i = 0; i < Changed; i++)
+	{
+		BuiltImage[SENDER_PATCH_OFFSET + i] = (uint8_t)~Base[SENDER_PATCH_OFFSET + i];
+	}
+	SIM_SenderRun.Payload = BuiltImage;
+	SIM_SenderRun.PayloadSize = Length;
+	SIM_SenderRun.SlotAddress = SENDER_SLOT_B_ADDRESS;
+
+	EncodedStream[Size++] = SENDER_DELTA_COPY;
+	Size = PutNumber(Size, SENDER_PATCH_OFFSET);
+	Size = PutNumber(Size, 0);
+	EncodedStream[Size++] = SENDER_DELTA_INSERT;
+	Size = PutNumber(Size, Changed);
+	memcpy(&EncodedStream[Size], &BuiltImage[SENDER_PATCH_OFFSET], Changed);
+	Size += Changed;
+	if (SENDER_PATCH_OFFSET + Changed < Length)
+	{
+		EncodedStream[Size++] = SENDER_DELTA_COPY;
+		Size = PutNumber(Size, Length - SENDER_PATCH_OFFSET - Changed);
+		Size = PutNumber(Size, SENDER_PATCH_OFFSET + Changed);
+	}
+
+	Header.Flags = IMAGE_FLAG_DELTA;
+	Header.Length = Length;
+	Header.LoadAddress = SENDER_SLOT_B_ADDRESS;
+	Header.Version = 2;
+	Header.ImageCrc = SRV_CRC_Update(CRC_INITIAL, BuiltImage, Length);
+	Header.StreamSize = Size - IMAGE_HEADER_SIZE;
+	Header.BaseLength = Length;
+	Header.BaseCrc = SRV_CRC_Update(CRC_INITIAL, Base, Length);
+	SRV_IMAGE_Build(&Header, EncodedStream);
+	SIM_SenderRun.StreamSize = Header.StreamSize;
+
+	if (SRV_TRANSFER_OpenImage(EncodedByte, &FirstFrame))
+	{
+		SIM_SenderRun.Completed = SRV_TRANSFER_Send(EncodedByte, Size, FirstFrame);
+	}
+}
+
+static uint32_t PutData(uint32_t Size, uint32_t Start, uint32_t End)
+{
+	if (End > Start)
+	{
+		EncodedStream[Size++] = SENDER_SPARSE_DATA;
+		Size = PutNumber(Size, End - Start);
+		memcpy(&EncodedStream[Size], &BuiltImage[Start], End - Start);
+		Size += End - Start;
+	}
+	return Size;
+}
+
+/* The image followed by an erased gap and a block at its end, sent as extents */
+static void RunSparse(void)
+{
+	SRV_IMAGE_Header_t Header = {0};
+	uint32_t Length;
+	const uint8_t *Image = SIM_SenderImage(&Length);
+	uint32_t Total = Length + SIM_SenderRun.SparseGap + SENDER_TAIL_SIZE;
+	uint32_t Size = IMAGE_HEADER_SIZE;
+	uint32_t DataStart = 0;
+	uint32_t Position = 0;
+	uint32_t RunEnd;
+	uint32_t FirstFrame;
+
+	if (Total > SENDER_SLOT_SIZE)
+	{
+		Total = SENDER_SLOT_SIZE;
+	}
+	memset(BuiltImage, 0xFF, Total);
+	memcpy(BuiltImage, Image, Length);
+	memcpy(&BuiltImage[Total - SENDER_TAIL_SIZE], Image, SENDER_TAIL_SIZE);
+	SIM_SenderRun.Payload = BuiltImage;
+	SIM_SenderRun.PayloadSize = Total;
+	SIM_SenderRun.SlotAddress = SENDER_SLOT_ADDRESS;
+
+	while (Position < Total)
+	{
+		RunEnd = Position + 1U;
+		while ((RunEnd < Total) && (BuiltImage[RunEnd] == BuiltImage[Position]))
+		{
+			RunEnd++;
+		}
+		if ((RunEnd - Position) >= SENDER_SPARSE_MIN_FILL)
+		{
+			Size = PutData(Size, DataStart, Position);
+			EncodedStream[Size++] = SENDER_SPARSE_FILL;
+			Size = PutNumber(Size, RunEnd - Position);
+			EncodedStream[Size++] = BuiltImage[Position];
+			DataStart = RunEnd;
+		}
+		Position = RunEnd;
+	}
+	Size = PutData(Size, DataStart, Total);
+
+	Header.Flags = IMAGE_FLAG_SPARSE;
+	Header.Length = Total;
+	Header.LoadAddress = SENDER_SLOT_ADDRESS;
+	Header.Version = 3;
+	Header.ImageCrc = SRV_CRC_Update(CRC_INITIAL, BuiltImage, Total);
+	Header.StreamSize = Size - IMAGE_HEADER_SIZE;
+	SRV_IMAGE_Build(&Header, EncodedStream);
+	SIM_SenderRun.StreamSize = Header.StreamSize;
+
+	if (SRV_TRANSFER_OpenImage(EncodedByte, &FirstFrame))
+	{
+		SIM_SenderRun.Completed = SRV_TRANSFER_Send(EncodedByte, Size, FirstFrame);
+	}
+}
+
+static void RunBenchmark(void)
+{
+	uint32_t Size = SIM_SenderRun.BenchSize;
+	uint8_t Cmd[5] = {CMD_BENCH_START, (uint8_t)Size, (uint8_t)(Size >> 8), (uint8_t)(Size >> 16), (uint8_t)(Size >> 24)};
+	uint8_t Response[8];
+
+	if (Size > SENDER_SLOT_SIZE)
+	{
+		Size = SENDER_SLOT_SIZE;
+	}
+	for (uint32_t Offset = 0; Offset < Size; Offset++)
+	{
+		BenchPayload[Offset] = (uint8_t)((Offset * 7U) ^ (Offset >> 8));
+	}
+	SIM_SenderRun.Payload = BenchPayload;
+	SIM_SenderRun.PayloadSize = Size;
+	/* The inactive slot, slot A of a receiver without an image */
+	SIM_SenderRun.SlotAddress = SENDER_SLOT_ADDRESS;
+
+	if (!SRV_TRANSFER_Command(Cmd, sizeof(Cmd), NULL))
+	{
+		return;
+	}
+	SIM_SenderRun.Completed = SRV_TRANSFER_Send(BenchByte, Size, 0);
+	if (!SIM_SenderRun.Completed)
+	{
+		return;
+	}
+
+	Cmd[0] = CMD_BENCH_RESULT;
+	for (uint8_t Index = 0; Index < SIM_BENCH_RESULTS; Index++)
+	{
+		Cmd[1] = Index;
+		if (SRV_TRANSFER_Command(Cmd, 2, Response) && Response[1] == Index)
+		{
+			SIM_SenderRun.BenchResult[Index] = (uint32_t)Response[2] | ((uint32_t)Response[3] << 8) |
+			                                   ((uint32_t)Response[4] << 16) | ((uint32_t)Response[5] << 24);
+		}
+	}
+
+	Cmd[0] = CMD_READ_LINK;
+	SIM_SenderRun.LinkRead = SRV_TRANSFER_Command(Cmd, 1, SIM_SenderRun.Link);
+}
+
+void SIM_SenderMain(void)
+{
+	uint32_t FirstFrame;
+
+	hcan.Instance = CAN1;
+	hcan.Init.Prescaler = 16;
+	hcan.Init.Mode = CAN_MODE_NORMAL;
+	hcan.Init.SyncJumpWidth = CAN_SJW_1TQ;
+	hcan.Init.TimeSeg1 = CAN_BS1_2TQ;
+	hcan.Init.TimeSeg2 = CAN_BS2_2TQ;
+	hcan.Init.TimeTriggeredMode = DISABLE;
+	hcan.Init.AutoBusOff = ENABLE;
+	hcan.Init.AutoWakeUp = DISABLE;
+	hcan.Init.AutoRetransmission = ENABLE;
+	hcan.Init.ReceiveFifoLocked = DISABLE;
+	hcan.Init.TransmitFifoPriority = ENABLE;
+	hcan.RxFifo0MsgPendingCallback = SenderRxFifo0MsgPending;
+	hcan.ErrorCallback = SenderError;
+	if (HAL_CAN_Init(&hcan) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	/* 10us tick over the full 16-bit range */
+	htim1.Init.Prescaler = 80 - 1;
+	htim1.Init.Period = 0xffff;
+
+	FilterConfig.FilterActivation = ENABLE;
+	FilterConfig.FilterFIFOAssignment = CAN_FILTER_FIFO0;
+	FilterConfig.FilterBank = 0;
+	FilterConfig.FilterMode = CAN_FILTERMODE_IDMASK;
+	FilterConfig.FilterScale = CAN_FILTERSCALE_32BIT;
+	FilterConfig.FilterIdHigh = (ACK_FRAME_ID << 5);
+	FilterConfig.FilterIdLow = 0x0000;
+	FilterConfig.FilterMaskIdHigh = (0xFFFF << 5);
+	FilterConfig.FilterMaskIdLow = 0x0000;
+	if (HAL_CAN_ConfigFilter(&hcan, &FilterConfig) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	FilterConfig.FilterBank = 1;
+	FilterConfig.FilterIdHigh = (RESP_FRAME_ID << 5);
+	if (HAL_CAN_ConfigFilter(&hcan, &FilterConfig) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	HAL_CAN_Start(&hcan);
+	if (HAL_CAN_ActivateNotification(&hcan, CAN_IT_RX_FIFO0_MSG_PENDING) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	SRV_TRANSFER_Init(&hcan, &htim1);
+
+	SIM_SenderRun.Completed = 0;
+	if (SIM_SenderRun.BenchSize != 0U)
+	{
+		RunBenchmark();
+	}
+	else if (SIM_SenderRun.DeltaBytes != 0U)
+	{
+		RunDelta();
+	}
+	else if (SIM_SenderRun.SparseGap != 0U)
+	{
+		RunSparse();
+	}
+	else
+	{
+		SIM_SenderRun.Payload = SIM_SenderImage(&SIM_SenderRun.PayloadSize);
+		SIM_SenderRun.SlotAddress = SENDER_SLOT_ADDRESS;
+		(void)SRV_TRANSFER_EnterUpdate();
+		if (SRV_TRANSFER_OpenTable(dataToWrite, &FirstFrame))
+		{
+			SIM_SenderRun.ResumeFrame = FirstFrame - (IMAGE_HEADER_SIZE / CHUNK_SIZE);
+			SIM_SenderRun.Completed = SRV_TRANSFER_SendTable(dataToWrite, (dataToWriteSize + CHUNK_SIZE - 1) / CHUNK_SIZE,
+			                                                 FirstFrame);
+		}
+	}
+	SIM_SenderRun.Retransmissions = SRV_RTO_GetRetransmissions();
+	SIM_SenderRun.SmoothedRtt = SRV_RTO_GetSmoothedRtt();
+}
@@ -0,0 +1,269 @@
+/*================================================================
+ * 	File Name: SimUpdate.c
+ * 	Created on: Oct 18, 2026
+ *================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "SIM.h"
+#include "SIM_Cfg.h"
+#include "SIM_Nodes.h"
+
+/* CMD_BENCH_RESULT indexes, see Firmware_Receiver SRV/BENCH/BENCH.h */
+#define BENCH_RESULT_FRAMES             0U
+#define BENCH_RESULT_ISR_CYCLES         1U
+#define BENCH_RESULT_FLASH_CYCLES       2U
+#define BENCH_RESULT_PAGES              3U
+
+/* Sender TIM1 tick */
+#define SENDER_TICK_US                  10U
+
+typedef struct
+{
+	uint32_t ErrorPpm;
+	uint32_t DropPpm;
+	uint32_t Seed;
+	double ResetAtMs;           /* Power cycle of both boards, 0 for none */
+	uint32_t BenchSize;
+	uint32_t DeltaBytes;
+	uint32_t SparseGap;
+	uint32_t AgentJobUs;        /* Application with the update agent instead of the receiver, 0 for none */
+	uint8_t Enter;              /* The application resets into the receiver for the update */
+	double LimitS;
+} Options_t;
+
+static void Usage(const char *Name)
+{
+	fprintf(stderr,
+	        "usage: %s [--errors PPM] [--drop PPM] [--seed N] [--reset-at MS] [--bench BYTES] [--delta BYTES] [--sparse BYTES]\n"
+	        "       [--agent US] [--enter US] [--limit S]\n"
+	        "  --errors   probability of a bit error per frame, in ppm\n"
+	        "  --drop     probability that the receivers lose a correct frame, in ppm\n"
+	        "  --seed     seed of the fault injection\n"
+	        "  --reset-at power cycle both boards at this simulated time\n"
+	        "  --bench    run a benchmark session of this size instead of an image update\n"
+	        "  --delta    update with a delta that changes this many bytes of the image in the slot\n"
+	        "  --sparse   update with the image, this many erased bytes and a 1KB tail, sent as extents\n"
+	        "  --agent    update an application running from slot A with the update agent, the application\n"
+	        "             works this long between two agent calls; needs --delta, whose image is for slot B\n"
+	        "  --enter    the same application, asked by the sender to reset into the receiver through\n"
+	        "             the boot mailbox, which then takes the image\n"
+	        "  --limit    simulated time limit in seconds (default 120)\n", Name);
+	exit(2);
+}
+
+static void ParseOptions(int argc, char **argv, Options_t *Options)
+{
+	memset(Options, 0, sizeof(*Options));
+	Options->Seed = 1;
+	Options->LimitS = 120.0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (i + 1 >= argc)
+		{
+			Usage(argv[0]);
+		}
+		if (strcmp(argv[i], "--errors") == 0)
+		{
+			Options->ErrorPpm = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--drop") == 0)
+		{
+			Options->DropPpm = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--seed") == 0)
+		{
+			Options->Seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--reset-at") == 0)
+		{
+			Options->ResetAtMs = strtod(argv[++i], NULL);
+		}
+		else if (strcmp(argv[i], "--bench") == 0)
+		{
+			Options->BenchSize = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--delta") == 0)
+		{
+			Options->DeltaBytes = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--sparse") == 0)
+		{
+			Options->SparseGap = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--agent") == 0)
+		{
+			Options->AgentJobUs = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--enter") == 0)
+		{
+			Options->AgentJobUs = (uint32_t)strtoul(argv[++i], NULL, 0);
+			Options->Enter = 1;
+		}
+		else if (strcmp(argv[i], "--limit") == 0)
+		{
+			Options->LimitS = strtod(argv[++i], NULL);
+		}
+		else
+		{
+			Usage(argv[0]);
+		}
+	}
+	/* The application runs from slot A, only the delta image is linked for slot B */
+	if (Options->AgentJobUs != 0U && Options->DeltaBytes == 0U && !Options->Enter)
+	{
+		Usage(argv[0]);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	Options_t Options;
+	SIM_Node_t *Receiver;
+	SIM_Node_t *Sender;
+	SIM_Node_t *Watch;
+	const SIM_CanStats_t *Can;
+	const SIM_FlashStats_t *Flash;
+	uint64_t Limit;
+	uint64_t End;
+	double Seconds;
+	uint8_t SlotOk;
+	uint8_t Passed;
+	const uint8_t *Base;
+	uint32_t BaseLength;
+
+	ParseOptions(argc, argv, &Options);
+	Limit = (uint64_t)(Options.LimitS * 1e9);
+
+	SIM_FLASH_Init();
+	SIM_CAN_SetFaults(Options.ErrorPpm, Options.DropPpm, Options.Seed);
+	SIM_SenderRun.BenchSize = Options.BenchSize;
+	SIM_SenderRun.DeltaBytes = Options.DeltaBytes;
+	SIM_SenderRun.SparseGap = Options.SparseGap;
+	SIM_AgentRun.JobUs = Options.AgentJobUs;
+	if (Options.DeltaBytes != 0U || Options.Enter)
+	{
+		/* The slot holds the sender's image from an earlier update */
+		Base = SIM_SenderImage(&BaseLength);
+		SIM_FLASH_Load(SIM_ReceiverSlotAddress, Base, BaseLength);
+	}
+	if (Options.Enter)
+	{
+		/* The agent leaves through the table of the bootloader it runs under */
+		SIM_BootApiLoad();
+	}
+
+	Receiver = SIM_NodeCreate("receiver", Options.Enter ? SIM_BootMain :
+	                                      (Options.AgentJobUs != 0U) ? SIM_AgentMain : SIM_ReceiverMain);
+	Sender = SIM_NodeCreate("sender", SIM_SenderMain);
+
+	/* The receiver ends an update with its reset, a benchmark ends with the sender */
+	Watch = (Options.BenchSize != 0U) ? Sender : Receiver;
+
+	if (Options.ResetAtMs > 0.0)
+	{
+		SIM_Run(Watch, (uint64_t)(Options.ResetAtMs * 1e6));
+		if (SIM_NodeFinished(Watch))
+		{
+			fprintf(stderr, "sim: the transfer ended before the reset\n");
+			return EXIT_FAILURE;
+		}
+		printf("power cycle at    %.3f ms\n", Options.ResetAtMs);
+		SIM_NodeReset(Receiver);
+		SIM_NodeReset(Sender);
+	}
+	End = SIM_Run(Watch, Limit);
+	/* Let the sender see the last ACK */
+	SIM_Run(Sender, Limit);
+
+	Can = SIM_CAN_GetStats();
+	Flash = SIM_FLASH_GetStats();
+	Seconds = (double)End / 1e9;
+
+	SlotOk = SIM_NodeFinished(Watch) && SIM_SenderRun.Completed && SIM_SenderRun.Payload != NULL &&
+	         SIM_SenderRun.PayloadSize <= SIM_ReceiverSlotSize &&
+	         memcmp((const void *)(uintptr_t)SIM_SenderRun.SlotAddress, SIM_SenderRun.Payload, SIM_SenderRun.PayloadSize) == 0;
+	/* An update switches the bootloader to the slot it programmed */
+	if (Options.BenchSize == 0U && SIM_ReceiverActiveSlot() != SIM_SenderRun.SlotAddress)
+	{
+		SlotOk = 0;
+	}
+	Passed = SlotOk && (Flash->ProgramErrors == 0U);
+	/* The application only stalls for a page erase, the programming is spread over the calls */
+	if (Options.AgentJobUs != 0U && SIM_AgentRun.LongestCallNs > SIM_FLASH_PAGE_ERASE_NS + 1000000ULL)
+	{
+		Passed = 0;
+	}
+	/* The receiver reports the state of its controller after a benchmark */
+	if (Options.BenchSize != 0U && !SIM_SenderRun.LinkRead)
+	{
+		Passed = 0;
+	}
+	/* One warm reset through the service table, the receiver took the image, and the bootloader started it without its menu */
+	if (Options.Enter && (SIM_AgentRun.Leaves != 1U || SIM_AgentRun.TableRequests != 1U || SIM_AgentRun.Starts != 1U))
+	{
+		Passed = 0;
+	}
+	/* After a power cycle the pages already in flash must not be sent again */
+	if (Options.ResetAtMs > 0.0 && Options.BenchSize == 0U && Options.DeltaBytes == 0U && Options.SparseGap == 0U &&
+		SIM_SenderRun.ResumeFrame == 0U)
+	{
+		Passed = 0;
+	}
+
+	printf("mode              %s%s\n", Options.Enter ? "warm reset, " : (Options.AgentJobUs != 0U) ? "agent, " : "",
+	                                  (Options.BenchSize != 0U) ? "benchmark" :
+	                                  (Options.DeltaBytes != 0U) ? "delta update" :
+	                                  (Options.SparseGap != 0U) ? "sparse update" : "image update");
+	printf("payload           %u bytes\n", (unsigned)SIM_SenderRun.PayloadSize);
+	printf("slot              0x%08x\n", (unsigned)SIM_SenderRun.SlotAddress);
+	if (Options.DeltaBytes != 0U)
+	{
+		printf("delta             %u bytes\n", (unsigned)SIM_SenderRun.StreamSize);
+	}
+	else if (Options.SparseGap != 0U)
+	{
+		printf("extents           %u bytes\n", (unsigned)SIM_SenderRun.StreamSize);
+	}
+	printf("simulated time    %.3f s\n", Seconds);
+	printf("frames on bus     %llu (%.0f frames/s)\n", (unsigned long long)Can->Frames,
+	       (Seconds > 0.0) ? (double)Can->Frames / Seconds : 0.0);
+	printf("goodput           %.0f bytes/s\n", (Seconds > 0.0) ? (double)SIM_SenderRun.PayloadSize / Seconds : 0.0);
+	printf("bus load          %.1f %%\n", (End > 0U) ? (100.0 * (double)Can->BusyNs / (double)End) : 0.0);
+	printf("error frames      %llu\n", (unsigned long long)Can->ErrorFrames);
+	printf("dropped frames    %llu\n", (unsigned long long)Can->DroppedFrames);
+	printf("fifo overruns     %llu\n", (unsigned long long)Can->Overruns);
+	printf("retransmissions   %u\n", (unsigned)SIM_SenderRun.Retransmissions);
+	printf("smoothed rtt      %u us\n", (unsigned)SIM_SenderRun.SmoothedRtt * SENDER_TICK_US);
+	printf("resume frame      %u\n", (unsigned)SIM_SenderRun.ResumeFrame);
+	printf("flash erases      %llu\n", (unsigned long long)Flash->PageErases);
+	printf("flash writes      %llu half-words, %llu program errors\n",
+	       (unsigned long long)Flash->HalfWordWrites, (unsigned long long)Flash->ProgramErrors);
+	printf("flash busy        %.1f %%\n", (End > 0U) ? (100.0 * (double)Flash->BusyNs / (double)End) : 0.0);
+	if (Options.Enter)
+	{
+		printf("warm resets       %u\n", (unsigned)SIM_AgentRun.Leaves);
+		printf("table requests    %u\n", (unsigned)SIM_AgentRun.TableRequests);
+		printf("auto starts       %u\n", (unsigned)SIM_AgentRun.Starts);
+	}
+	else if (Options.AgentJobUs != 0U)
+	{
+		printf("agent calls       %llu\n", (unsigned long long)SIM_AgentRun.Calls);
+		printf("longest call      %.3f ms\n", (double)SIM_AgentRun.LongestCallNs / 1e6);
+		printf("agent share       %.1f %%\n", (End > 0U) ? (100.0 * (double)SIM_AgentRun.AgentNs / (double)End) : 0.0);
+	}
+	if (Options.BenchSize != 0U)
+	{
+		printf("receiver frames   %u\n", (unsigned)SIM_SenderRun.BenchResult[BENCH_RESULT_FRAMES]);
+		printf("cycles per frame  %u\n", (unsigned)SIM_SenderRun.BenchResult[BENCH_RESULT_ISR_CYCLES]);
+		printf("cycles per page   %u\n", (unsigned)SIM_SenderRun.BenchResult[BENCH_RESULT_FLASH_CYCLES]);
+		printf("pages             %u\n", (unsigned)SIM_SenderRun.BenchResult[BENCH_RESULT_PAGES]);
+		printf("receiver link     tec %u, rec %u, esr flags 0x%x, %u error passive, %u bus-off\n",
+		       (unsigned)SIM_SenderRun.Link[1], (unsigned)SIM_SenderRun.Link[2], (unsigned)SIM_SenderRun.Link[3],
+		       (unsigned)SIM_SenderRun.Link[4], (unsigned)SIM_SenderRun.Link[5]);
+	}
+	printf("result            %s\n", Passed ? "PASS" : "FAIL");
+
+	return Passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}